@@ -268,7 +268,8 @@
  * Working with sub-word BASE elements (byte, half) is reserved for future use.
  * However, current displacement types may not work due to natural alignment.
  * Signed/unsigned types can be supported orthogonally in cmd*n_**, cmd*x_**.
- * Working with sub-word SIMD elements (byte, half) has not been investigated.
+ * Working with sub-word SIMD elements (byte, half) is limited to integer ops
+ * in cmdm*_** (cmdg*_**, cmda*_**) subsets, intended for 8-bit image data.
  * However, as current major ISAs lack the ability to do sub-word fp-compute,
  * these corresponding subsets cannot be viewed as valid targets for SPMD.
  *
@@ -277,10 +278,43 @@
  * future extensions to current 2/3-operand SPMD-driven vertical SIMD ISA.
  */
 
+/*
+ * Run-time code generation is enabled with RT_DYNAMIC_CODE build flag (x86).
+ * In this mode EMITB/EMITW emitters write binary code into a memory buffer
+ * (rt_CODE in rtbase.h) instead of the inline assembler's instruction stream,
+ * while ASM_ENTER/ASM_LEAVE wrap the code between them into a function, which
+ * is then called with the same __Info__ parameter and released after return.
+ * ASM_CODE_ENTER/ASM_CODE_LEAVE keep the function in a caller-owned buffer
+ * for repeated calls via ASM_CODE_CALL until released with ASM_CODE_FREE.
+ * As code sections are now driven by C control-flow they can be specialized
+ * at run-time for the data in hand (sizes, constants, SIMD target selection).
+ * Labels (LBL) and references to them (jmpxx_lb, label_ld) are recorded
+ * in the code buffer and resolved once the code is finalized, where jumps
+ * are shortened to their 8-bit displacement forms whenever distances fit.
+ * Both code generation and label fixups are currently limited to x86 targets
+ * (rel8/rel32 jump encodings), other targets stop the build with an #error.
+ */
+
 /******************************************************************************/
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
+/*
+ * System headers required by run-time code generation (rt_CODE in rtbase.h)
+ * are included ahead of definitions below to avoid collisions in short names.
+ */
+#if   (defined RT_DYNAMIC_CODE)
+
+#include <string.h>
+
+#if   (defined RT_WIN32) || (defined RT_WIN64)
+#include <windows.h>
+#else /* RT_LINUX */
+#include <sys/mman.h>
+#endif /* OS */
+
+#endif /* RT_DYNAMIC_CODE */
+
 /*
  * Master config flags for SIMD compatibility modes across all targets.
  * Each target can be configured individually regardless of the master flag.
@@ -298,6 +332,11 @@
 #define RT_SIMD_COMPAT_SSE_MASTER       4 /* for v4 slot SSE2/4.1 - 2,4 (x64) */
 #define RT_SIMD_COMPAT_FMR_MASTER       0 /* for fm*ps_** rounding mode (x86) */
 #define RT_SIMD_FLUSH_ZERO_MASTER       0 /* optional on MIPS and Power */
+#if   (defined __AVX__) /* compiler may keep ymm/zmm live across ASM_LEAVE */
+#define RT_SIMD_COMPAT_VZU_MASTER       0 /* for vzeroupper in ASM_LEAVE (x86) */
+#else /* SSE-only compiler-generated code */
+#define RT_SIMD_COMPAT_VZU_MASTER       1 /* for vzeroupper in ASM_LEAVE (x86) */
+#endif /* __AVX__ */
 
 #include "rtzero.h"
 
@@ -404,8 +443,9 @@
  * Short name for true-condition sign in assembler evaluation of (A == B).
  * The result of the condition evaluation is used as a mask for selection:
  * ((A == B) & C) | ((A != B) & D), therefore it needs to be (-1) if true.
+ * With RT_DYNAMIC_CODE the conditions are evaluated by C (1 if true).
  */
-#if __llvm__
+#if (defined RT_DYNAMIC_CODE) || __llvm__
 #define M   -
 #else /* GAS */
 #define M   +
@@ -1465,6 +1505,17 @@
 #define ASM_OP2(op, p1, p2)     #op"  "#p2", "#p1
 #define ASM_OP3(op, p1, p2, p3) #op"  "#p3", "#p2", "#p1
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define ASM_BEG /*internal*/
+#define ASM_END /*internal*/
+
+#define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
+#define EMITB(b)                code_emitb(__Code__, b);
+#define EMITW(w)                code_emitw(__Code__, w);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
@@ -1472,14 +1523,26 @@
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, %%rax, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, lb, %%rax) ASM_END
 
 #if   (defined RT_X32)
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define label_ld(lb)/*Reax*/                                                \
+        EMITB(0x48) EMITB(0x8D) EMITB(0x05)       /* lea rax, [rip+rel] */  \
+        code_fixup(__Code__, #lb, RT_CODE_REL32, 4);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
     ADR REX(0,       RXB(MD)) EMITB(0x89)                                   \
@@ -1488,9 +1551,19 @@
 
 #elif (defined RT_X64)
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define label_ld(lb)/*Reax*/                                                \
+        EMITB(0x48) EMITB(0x8D) EMITB(0x05)       /* lea rax, [rip+rel] */  \
+        code_fixup(__Code__, #lb, RT_CODE_REL32, 4);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
     ADR REW(0,       RXB(MD)) EMITB(0x89)                                   \
@@ -1512,6 +1585,12 @@
 #define RT_SIMD_FLUSH_ZERO      RT_SIMD_FLUSH_ZERO_MASTER
 #endif /* RT_SIMD_FLUSH_ZERO */
 
+/* RT_SIMD_COMPAT_VZU when enabled makes ASM_LEAVE clear upper halves
+ * of SIMD registers (vzeroupper) on AVX targets to avoid SSE stalls */
+#ifndef RT_SIMD_COMPAT_VZU
+#define RT_SIMD_COMPAT_VZU      RT_SIMD_COMPAT_VZU_MASTER
+#endif /* RT_SIMD_COMPAT_VZU */
+
 /* RT_SIMD_COMPAT_XMM distinguishes between SIMD reg-file sizes
  * with current top values: 0 - 16, 1 - 15, 2 - 14 SIMD regs */
 #ifndef RT_SIMD_COMPAT_XMM
@@ -1549,7 +1628,8 @@
 #endif /* RT_SIMD_COMPAT_SSE */
 
 /* RT_SIMD_COMPAT_FMR when enabled changes the default behavior
- * of fm*ps_** instruction fallbacks to honour rounding mode */
+ * of fm*ps_** instruction fallbacks to honour rounding mode,
+ * 2 - fp64 SIMD instead of x87 for fp32 on SSE (faster, less exact) */
 #ifndef RT_SIMD_COMPAT_FMR
 #define RT_SIMD_COMPAT_FMR      RT_SIMD_COMPAT_FMR_MASTER
 #endif /* RT_SIMD_COMPAT_FMR */
@@ -1602,6 +1682,106 @@
 #include "rtarch_x64_128x1v2.h"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if   (defined RT_DYNAMIC_CODE)
+
+/*
+ * In run-time code generation mode ASM_CODE_ENTER/ASM_CODE_LEAVE emit the same
+ * register save/load sequences as static ASM_ENTER/ASM_LEAVE do, but framed
+ * as a standalone function taking __Info__ as its 1st (and only) argument.
+ * Generic ASM_ENTER/ASM_LEAVE, ASM_CODE_CALL/ASM_CODE_FREE are in rtbase.h.
+ */
+
+#if   (defined RT_X32)
+
+#define ASM_CODE_ARG() /*internal*/                                         \
+        EMITB(0x89) EMITB(0xF8)                   /* eax <- edi, 1st arg */
+
+#elif (defined RT_WIN64)
+
+#define ASM_CODE_ARG() /*internal*/                                         \
+        EMITB(0x48) EMITB(0x89) EMITB(0xC8)       /* rax <- rcx, 1st arg */
+
+#else /* RT_X64 on RT_LINUX */
+
+#define ASM_CODE_ARG() /*internal*/                                         \
+        EMITB(0x48) EMITB(0x89) EMITB(0xF8)       /* rax <- rdi, 1st arg */
+
+#endif /* RT_X32, RT_WIN64, RT_X64 */
+
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_CODE_INIT() /*internal*/                                        \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_CODE_INIT_F() /*internal*/                                      \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_CODE_INIT() /*internal*/                                        \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_CODE_INIT_F() /*internal*/                                      \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+
+#define ASM_CODE_ENTER(__Buf__)                                             \
+{                                                                           \
+    rt_CODE *__Code__ = code_init(__Buf__);                                 \
+        ASM_CODE_ARG()                                                      \
+        stack_sa()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        ASM_CODE_INIT()
+
+#define ASM_CODE_LEAVE(__Buf__)                                             \
+        sregs_la()                                                          \
+        vzero_la()                                                          \
+        stack_la()                                                          \
+        EMITB(0xC3)                               /* ret */                 \
+    code_done(__Code__);                                                    \
+}
+
+#else /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_CODE_ENTER(__Buf__) ASM_CODE_ENTER_F(__Buf__)
+
+#define ASM_CODE_LEAVE(__Buf__) ASM_CODE_LEAVE_F(__Buf__)
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_CODE_ENTER_F(__Buf__)                                           \
+{                                                                           \
+    rt_CODE *__Code__ = code_init(__Buf__);                                 \
+        ASM_CODE_ARG()                                                      \
+        stack_sa()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        ASM_CODE_INIT_F()
+
+#define ASM_CODE_LEAVE_F(__Buf__)                                           \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
+        sregs_la()                                                          \
+        vzero_la()                                                          \
+        stack_la()                                                          \
+        EMITB(0xC3)                               /* ret */                 \
+    code_done(__Code__);                                                    \
+}
+
+#else /* RT_DYNAMIC_CODE */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -1628,6 +1808,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1657,6 +1838,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1702,6 +1884,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1734,6 +1917,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1744,6 +1928,137 @@
 
 #endif /* RT_SIMD_FAST_FCTRL */
 
+/*
+ * The ASM_ENTER_L/ASM_LEAVE_L versions are lightweight alternatives for code
+ * sections entered at high rates (per-pixel, per-ray), where saving/loading
+ * the whole register file dominates the cost of a short computation.
+ * They take a BASE register-usage declaration in the form of a macro
+ * applying its argument to every register the section writes, for example:
+ *     #define s_regs(R) R(Resi) R(Redx) R(Rebx)
+ *     ASM_ENTER_L(info, s_regs) ... ASM_LEAVE_L(info, s_regs)
+ * which turns into the compiler clobber list (Reax, Rebp are always handled),
+ * so that only live registers among the declared ones are preserved.
+ * Registers modified implicitly (Redx in mul/div, Recx in shifts) must be
+ * declared as well, while hidden temporaries are clobbered unconditionally.
+ * SIMD registers are caller-saved in the ABI and are also passed to the
+ * compiler as clobbers instead of being saved to inf_REGS. Targets lacking
+ * the lightweight versions fall back to heavy ones (see ASM_ENTER_L in rtbase).
+ */
+
+#define ASM_L_Reax
+#define ASM_L_Recx      , "rcx"
+#define ASM_L_Redx      , "rdx"
+#define ASM_L_Rebx      , "rbx"
+#define ASM_L_Rebp
+#define ASM_L_Resi      , "rsi"
+#define ASM_L_Redi      , "rdi"
+#define ASM_L_Reg8      , "r8"
+#define ASM_L_Reg9      , "r9"
+#define ASM_L_RegA      , "r10"
+#define ASM_L_RegB      , "r11"
+#define ASM_L_RegC      , "r12"
+#define ASM_L_RegD      , "r13"
+#define ASM_L_RegE      , "r14"
+
+#define ASM_L_CLOB(reg)         ASM_L_##reg
+
+#if (defined __AVX512F__)
+#define ASM_L_SIMD                                                          \
+        , "xmm0",  "xmm1",  "xmm2",  "xmm3",  "xmm4",  "xmm5",  "xmm6",     \
+          "xmm7",  "xmm8",  "xmm9",  "xmm10", "xmm11", "xmm12", "xmm13",    \
+          "xmm14", "xmm15", "xmm16", "xmm17", "xmm18", "xmm19", "xmm20",    \
+          "xmm21", "xmm22", "xmm23", "xmm24", "xmm25", "xmm26", "xmm27",    \
+          "xmm28", "xmm29", "xmm30", "xmm31", "k1",    "k2",    "k3",       \
+          "k4",    "k5",    "k6",    "k7"
+#else /* __AVX512F__ */
+#define ASM_L_SIMD                                                          \
+        , "xmm0",  "xmm1",  "xmm2",  "xmm3",  "xmm4",  "xmm5",  "xmm6",     \
+          "xmm7",  "xmm8",  "xmm9",  "xmm10", "xmm11", "xmm12", "xmm13",    \
+          "xmm14", "xmm15"
+#endif /* __AVX512F__ */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_out()
+
+#else /* RT_SIMD_FLUSH_ZERO */
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_out()                                                         \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_ENTER_L(__Info__, __Regs__)                                     \
+{                                                                           \
+    rt_full __Rebp__;                                                       \
+    asm volatile                                                            \
+    (                                                                       \
+        movlb_ld(%[Info_])                                                  \
+        ASM_BEG ASM_OP2(movq, %[Rebp_], %%rbp) ASM_END                      \
+        movxx_rr(Rebp, Reax)                                                \
+        fctrl_in()
+
+#define ASM_LEAVE_L(__Info__, __Regs__)                                     \
+        fctrl_out()                                                         \
+        vzero_la()                                                          \
+        ASM_BEG ASM_OP2(movq, %%rbp, %[Rebp_]) ASM_END                      \
+        : [Rebp_] "=r" (__Rebp__)                                           \
+        : [Info_]  "r" ((rt_full)__Info__)                                  \
+        : "cc",  "memory", "rax", "r15"                                     \
+          __Regs__(ASM_L_CLOB) ASM_L_SIMD                                   \
+    );                                                                      \
+}
+
+
+#endif /* RT_DYNAMIC_CODE */
+
+/* vzero_xx clears upper halves of SIMD registers (vzeroupper) on AVX targets
+ * to avoid AVX/SSE transition penalties in surrounding code (no-op on SSE),
+ * vzero_la does the same within ASM_LEAVE if enabled by RT_SIMD_COMPAT_VZU */
+#if (defined RT_SIMD_CODE) && !(defined RT_RTARCH_X32_128X1V4_H)
+#define vzero_xx()                                                          \
+        EMITB(0xC5) EMITB(0xF8) EMITB(0x77)
+#else /* SSE or no SIMD target */
+#define vzero_xx()
+#endif /* SSE or no SIMD target */
+
+#if RT_SIMD_COMPAT_VZU != 0
+#define vzero_la()              vzero_xx()
+#else /* RT_SIMD_COMPAT_VZU */
+#define vzero_la()
+#endif /* RT_SIMD_COMPAT_VZU */
+
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
@@ -1759,6 +2074,17 @@
 #define ASM_OP2(op, p1, p2)     #op"  "#p2", "#p1
 #define ASM_OP3(op, p1, p2, p3) #op"  "#p3", "#p2", "#p1
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define ASM_BEG /*internal*/
+#define ASM_END /*internal*/
+
+#define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
+#define EMITB(b)                code_emitb(__Code__, b);
+#define EMITW(w)                code_emitw(__Code__, w);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
@@ -1766,12 +2092,24 @@
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(movl, %%eax, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(movl, lb, %%eax) ASM_END
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define label_ld(lb)/*Reax*/                                                \
+        EMITB(0xB8)                               /* mov eax, abs-addr */   \
+        code_fixup(__Code__, #lb, RT_CODE_ABS32, 4);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(leal, %%eax, lb) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
         EMITB(0x89)                                                         \
@@ -1791,6 +2129,12 @@
 #define RT_SIMD_FLUSH_ZERO      RT_SIMD_FLUSH_ZERO_MASTER
 #endif /* RT_SIMD_FLUSH_ZERO */
 
+/* RT_SIMD_COMPAT_VZU when enabled makes ASM_LEAVE clear upper halves
+ * of SIMD registers (vzeroupper) on AVX targets to avoid SSE stalls */
+#ifndef RT_SIMD_COMPAT_VZU
+#define RT_SIMD_COMPAT_VZU      RT_SIMD_COMPAT_VZU_MASTER
+#endif /* RT_SIMD_COMPAT_VZU */
+
 /* RT_SIMD_COMPAT_RCP when enabled changes the default behavior
  * of rcpps_** instructions to their full-precision fallback */
 #ifndef RT_SIMD_COMPAT_RCP
@@ -1855,6 +2199,92 @@
 #include "rtarch_x86_128x1v4.h"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if   (defined RT_DYNAMIC_CODE)
+
+/*
+ * In run-time code generation mode ASM_CODE_ENTER/ASM_CODE_LEAVE emit the same
+ * register save/load sequences as static ASM_ENTER/ASM_LEAVE do, but framed
+ * as a standalone function taking __Info__ as its 1st (and only) argument.
+ * Generic ASM_ENTER/ASM_LEAVE, ASM_CODE_CALL/ASM_CODE_FREE are in rtbase.h.
+ */
+
+#define ASM_CODE_ARG() /*internal*/                                         \
+        EMITB(0x8B) EMITB(0x44) EMITB(0x24) EMITB(0x04) /* eax <- 1st arg */
+
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_CODE_INIT() /*internal*/                                        \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_CODE_INIT_F() /*internal*/                                      \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_CODE_INIT() /*internal*/                                        \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_CODE_INIT_F() /*internal*/                                      \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+
+#define ASM_CODE_ENTER(__Buf__)                                             \
+{                                                                           \
+    rt_CODE *__Code__ = code_init(__Buf__);                                 \
+        ASM_CODE_ARG()                                                      \
+        stack_sa()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        ASM_CODE_INIT()
+
+#define ASM_CODE_LEAVE(__Buf__)                                             \
+        sregs_la()                                                          \
+        vzero_la()                                                          \
+        stack_la()                                                          \
+        EMITB(0xC3)                               /* ret */                 \
+    code_done(__Code__);                                                    \
+}
+
+#else /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_CODE_ENTER(__Buf__) ASM_CODE_ENTER_F(__Buf__)
+
+#define ASM_CODE_LEAVE(__Buf__) ASM_CODE_LEAVE_F(__Buf__)
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_CODE_ENTER_F(__Buf__)                                           \
+{                                                                           \
+    rt_CODE *__Code__ = code_init(__Buf__);                                 \
+        ASM_CODE_ARG()                                                      \
+        stack_sa()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        ASM_CODE_INIT_F()
+
+#define ASM_CODE_LEAVE_F(__Buf__)                                           \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
+        sregs_la()                                                          \
+        vzero_la()                                                          \
+        stack_la()                                                          \
+        EMITB(0xC3)                               /* ret */                 \
+    code_done(__Code__);                                                    \
+}
+
+#else /* RT_DYNAMIC_CODE */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -1881,6 +2311,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1910,6 +2341,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1955,6 +2387,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1987,6 +2420,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
@@ -1997,6 +2431,111 @@
 
 #endif /* RT_SIMD_FAST_FCTRL */
 
+/*
+ * The ASM_ENTER_L/ASM_LEAVE_L versions save/load only declared BASE registers
+ * via the compiler clobber list, see the definitions for X32/X64 above.
+ */
+
+#define ASM_L_Reax
+#define ASM_L_Recx      , "ecx"
+#define ASM_L_Redx      , "edx"
+#define ASM_L_Rebx      , "ebx"
+#define ASM_L_Rebp
+#define ASM_L_Resi      , "esi"
+#define ASM_L_Redi      , "edi"
+
+#define ASM_L_CLOB(reg)         ASM_L_##reg
+
+#if (defined __SSE__)
+#define ASM_L_SIMD                                                          \
+        , "xmm0",  "xmm1",  "xmm2",  "xmm3",  "xmm4",  "xmm5",  "xmm6",     \
+          "xmm7"
+#else /* __SSE__ */
+#define ASM_L_SIMD
+#endif /* __SSE__ */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_out()
+
+#else /* RT_SIMD_FLUSH_ZERO */
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_in()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#define fctrl_out()                                                         \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_ENTER_L(__Info__, __Regs__)                                     \
+{                                                                           \
+    rt_word __Rebp__;                                                       \
+    asm volatile                                                            \
+    (                                                                       \
+        movlb_ld(%[Info_])                                                  \
+        ASM_BEG ASM_OP2(movl, %[Rebp_], %%ebp) ASM_END                      \
+        movxx_rr(Rebp, Reax)                                                \
+        fctrl_in()
+
+#define ASM_LEAVE_L(__Info__, __Regs__)                                     \
+        fctrl_out()                                                         \
+        vzero_la()                                                          \
+        ASM_BEG ASM_OP2(movl, %%ebp, %[Rebp_]) ASM_END                      \
+        : [Rebp_] "=r" (__Rebp__)                                           \
+        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : "cc",  "memory", "eax"                                            \
+          __Regs__(ASM_L_CLOB) ASM_L_SIMD                                   \
+    );                                                                      \
+}
+
+
+#endif /* RT_DYNAMIC_CODE */
+
+/* vzero_xx clears upper halves of SIMD registers (vzeroupper) on AVX targets
+ * to avoid AVX/SSE transition penalties in surrounding code (no-op on SSE),
+ * vzero_la does the same within ASM_LEAVE if enabled by RT_SIMD_COMPAT_VZU */
+#if (defined RT_SIMD_CODE) && !(defined RT_RTARCH_X86_128X1V4_H)
+#define vzero_xx()                                                          \
+        EMITB(0xC5) EMITB(0xF8) EMITB(0x77)
+#else /* SSE or no SIMD target */
+#define vzero_xx()
+#endif /* SSE or no SIMD target */
+
+#if RT_SIMD_COMPAT_VZU != 0
+#define vzero_la()              vzero_xx()
+#else /* RT_SIMD_COMPAT_VZU */
+#define vzero_la()
+#endif /* RT_SIMD_COMPAT_VZU */
+
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
@@ -2053,6 +2592,12 @@
 #define RT_SIMD_FLUSH_ZERO      RT_SIMD_FLUSH_ZERO_MASTER
 #endif /* RT_SIMD_FLUSH_ZERO */
 
+/* RT_SIMD_COMPAT_VZU when enabled makes ASM_LEAVE clear upper halves
+ * of SIMD registers (vzeroupper) on AVX targets to avoid SSE stalls */
+#ifndef RT_SIMD_COMPAT_VZU
+#define RT_SIMD_COMPAT_VZU      RT_SIMD_COMPAT_VZU_MASTER
+#endif /* RT_SIMD_COMPAT_VZU */
+
 /* RT_SIMD_COMPAT_RCP when enabled changes the default behavior
  * of rcpps_** instructions to their full-precision fallback */
 #ifndef RT_SIMD_COMPAT_RCP
@@ -2143,6 +2688,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
@@ -2169,6 +2715,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
@@ -2211,6 +2758,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
@@ -2240,6 +2788,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
+        vzero_la()                                                          \
         stack_la()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
@@ -2247,6 +2796,22 @@
 
 #endif /* RT_SIMD_FAST_FCTRL */
 
+/* vzero_xx clears upper halves of SIMD registers (vzeroupper) on AVX targets
+ * to avoid AVX/SSE transition penalties in surrounding code (no-op on SSE),
+ * vzero_la does the same within ASM_LEAVE if enabled by RT_SIMD_COMPAT_VZU */
+#if (defined RT_SIMD_CODE) && !(defined RT_RTARCH_X86_128X1V4_H)
+#define vzero_xx()                                                          \
+        EMITB(0xC5) EMITB(0xF8) EMITB(0x77)
+#else /* SSE or no SIMD target */
+#define vzero_xx()
+#endif /* SSE or no SIMD target */
+
+#if RT_SIMD_COMPAT_VZU != 0
+#define vzero_la()              vzero_xx()
+#else /* RT_SIMD_COMPAT_VZU */
+#define vzero_la()
+#endif /* RT_SIMD_COMPAT_VZU */
+
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
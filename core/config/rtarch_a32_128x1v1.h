@@ -217,6 +217,89 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selix_rr(XG, XM, XS)                                                \
+        EMITW(0x6EA01C00 | MXM(REG(XG), REG(XS), REG(XM)))
+
+#define selix_ld(XG, XM, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    REG(XM)))
+
+#define selix3rr(XD, XM, XS, XT)                                            \
+        EMITW(0x4EA01C00 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0x6EE01C00 | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
+#define selix3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE01C00 | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splix_rr(XD, RS)                                                    \
+        EMITW(0x4E040C00 | MXM(REG(XD), REG(RS), 0x00))
+
+#define splix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x91000000 | MDM(TPxx,    MOD(MS), VSL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x4D40C800 | MXM(REG(XD), TPxx,    0x00))
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extix_rr(RD, XS, IS)                                                \
+        EMITW(0x0E043C00 | MXM(REG(RD), REG(XS), 0x00) | (VAL(IS) & 3) << 19)
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insix_rr(XG, RS, IS)                                                \
+        EMITW(0x4E041C00 | MXM(REG(XG), REG(RS), 0x00) | (VAL(IS) & 3) << 19)
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define iloix_rr(XG, XS)                                                    \
+        iloix3rr(W(XG), W(XG), W(XS))
+
+#define iloix_ld(XG, MS, DS)                                                \
+        iloix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloix3rr(XD, XS, XT)                                                \
+        EMITW(0x4E803800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define iloix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E803800 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#define ihiix_rr(XG, XS)                                                    \
+        ihiix3rr(W(XG), W(XG), W(XS))
+
+#define ihiix_ld(XG, MS, DS)                                                \
+        ihiix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiix3rr(XD, XS, XT)                                                \
+        EMITW(0x4E807800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define ihiix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E807800 | MXM(REG(XD), REG(XS), TmmM))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revix_rx(XG)                                                        \
+        revix_rr(W(XG), W(XG))
+
+#define revix_rr(XD, XS)                                                    \
+        EMITW(0x4EA00800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6E004000 | MXM(REG(XD), REG(XD), REG(XD)))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -461,6 +544,36 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed single-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1] + S[2] + S[3]), result in lowest element of D */
+
+#define adhis_rr(XD, XS)                                                    \
+        EMITW(0x6E20D400 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x7E30D800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define adhis_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        adhis_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mnhis_rr(XD, XS)                                                    \
+        EMITW(0x6EB0F800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define mnhis_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        mnhis_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mxhis_rr(XD, XS)                                                    \
+        EMITW(0x6E30F800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define mxhis_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        mxhis_rr(W(XD), W(XD))
+
 /*************   packed single-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -604,6 +717,22 @@
         addwz_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jezxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbix_rr(RD, XS)                                                    \
+        EMITW(0x6F210400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x6F611400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x7F621400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E043C00 | MXM(REG(RD), TmmM,    0x00))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcix_rr(RD, XS)                                                    \
+        EMITW(0x6F210400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4EB1B800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E043C00 | MXM(REG(RD), TmmM,    0x00))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -748,6 +877,20 @@
         EMITW(0x4E21A800 | MXM(REG(XD), REG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvf (D = fp16-to-fp32 S), loads half-width memory */
+
+#define cvfis_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xFC606800 | MRM(REG(XD), MOD(MS), TDxx))                     \
+        EMITW(0x0E217800 | MXM(REG(XD), REG(XD), 0x00))
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory */
+
+#define cvfis_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0E216800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0xFC206800 | MRM(TmmM,    MOD(MD), TDxx))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -782,6 +925,30 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EA08400 | MXM(REG(XD), REG(XS), TmmM))
 
+/* abs (G = |G|), (D = |S|) - signed */
+
+#define absin_rx(XG)                                                        \
+        absin_rr(W(XG), W(XG))
+
+#define absin_rr(XD, XS)                                                    \
+        EMITW(0x4EA0B800 | MXM(REG(XD), REG(XS), 0x00))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulix_rr(XG, XS)                                                    \
+        mulix3rr(W(XG), W(XG), W(XS))
+
+#define mulix_ld(XG, MS, DS)                                                \
+        mulix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulix3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA09C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA09C00 | MXM(REG(XD), REG(XS), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -898,6 +1065,509 @@
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#define minix_rr(XG, XS)                                                    \
+        minix3rr(W(XG), W(XG), W(XS))
+
+#define minix_ld(XG, MS, DS)                                                \
+        minix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA06C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define minix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA06C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minin_rr(XG, XS)                                                    \
+        minin3rr(W(XG), W(XG), W(XS))
+
+#define minin_ld(XG, MS, DS)                                                \
+        minin3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minin3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA06C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define minin3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA06C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#define maxix_rr(XG, XS)                                                    \
+        maxix3rr(W(XG), W(XG), W(XS))
+
+#define maxix_ld(XG, MS, DS)                                                \
+        maxix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA06400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA06400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxin_rr(XG, XS)                                                    \
+        maxin3rr(W(XG), W(XG), W(XS))
+
+#define maxin_ld(XG, MS, DS)                                                \
+        maxin3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxin3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA06400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxin3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA06400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqix_rr(XG, XS)                                                    \
+        ceqix3rr(W(XG), W(XG), W(XS))
+
+#define ceqix_ld(XG, MS, DS)                                                \
+        ceqix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define ceqix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA08C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cltix_rr(XG, XS)                                                    \
+        cltix3rr(W(XG), W(XG), W(XS))
+
+#define cltix_ld(XG, MS, DS)                                                \
+        cltix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA03400 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define cltix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA03400 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#define cltin_rr(XG, XS)                                                    \
+        cltin3rr(W(XG), W(XG), W(XS))
+
+#define cltin_ld(XG, MS, DS)                                                \
+        cltin3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltin3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA03400 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define cltin3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA03400 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cleix_rr(XG, XS)                                                    \
+        cleix3rr(W(XG), W(XG), W(XS))
+
+#define cleix_ld(XG, MS, DS)                                                \
+        cleix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cleix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA03C00 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define cleix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#define clein_rr(XG, XS)                                                    \
+        clein3rr(W(XG), W(XG), W(XS))
+
+#define clein_ld(XG, MS, DS)                                                \
+        clein3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define clein3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA03C00 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define clein3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgtix_rr(XG, XS)                                                    \
+        cgtix3rr(W(XG), W(XG), W(XS))
+
+#define cgtix_ld(XG, MS, DS)                                                \
+        cgtix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA03400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgtix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA03400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtin_rr(XG, XS)                                                    \
+        cgtin3rr(W(XG), W(XG), W(XS))
+
+#define cgtin_ld(XG, MS, DS)                                                \
+        cgtin3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtin3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA03400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgtin3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA03400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgeix_rr(XG, XS)                                                    \
+        cgeix3rr(W(XG), W(XG), W(XS))
+
+#define cgeix_ld(XG, MS, DS)                                                \
+        cgeix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgeix3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA03C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgeix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA03C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgein_rr(XG, XS)                                                    \
+        cgein3rr(W(XG), W(XG), W(XS))
+
+#define cgein_ld(XG, MS, DS)                                                \
+        cgein3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgein3rr(XD, XS, XT)                                                \
+        EMITW(0x4EA03C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgein3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EA03C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addgx_rr(XG, XS)                                                    \
+        addgx3rr(W(XG), W(XG), W(XS))
+
+#define addgx_ld(XG, MS, DS)                                                \
+        addgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgx3rr(XD, XS, XT)                                                \
+        EMITW(0x4E608400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E608400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subgx_rr(XG, XS)                                                    \
+        subgx3rr(W(XG), W(XG), W(XS))
+
+#define subgx_ld(XG, MS, DS)                                                \
+        subgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgx3rr(XD, XS, XT)                                                \
+        EMITW(0x6E608400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E608400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsgx_rr(XG, XS)                                                    \
+        adsgx3rr(W(XG), W(XG), W(XS))
+
+#define adsgx_ld(XG, MS, DS)                                                \
+        adsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgx3rr(XD, XS, XT)                                                \
+        EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsgn_rr(XG, XS)                                                    \
+        adsgn3rr(W(XG), W(XG), W(XS))
+
+#define adsgn_ld(XG, MS, DS)                                                \
+        adsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgn3rr(XD, XS, XT)                                                \
+        EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsgx_rr(XG, XS)                                                    \
+        sbsgx3rr(W(XG), W(XG), W(XS))
+
+#define sbsgx_ld(XG, MS, DS)                                                \
+        sbsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgx3rr(XD, XS, XT)                                                \
+        EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsgn_rr(XG, XS)                                                    \
+        sbsgn3rr(W(XG), W(XG), W(XS))
+
+#define sbsgn_ld(XG, MS, DS)                                                \
+        sbsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgn3rr(XD, XS, XT)                                                \
+        EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avggx_rr(XG, XS)                                                    \
+        avggx3rr(W(XG), W(XG), W(XS))
+
+#define avggx_ld(XG, MS, DS)                                                \
+        avggx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggx3rr(XD, XS, XT)                                                \
+        EMITW(0x6E601400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E601400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define mingn_rr(XG, XS)                                                    \
+        mingn3rr(W(XG), W(XG), W(XS))
+
+#define mingn_ld(XG, MS, DS)                                                \
+        mingn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingn3rr(XD, XS, XT)                                                \
+        EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxgn_rr(XG, XS)                                                    \
+        maxgn3rr(W(XG), W(XG), W(XS))
+
+#define maxgn_ld(XG, MS, DS)                                                \
+        maxgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgn3rr(XD, XS, XT)                                                \
+        EMITW(0x4E606400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E606400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addgb_rr(XG, XS)                                                    \
+        addgb3rr(W(XG), W(XG), W(XS))
+
+#define addgb_ld(XG, MS, DS)                                                \
+        addgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgb3rr(XD, XS, XT)                                                \
+        EMITW(0x4E208400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E208400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subgb_rr(XG, XS)                                                    \
+        subgb3rr(W(XG), W(XG), W(XS))
+
+#define subgb_ld(XG, MS, DS)                                                \
+        subgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgb3rr(XD, XS, XT)                                                \
+        EMITW(0x6E208400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E208400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsgb_rr(XG, XS)                                                    \
+        adsgb3rr(W(XG), W(XG), W(XS))
+
+#define adsgb_ld(XG, MS, DS)                                                \
+        adsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgb3rr(XD, XS, XT)                                                \
+        EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsgb_rr(XG, XS)                                                    \
+        sbsgb3rr(W(XG), W(XG), W(XS))
+
+#define sbsgb_ld(XG, MS, DS)                                                \
+        sbsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgb3rr(XD, XS, XT)                                                \
+        EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avggb_rr(XG, XS)                                                    \
+        avggb3rr(W(XG), W(XG), W(XS))
+
+#define avggb_ld(XG, MS, DS)                                                \
+        avggb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggb3rr(XD, XS, XT)                                                \
+        EMITW(0x6E201400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E201400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define mingb_rr(XG, XS)                                                    \
+        mingb3rr(W(XG), W(XG), W(XS))
+
+#define mingb_ld(XG, MS, DS)                                                \
+        mingb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingb3rr(XD, XS, XT)                                                \
+        EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxgb_rr(XG, XS)                                                    \
+        maxgb3rr(W(XG), W(XG), W(XS))
+
+#define maxgb_ld(XG, MS, DS)                                                \
+        maxgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgb3rr(XD, XS, XT)                                                \
+        EMITW(0x6E206400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E206400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlgx_rr(XD, XS)                                                    \
+        EMITW(0x2F08A400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlgn_rr(XD, XS)                                                    \
+        EMITW(0x0F08A400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhgx_rr(XD, XS)                                                    \
+        EMITW(0x6F08A400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhgn_rr(XD, XS)                                                    \
+        EMITW(0x4F08A400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        EMITW(0x2E212800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x6E212800 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
 /************************   helper macros (FPU mode)   ************************/
 
 /* simd mode
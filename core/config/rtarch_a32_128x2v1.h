@@ -463,6 +463,39 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed single-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1] + ... + S[7]), result in lowest element of D */
+
+#define adhcs_rr(XD, XS)                                                    \
+        EMITW(0x4E20D400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0x6E20D400 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x7E30D800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define adhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        adhcs_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1], ..., S[7])), result in lowest element of D */
+
+#define mnhcs_rr(XD, XS)                                                    \
+        EMITW(0x4EA0F400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0x6EB0F800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define mnhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhcs_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1], ..., S[7])), result in lowest element of D */
+
+#define mxhcs_rr(XD, XS)                                                    \
+        EMITW(0x4E20F400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0x6E30F800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define mxhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhcs_rr(W(XD), W(XD))
+
 /*************   packed single-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -642,6 +675,27 @@
         addwz_ri(Reax, IB(RT_SIMD_MASK_##mask##32_256))                     \
         jezxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbcx_rr(RD, XS)                                                    \
+        EMITW(0x0E612800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E612800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x6F110400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x6F311400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x6F621400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x7F641400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E013C00 | MXM(REG(RD), TmmM,    0x00))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkccx_rr(RD, XS)                                                    \
+        EMITW(0x0E612800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E612800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x6F110400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x4E71B800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E023C00 | MXM(REG(RD), TmmM,    0x00))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -830,6 +884,22 @@
         EMITW(0x4E21A800 | MXM(RYG(XD), RYG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvf (D = fp16-to-fp32 S), loads half-width memory */
+
+#define cvfcs_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x3CE06800 | MRM(TmmM,    MOD(MS), TDxx))                     \
+        EMITW(0x0E217800 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x4E217800 | MXM(RYG(XD), TmmM,    0x00))
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory */
+
+#define cvfcs_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0E216800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E216800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x3CA06800 | MRM(TmmM,    MOD(MD), TDxx))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1015,6 +1085,369 @@
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EA04400 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addax_rr(XG, XS)                                                    \
+        addax3rr(W(XG), W(XG), W(XS))
+
+#define addax_ld(XG, MS, DS)                                                \
+        addax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addax3rr(XD, XS, XT)                                                \
+        EMITW(0x4E608400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E608400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define addax3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E608400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E608400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subax_rr(XG, XS)                                                    \
+        subax3rr(W(XG), W(XG), W(XS))
+
+#define subax_ld(XG, MS, DS)                                                \
+        subax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subax3rr(XD, XS, XT)                                                \
+        EMITW(0x6E608400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E608400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define subax3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E608400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E608400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsax_rr(XG, XS)                                                    \
+        adsax3rr(W(XG), W(XG), W(XS))
+
+#define adsax_ld(XG, MS, DS)                                                \
+        adsax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsax3rr(XD, XS, XT)                                                \
+        EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E600C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define adsax3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E600C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E600C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsan_rr(XG, XS)                                                    \
+        adsan3rr(W(XG), W(XG), W(XS))
+
+#define adsan_ld(XG, MS, DS)                                                \
+        adsan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsan3rr(XD, XS, XT)                                                \
+        EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E600C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define adsan3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E600C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E600C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsax_rr(XG, XS)                                                    \
+        sbsax3rr(W(XG), W(XG), W(XS))
+
+#define sbsax_ld(XG, MS, DS)                                                \
+        sbsax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsax3rr(XD, XS, XT)                                                \
+        EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E602C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define sbsax3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E602C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E602C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsan_rr(XG, XS)                                                    \
+        sbsan3rr(W(XG), W(XG), W(XS))
+
+#define sbsan_ld(XG, MS, DS)                                                \
+        sbsan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsan3rr(XD, XS, XT)                                                \
+        EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E602C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define sbsan3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E602C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E602C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avgax_rr(XG, XS)                                                    \
+        avgax3rr(W(XG), W(XG), W(XS))
+
+#define avgax_ld(XG, MS, DS)                                                \
+        avgax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgax3rr(XD, XS, XT)                                                \
+        EMITW(0x6E601400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E601400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define avgax3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E601400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E601400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minan_rr(XG, XS)                                                    \
+        minan3rr(W(XG), W(XG), W(XS))
+
+#define minan_ld(XG, MS, DS)                                                \
+        minan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minan3rr(XD, XS, XT)                                                \
+        EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E606C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define minan3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E606C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E606C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxan_rr(XG, XS)                                                    \
+        maxan3rr(W(XG), W(XG), W(XS))
+
+#define maxan_ld(XG, MS, DS)                                                \
+        maxan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxan3rr(XD, XS, XT)                                                \
+        EMITW(0x4E606400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E606400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define maxan3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E606400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E606400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addab_rr(XG, XS)                                                    \
+        addab3rr(W(XG), W(XG), W(XS))
+
+#define addab_ld(XG, MS, DS)                                                \
+        addab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addab3rr(XD, XS, XT)                                                \
+        EMITW(0x4E208400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x4E208400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define addab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E208400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E208400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subab_rr(XG, XS)                                                    \
+        subab3rr(W(XG), W(XG), W(XS))
+
+#define subab_ld(XG, MS, DS)                                                \
+        subab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E208400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E208400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define subab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E208400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E208400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsab_rr(XG, XS)                                                    \
+        adsab3rr(W(XG), W(XG), W(XS))
+
+#define adsab_ld(XG, MS, DS)                                                \
+        adsab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E200C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define adsab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E200C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E200C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsab_rr(XG, XS)                                                    \
+        sbsab3rr(W(XG), W(XG), W(XS))
+
+#define sbsab_ld(XG, MS, DS)                                                \
+        sbsab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E202C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define sbsab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E202C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E202C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avgab_rr(XG, XS)                                                    \
+        avgab3rr(W(XG), W(XG), W(XS))
+
+#define avgab_ld(XG, MS, DS)                                                \
+        avgab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E201400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E201400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define avgab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E201400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E201400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define minab_rr(XG, XS)                                                    \
+        minab3rr(W(XG), W(XG), W(XS))
+
+#define minab_ld(XG, MS, DS)                                                \
+        minab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E206C00 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define minab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E206C00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E206C00 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxab_rr(XG, XS)                                                    \
+        maxab3rr(W(XG), W(XG), W(XS))
+
+#define maxab_ld(XG, MS, DS)                                                \
+        maxab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxab3rr(XD, XS, XT)                                                \
+        EMITW(0x6E206400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E206400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define maxab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E206400 | MXM(REG(XD), REG(XS), TmmM))                     \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E206400 | MXM(RYG(XD), RYG(XS), TmmM))
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlax_rr(XD, XS)                                                    \
+        EMITW(0x6F08A400 | MXM(RYG(XD), REG(XS), 0x00))                     \
+        EMITW(0x2F08A400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlan_rr(XD, XS)                                                    \
+        EMITW(0x4F08A400 | MXM(RYG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0F08A400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhax_rr(XD, XS)                                                    \
+        EMITW(0x2F08A400 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x6F08A400 | MXM(RYG(XD), RYG(XS), 0x00))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhan_rr(XD, XS)                                                    \
+        EMITW(0x0F08A400 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x4F08A400 | MXM(RYG(XD), RYG(XS), 0x00))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsab_rr(XD, XS, XT)                                                \
+        EMITW(0x2E212800 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x6E212800 | MXM(TmmM,    RYG(XT), 0x00))                     \
+        EMITW(0x2E212800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6E212800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), TmmM,    TmmM))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -133,6 +133,88 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define seljx_rr(XG, XM, XS)                                                \
+        EMITW(0x6EA01C00 | MXM(REG(XG), REG(XS), REG(XM)))
+
+#define seljx_ld(XG, XM, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x6EA01C00 | MXM(REG(XG), TmmM,    REG(XM)))
+
+#define seljx3rr(XD, XM, XS, XT)                                            \
+        EMITW(0x4EA01C00 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0x6EE01C00 | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
+#define seljx3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE01C00 | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define spljx_rr(XD, RS)                                                    \
+        EMITW(0x4E080C00 | MXM(REG(XD), REG(RS), 0x00))
+
+#define spljx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x91000000 | MDM(TPxx,    MOD(MS), VSL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x4D40CC00 | MXM(REG(XD), TPxx,    0x00))
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extjx_rr(RD, XS, IS)                                                \
+        EMITW(0x4E083C00 | MXM(REG(RD), REG(XS), 0x00) | (VAL(IS) & 1) << 20)
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insjx_rr(XG, RS, IS)                                                \
+        EMITW(0x4E081C00 | MXM(REG(XG), REG(RS), 0x00) | (VAL(IS) & 1) << 20)
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilojx_rr(XG, XS)                                                    \
+        ilojx3rr(W(XG), W(XG), W(XS))
+
+#define ilojx_ld(XG, MS, DS)                                                \
+        ilojx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ilojx3rr(XD, XS, XT)                                                \
+        EMITW(0x4EC03800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define ilojx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EC03800 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihijx_rr(XG, XS)                                                    \
+        ihijx3rr(W(XG), W(XG), W(XS))
+
+#define ihijx_ld(XG, MS, DS)                                                \
+        ihijx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihijx3rr(XD, XS, XT)                                                \
+        EMITW(0x4EC07800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define ihijx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EC07800 | MXM(REG(XD), REG(XS), TmmM))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revjx_rx(XG)                                                        \
+        revjx_rr(W(XG), W(XG))
+
+#define revjx_rr(XD, XS)                                                    \
+        EMITW(0x6E004000 | MXM(REG(XD), REG(XS), REG(XS)))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -377,6 +459,35 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed double-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1]), result in lowest element of D */
+
+#define adhjs_rr(XD, XS)                                                    \
+        EMITW(0x7E70D800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define adhjs_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        adhjs_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1])), result in lowest element of D */
+
+#define mnhjs_rr(XD, XS)                                                    \
+        EMITW(0x7EF0F800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define mnhjs_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhjs_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1])), result in lowest element of D */
+
+#define mxhjs_rr(XD, XS)                                                    \
+        EMITW(0x7E70F800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define mxhjs_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhjs_rr(W(XD), W(XD))
+
 /*************   packed double-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -520,6 +631,21 @@
         addwz_ri(Reax, IB(RT_SIMD_MASK_##mask##64_128))                     \
         jezxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbjx_rr(RD, XS)                                                    \
+        EMITW(0x6F410400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x7F611400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E043C00 | MXM(REG(RD), TmmM,    0x00))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcjx_rr(RD, XS)                                                    \
+        EMITW(0x6F410400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x5EF1B800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E043C00 | MXM(REG(RD), TmmM,    0x00))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -664,6 +790,29 @@
         EMITW(0x4E61A800 | MXM(REG(XD), REG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvljs_rr(XD, XS)                                                    \
+        EMITW(0x0E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhjs_rr(XD, XS)                                                    \
+        EMITW(0x4E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsis_rr(XD, XS, XT)                                                \
+        EMITW(0x0E616800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E616800 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -698,6 +847,14 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x6EE08400 | MXM(REG(XD), REG(XS), TmmM))
 
+/* abs (G = |G|), (D = |S|) - signed */
+
+#define absjn_rx(XG)                                                        \
+        absjn_rr(W(XG), W(XG))
+
+#define absjn_rr(XD, XS)                                                    \
+        EMITW(0x4EE0B800 | MXM(REG(XD), REG(XS), 0x00))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -814,6 +971,152 @@
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqjx_rr(XG, XS)                                                    \
+        ceqjx3rr(W(XG), W(XG), W(XS))
+
+#define ceqjx_ld(XG, MS, DS)                                                \
+        ceqjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqjx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define ceqjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE08C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cltjx_rr(XG, XS)                                                    \
+        cltjx3rr(W(XG), W(XG), W(XS))
+
+#define cltjx_ld(XG, MS, DS)                                                \
+        cltjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltjx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE03400 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define cltjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE03400 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#define cltjn_rr(XG, XS)                                                    \
+        cltjn3rr(W(XG), W(XG), W(XS))
+
+#define cltjn_ld(XG, MS, DS)                                                \
+        cltjn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltjn3rr(XD, XS, XT)                                                \
+        EMITW(0x4EE03400 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define cltjn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EE03400 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define clejx_rr(XG, XS)                                                    \
+        clejx3rr(W(XG), W(XG), W(XS))
+
+#define clejx_ld(XG, MS, DS)                                                \
+        clejx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define clejx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE03C00 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define clejx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#define clejn_rr(XG, XS)                                                    \
+        clejn3rr(W(XG), W(XG), W(XS))
+
+#define clejn_ld(XG, MS, DS)                                                \
+        clejn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define clejn3rr(XD, XS, XT)                                                \
+        EMITW(0x4EE03C00 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define clejn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EE03C00 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgtjx_rr(XG, XS)                                                    \
+        cgtjx3rr(W(XG), W(XG), W(XS))
+
+#define cgtjx_ld(XG, MS, DS)                                                \
+        cgtjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtjx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE03400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgtjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE03400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtjn_rr(XG, XS)                                                    \
+        cgtjn3rr(W(XG), W(XG), W(XS))
+
+#define cgtjn_ld(XG, MS, DS)                                                \
+        cgtjn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtjn3rr(XD, XS, XT)                                                \
+        EMITW(0x4EE03400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgtjn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EE03400 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgejx_rr(XG, XS)                                                    \
+        cgejx3rr(W(XG), W(XG), W(XS))
+
+#define cgejx_ld(XG, MS, DS)                                                \
+        cgejx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgejx3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE03C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgejx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE03C00 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgejn_rr(XG, XS)                                                    \
+        cgejn3rr(W(XG), W(XG), W(XS))
+
+#define cgejn_ld(XG, MS, DS)                                                \
+        cgejn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgejn3rr(XD, XS, XT)                                                \
+        EMITW(0x4EE03C00 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define cgejn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EE03C00 | MXM(REG(XD), REG(XS), TmmM))
+
 /*********   scalar double-precision floating-point move/arithmetic   *********/
 
 /* mov (D = S) */
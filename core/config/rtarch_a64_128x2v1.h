@@ -447,6 +447,38 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed double-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1] + S[2] + S[3]), result in lowest element of D */
+
+#define adhds_rr(XD, XS)                                                    \
+        EMITW(0x4E60D400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0x7E70D800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define adhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        adhds_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mnhds_rr(XD, XS)                                                    \
+        EMITW(0x4EE0F400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0x7EF0F800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define mnhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhds_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mxhds_rr(XD, XS)                                                    \
+        EMITW(0x4E60F400 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0x7E70F800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define mxhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhds_rr(W(XD), W(XD))
+
 /*************   packed double-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -626,6 +658,26 @@
         addwz_ri(Reax, IB(RT_SIMD_MASK_##mask##64_256))                     \
         jezxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbdx_rr(RD, XS)                                                    \
+        EMITW(0x0EA12800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4EA12800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x6F210400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x6F611400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x7F621400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E043C00 | MXM(REG(RD), TmmM,    0x00))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcdx_rr(RD, XS)                                                    \
+        EMITW(0x0EA12800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4EA12800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x6F210400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x4EB1B800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0E043C00 | MXM(REG(RD), TmmM,    0x00))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -814,6 +866,34 @@
         EMITW(0x4E61A800 | MXM(RYG(XD), RYG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlds_rr(XD, XS)                                                    \
+        EMITW(0x4E617800 | MXM(RYG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhds_rr(XD, XS)                                                    \
+        EMITW(0x0E617800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x4E617800 | MXM(RYG(XD), RYG(XS), 0x00))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvscs_rr(XD, XS, XT)                                                \
+        EMITW(0x0E616800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E616800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x0E616800 | MXM(REG(XD), REG(XT), 0x00))                     \
+        EMITW(0x4E616800 | MXM(REG(XD), RYG(XT), 0x00))                     \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1516,6 +1516,18 @@
 
      /* adrpx_ld(RD, MS, DS) in 32-bit rtarch_***_***.h files, SIMD-aligned */
 
+/* prf (prefetch line at S into L1/L2 data-cache)
+ * set-flags: no
+ * hint only, doesn't fault on invalid addresses, may be ignored by the core */
+
+#define prfxx_l1(MS, DS)                     /* pld [MS, TDxx] */           \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF790F000 | MRM(0x00,    MOD(MS), TDxx))
+
+#define prfxx_l2(MS, DS)      /* pld [MS, TDxx], no L2-only hint */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF790F000 | MRM(0x00,    MOD(MS), TDxx))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -213,6 +213,30 @@
         EMITW(0xF3200150 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0xF4000AAF | MXM(TmmM,    TPxx,    0x00))
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selix_rr(XG, XM, XS)                                                \
+        EMITW(0xF3200150 | MXM(REG(XG), REG(XS), REG(XM)))
+
+#define selix_ld(XG, XM, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3200150 | MXM(REG(XG), TmmM,    REG(XM)))
+
+#define selix3rr(XD, XM, XS, XT)                                            \
+        EMITW(0xF2200150 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0xF3300150 | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0xF2200150 | MXM(REG(XD), TmmM,    TmmM))
+
+#define selix3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3300150 | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0xF2200150 | MXM(REG(XD), TmmM,    TmmM))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -888,6 +912,23 @@
         addwz_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128))                     \
         jezxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbix_rr(RD, XS)                                                    \
+        EMITW(0xF3A10050 | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW(0xF3A101D0 | MXM(TmmM,    0x00,    TmmM))                     \
+        EMITW(0xF3BA0200 | MXM(TmmM,    0x00,    TmmM))                     \
+        EMITW(0xF3A20190 | MXM(TmmM,    0x00,    TmmM))                     \
+        EMITW(0xEE100B10 | MXM(REG(RD), TmmM,    0x00))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcix_rr(RD, XS)                                                    \
+        EMITW(0xF3A10050 | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW(0xF2200B10 | MXM(TmmM,    TmmM,    TmmM+1))                   \
+        EMITW(0xF2200B10 | MXM(TmmM,    TmmM,    TmmM))                     \
+        EMITW(0xEE100B10 | MXM(REG(RD), TmmM,    0x00))
+
 /*************   packed single-precision floating-point convert   *************/
 
 #if (RT_128X1 < 4) /* ASIMDv4 is used here for ARMv8:AArch32 processors */
@@ -1222,6 +1263,23 @@
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xF3200840 | MXM(REG(XD), REG(XS), TmmM))
 
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulix_rr(XG, XS)                                                    \
+        mulix3rr(W(XG), W(XG), W(XS))
+
+#define mulix_ld(XG, MS, DS)                                                \
+        mulix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulix3rr(XD, XS, XT)                                                \
+        EMITW(0xF2200950 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2200950 | MXM(REG(XD), REG(XS), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -1341,6 +1399,315 @@
         EMITW(0xF3B903C0 | MXM(TmmM,    0x00,    TmmM))                     \
         EMITW(0xF2200440 | MXM(REG(XD), TmmM,    REG(XS)))
 
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addgx_rr(XG, XS)                                                    \
+        addgx3rr(W(XG), W(XG), W(XS))
+
+#define addgx_ld(XG, MS, DS)                                                \
+        addgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgx3rr(XD, XS, XT)                                                \
+        EMITW(0xF2100840 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2100840 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subgx_rr(XG, XS)                                                    \
+        subgx3rr(W(XG), W(XG), W(XS))
+
+#define subgx_ld(XG, MS, DS)                                                \
+        subgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgx3rr(XD, XS, XT)                                                \
+        EMITW(0xF3100840 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3100840 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsgx_rr(XG, XS)                                                    \
+        adsgx3rr(W(XG), W(XG), W(XS))
+
+#define adsgx_ld(XG, MS, DS)                                                \
+        adsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgx3rr(XD, XS, XT)                                                \
+        EMITW(0xF3100050 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3100050 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsgn_rr(XG, XS)                                                    \
+        adsgn3rr(W(XG), W(XG), W(XS))
+
+#define adsgn_ld(XG, MS, DS)                                                \
+        adsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgn3rr(XD, XS, XT)                                                \
+        EMITW(0xF2100050 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2100050 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsgx_rr(XG, XS)                                                    \
+        sbsgx3rr(W(XG), W(XG), W(XS))
+
+#define sbsgx_ld(XG, MS, DS)                                                \
+        sbsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgx3rr(XD, XS, XT)                                                \
+        EMITW(0xF3100250 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3100250 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsgn_rr(XG, XS)                                                    \
+        sbsgn3rr(W(XG), W(XG), W(XS))
+
+#define sbsgn_ld(XG, MS, DS)                                                \
+        sbsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgn3rr(XD, XS, XT)                                                \
+        EMITW(0xF2100250 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2100250 | MXM(REG(XD), REG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avggx_rr(XG, XS)                                                    \
+        avggx3rr(W(XG), W(XG), W(XS))
+
+#define avggx_ld(XG, MS, DS)                                                \
+        avggx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggx3rr(XD, XS, XT)                                                \
+        EMITW(0xF3100140 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3100140 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define mingn_rr(XG, XS)                                                    \
+        mingn3rr(W(XG), W(XG), W(XS))
+
+#define mingn_ld(XG, MS, DS)                                                \
+        mingn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingn3rr(XD, XS, XT)                                                \
+        EMITW(0xF2100650 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2100650 | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxgn_rr(XG, XS)                                                    \
+        maxgn3rr(W(XG), W(XG), W(XS))
+
+#define maxgn_ld(XG, MS, DS)                                                \
+        maxgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgn3rr(XD, XS, XT)                                                \
+        EMITW(0xF2100640 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2100640 | MXM(REG(XD), REG(XS), TmmM))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addgb_rr(XG, XS)                                                    \
+        addgb3rr(W(XG), W(XG), W(XS))
+
+#define addgb_ld(XG, MS, DS)                                                \
+        addgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgb3rr(XD, XS, XT)                                                \
+        EMITW(0xF2000840 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2000840 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subgb_rr(XG, XS)                                                    \
+        subgb3rr(W(XG), W(XG), W(XS))
+
+#define subgb_ld(XG, MS, DS)                                                \
+        subgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgb3rr(XD, XS, XT)                                                \
+        EMITW(0xF3000840 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3000840 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsgb_rr(XG, XS)                                                    \
+        adsgb3rr(W(XG), W(XG), W(XS))
+
+#define adsgb_ld(XG, MS, DS)                                                \
+        adsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgb3rr(XD, XS, XT)                                                \
+        EMITW(0xF3000050 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3000050 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsgb_rr(XG, XS)                                                    \
+        sbsgb3rr(W(XG), W(XG), W(XS))
+
+#define sbsgb_ld(XG, MS, DS)                                                \
+        sbsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgb3rr(XD, XS, XT)                                                \
+        EMITW(0xF3000250 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3000250 | MXM(REG(XD), REG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avggb_rr(XG, XS)                                                    \
+        avggb3rr(W(XG), W(XG), W(XS))
+
+#define avggb_ld(XG, MS, DS)                                                \
+        avggb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggb3rr(XD, XS, XT)                                                \
+        EMITW(0xF3000140 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3000140 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define mingb_rr(XG, XS)                                                    \
+        mingb3rr(W(XG), W(XG), W(XS))
+
+#define mingb_ld(XG, MS, DS)                                                \
+        mingb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingb3rr(XD, XS, XT)                                                \
+        EMITW(0xF3000650 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3000650 | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxgb_rr(XG, XS)                                                    \
+        maxgb3rr(W(XG), W(XG), W(XS))
+
+#define maxgb_ld(XG, MS, DS)                                                \
+        maxgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgb3rr(XD, XS, XT)                                                \
+        EMITW(0xF3000640 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF3000640 | MXM(REG(XD), REG(XS), TmmM))
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlgx_rr(XD, XS)                                                    \
+        EMITW(0xF3880A10 | MXM(REG(XD), 0x00,    REG(XS)))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlgn_rr(XD, XS)                                                    \
+        EMITW(0xF2880A10 | MXM(REG(XD), 0x00,    REG(XS)))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhgx_rr(XD, XS)                                                    \
+        EMITW(0xF3880A10 | MXM(REG(XD), 0x00,    REG(XS)+1))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhgn_rr(XD, XS)                                                    \
+        EMITW(0xF2880A10 | MXM(REG(XD), 0x00,    REG(XS)+1))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        EMITW(0xF3B20240 | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW(0xF3B20240 | MXM(TmmM+1,  0x00,    REG(XT)))                  \
+        EMITW(0xF2200150 | MXM(REG(XD), TmmM,    TmmM))
+
 /************************   helper macros (FPU mode)   ************************/
 
 /* simd mode
@@ -1639,6 +1639,36 @@
 
      /* adrpx_ld(RD, MS, DS) in 32-bit rtarch_***_***.h files, SIMD-aligned */
 
+/* prf (prefetch line at S into L1/L2 data-cache)
+ * set-flags: no
+ * hint only, doesn't fault on invalid addresses, may be ignored by the core */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define prfxx_l1(MS, DS)                 /* pref load, 0(TDxx) */           \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MRM(0x00,    TDxx,    0x00))
+
+#define prfxx_l2(MS, DS)        /* pref load_retained, 0(TDxx) */           \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MRM(0x00,    TDxx,    0x06))
+
+#else /* RT_BASE_COMPAT_REV >= 6, r6 */
+
+#define prfxx_l1(MS, DS)                 /* pref load, 0(TDxx) */           \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MRM(0x00,    TDxx,    0x00))
+
+#define prfxx_l2(MS, DS)        /* pref load_retained, 0(TDxx) */           \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MRM(0x00,    TDxx,    0x06))
+
+#endif /* RT_BASE_COMPAT_REV >= 6, r6 */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
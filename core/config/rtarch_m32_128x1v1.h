@@ -221,6 +221,98 @@
         EMITW(0x7880001E | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selix_rr(XG, XM, XS)                                                \
+        EMITW(0x7880001E | MXM(REG(XG), REG(XS), REG(XM)))
+
+#define selix_ld(XG, XM, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7880001E | MXM(REG(XG), TmmM,    REG(XM)))
+
+#define selix3rr(XD, XM, XS, XT)                                            \
+        EMITW(0x78BE0019 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x78A0001E | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
+#define selix3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78A0001E | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splix_rr(XD, RS)                                                    \
+        EMITW(0x7B02001E | MXM(REG(XD), REG(RS), 0x00))
+
+#define splix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xC4000000 | MDM(REG(XD), MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x78700019 | MXM(REG(XD), REG(XD), 0x00))
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extix_rr(RD, XS, IS)                                                \
+        EMITW(0x78B00019 | MXM(REG(RD), REG(XS), 0x00) | (VAL(IS) & 3) << 16)
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insix_rr(XG, RS, IS)                                                \
+        EMITW(0x79300019 | MXM(REG(XG), REG(RS), 0x00) | (VAL(IS) & 3) << 16)
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#define shfix_ri(XG, IS)                                                    \
+        shfix3ri(W(XG), W(XG), W(IS))
+
+#define shfix3ri(XD, XS, IT)                                                \
+        EMITW(0x7A000002 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                                                 (0xFF & VAL(IT)) << 16)
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define iloix_rr(XG, XS)                                                    \
+        iloix3rr(W(XG), W(XG), W(XS))
+
+#define iloix_ld(XG, MS, DS)                                                \
+        iloix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloix3rr(XD, XS, XT)                                                \
+        EMITW(0x7AC00014 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define iloix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7AC00014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#define ihiix_rr(XG, XS)                                                    \
+        ihiix3rr(W(XG), W(XG), W(XS))
+
+#define ihiix_ld(XG, MS, DS)                                                \
+        ihiix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiix3rr(XD, XS, XT)                                                \
+        EMITW(0x7A400014 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define ihiix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7A400014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revix_rx(XG)                                                        \
+        revix_rr(W(XG), W(XG))
+
+#define revix_rr(XD, XS)                                                    \
+        EMITW(0x7A1B0002 | MXM(REG(XD), REG(XS), 0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -801,6 +893,22 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x78C0000E | MXM(REG(XD), REG(XS), TmmM))
 
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulix_rr(XG, XS)                                                    \
+        mulix3rr(W(XG), W(XG), W(XS))
+
+#define mulix_ld(XG, MS, DS)                                                \
+        mulix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulix3rr(XD, XS, XT)                                                \
+        EMITW(0x78400012 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78400012 | MXM(REG(XD), REG(XS), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -909,6 +1017,388 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x78C0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addgx_rr(XG, XS)                                                    \
+        addgx3rr(W(XG), W(XG), W(XS))
+
+#define addgx_ld(XG, MS, DS)                                                \
+        addgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgx3rr(XD, XS, XT)                                                \
+        EMITW(0x7820000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7820000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subgx_rr(XG, XS)                                                    \
+        subgx3rr(W(XG), W(XG), W(XS))
+
+#define subgx_ld(XG, MS, DS)                                                \
+        subgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgx3rr(XD, XS, XT)                                                \
+        EMITW(0x78A0000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78A0000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsgx_rr(XG, XS)                                                    \
+        adsgx3rr(W(XG), W(XG), W(XS))
+
+#define adsgx_ld(XG, MS, DS)                                                \
+        adsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgx3rr(XD, XS, XT)                                                \
+        EMITW(0x79A00010 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x79A00010 | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsgn_rr(XG, XS)                                                    \
+        adsgn3rr(W(XG), W(XG), W(XS))
+
+#define adsgn_ld(XG, MS, DS)                                                \
+        adsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgn3rr(XD, XS, XT)                                                \
+        EMITW(0x79200010 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x79200010 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsgx_rr(XG, XS)                                                    \
+        sbsgx3rr(W(XG), W(XG), W(XS))
+
+#define sbsgx_ld(XG, MS, DS)                                                \
+        sbsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgx3rr(XD, XS, XT)                                                \
+        EMITW(0x78A00011 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78A00011 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsgn_rr(XG, XS)                                                    \
+        sbsgn3rr(W(XG), W(XG), W(XS))
+
+#define sbsgn_ld(XG, MS, DS)                                                \
+        sbsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgn3rr(XD, XS, XT)                                                \
+        EMITW(0x78200011 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78200011 | MXM(REG(XD), REG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avggx_rr(XG, XS)                                                    \
+        avggx3rr(W(XG), W(XG), W(XS))
+
+#define avggx_ld(XG, MS, DS)                                                \
+        avggx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggx3rr(XD, XS, XT)                                                \
+        EMITW(0x7BA00010 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7BA00010 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define mingn_rr(XG, XS)                                                    \
+        mingn3rr(W(XG), W(XG), W(XS))
+
+#define mingn_ld(XG, MS, DS)                                                \
+        mingn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingn3rr(XD, XS, XT)                                                \
+        EMITW(0x7A20000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7A20000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxgn_rr(XG, XS)                                                    \
+        maxgn3rr(W(XG), W(XG), W(XS))
+
+#define maxgn_ld(XG, MS, DS)                                                \
+        maxgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgn3rr(XD, XS, XT)                                                \
+        EMITW(0x7920000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgn3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7920000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addgb_rr(XG, XS)                                                    \
+        addgb3rr(W(XG), W(XG), W(XS))
+
+#define addgb_ld(XG, MS, DS)                                                \
+        addgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgb3rr(XD, XS, XT)                                                \
+        EMITW(0x7800000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7800000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subgb_rr(XG, XS)                                                    \
+        subgb3rr(W(XG), W(XG), W(XS))
+
+#define subgb_ld(XG, MS, DS)                                                \
+        subgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgb3rr(XD, XS, XT)                                                \
+        EMITW(0x7880000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7880000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsgb_rr(XG, XS)                                                    \
+        adsgb3rr(W(XG), W(XG), W(XS))
+
+#define adsgb_ld(XG, MS, DS)                                                \
+        adsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgb3rr(XD, XS, XT)                                                \
+        EMITW(0x79800010 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x79800010 | MXM(REG(XD), REG(XS), TmmM))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsgb_rr(XG, XS)                                                    \
+        sbsgb3rr(W(XG), W(XG), W(XS))
+
+#define sbsgb_ld(XG, MS, DS)                                                \
+        sbsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgb3rr(XD, XS, XT)                                                \
+        EMITW(0x78800011 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78800011 | MXM(REG(XD), REG(XS), TmmM))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avggb_rr(XG, XS)                                                    \
+        avggb3rr(W(XG), W(XG), W(XS))
+
+#define avggb_ld(XG, MS, DS)                                                \
+        avggb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggb3rr(XD, XS, XT)                                                \
+        EMITW(0x7B800010 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7B800010 | MXM(REG(XD), REG(XS), TmmM))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define mingb_rr(XG, XS)                                                    \
+        mingb3rr(W(XG), W(XG), W(XS))
+
+#define mingb_ld(XG, MS, DS)                                                \
+        mingb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingb3rr(XD, XS, XT)                                                \
+        EMITW(0x7A80000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7A80000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxgb_rr(XG, XS)                                                    \
+        maxgb3rr(W(XG), W(XG), W(XS))
+
+#define maxgb_ld(XG, MS, DS)                                                \
+        maxgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgb3rr(XD, XS, XT)                                                \
+        EMITW(0x7980000E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7980000E | MXM(REG(XD), REG(XS), TmmM))
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvlgx_rr(XD, XS)                                                    \
+        EMITW(0x7A800014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x79680009 | MXM(REG(XD), REG(XD), 0x00))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvlgx_rr(XD, XS)                                                    \
+        EMITW(0x7A800014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x79680009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x7A4E0002 | MXM(REG(XD), REG(XD), 0x00))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvlgn_rr(XD, XS)                                                    \
+        EMITW(0x7A800014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x78E80009 | MXM(REG(XD), REG(XD), 0x00))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvlgn_rr(XD, XS)                                                    \
+        EMITW(0x7A800014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x78E80009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x7A4E0002 | MXM(REG(XD), REG(XD), 0x00))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvhgx_rr(XD, XS)                                                    \
+        EMITW(0x7A000014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x79680009 | MXM(REG(XD), REG(XD), 0x00))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvhgx_rr(XD, XS)                                                    \
+        EMITW(0x7A000014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x79680009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x7A4E0002 | MXM(REG(XD), REG(XD), 0x00))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvhgn_rr(XD, XS)                                                    \
+        EMITW(0x7A000014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x78E80009 | MXM(REG(XD), REG(XD), 0x00))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvhgn_rr(XD, XS)                                                    \
+        EMITW(0x7A000014 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x78E80009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x7A4E0002 | MXM(REG(XD), REG(XD), 0x00))
+
+#endif /* RT_ENDIAN == 1 */
+
+#if RT_ENDIAN == 0
+
+#define cvxgb_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x79200006 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78E7000A | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200006 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x78E7000A | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x79000014 | MXM(REG(XG), TmmM,    REG(XG)))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvxgb_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x79200006 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78E7000A | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200006 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x78E7000A | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x79000014 | MXM(REG(XG), TmmM,    REG(XG)))                  \
+        EMITW(0x7AB10002 | MXM(REG(XG), REG(XG), 0x00))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#if RT_ENDIAN == 0
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        EMITW(0x79200006 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x78E7000A | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200006 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x78E7000A | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x79000014 | MXM(REG(XD), TmmM,    REG(XD)))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        EMITW(0x79200006 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x78E7000A | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200006 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x78E7000A | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x79000014 | MXM(REG(XD), TmmM,    REG(XD)))                  \
+        EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00))
+
+#endif /* RT_ENDIAN == 1 */
+
 /************************   helper macros (FPU mode)   ************************/
 
 /* simd mode
@@ -133,6 +133,98 @@
         EMITW(0x7880001E | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define seljx_rr(XG, XM, XS)                                                \
+        EMITW(0x7880001E | MXM(REG(XG), REG(XS), REG(XM)))
+
+#define seljx_ld(XG, XM, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7880001E | MXM(REG(XG), TmmM,    REG(XM)))
+
+#define seljx3rr(XD, XM, XS, XT)                                            \
+        EMITW(0x78BE0019 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x78A0001E | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
+#define seljx3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78A0001E | MXM(TmmM,    REG(XS), REG(XM)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define spljx_rr(XD, RS)                                                    \
+        EMITW(0x7B03001E | MXM(REG(XD), REG(RS), 0x00))
+
+#define spljx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xD4000000 | MDM(REG(XD), MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x78780019 | MXM(REG(XD), REG(XD), 0x00))
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extjx_rr(RD, XS, IS)                                                \
+        EMITW(0x78B80019 | MXM(REG(RD), REG(XS), 0x00) | (VAL(IS) & 1) << 16)
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insjx_rr(XG, RS, IS)                                                \
+        EMITW(0x79380019 | MXM(REG(XG), REG(RS), 0x00) | (VAL(IS) & 1) << 16)
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfjx_ri(XG, IS)                                                    \
+        shfjx3ri(W(XG), W(XG), W(IS))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+        EMITW(0x7A440002 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                    (VAL(IT) & 1) * 0x0A0000 | (VAL(IT) & 2) * 0x500000)
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilojx_rr(XG, XS)                                                    \
+        ilojx3rr(W(XG), W(XG), W(XS))
+
+#define ilojx_ld(XG, MS, DS)                                                \
+        ilojx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ilojx3rr(XD, XS, XT)                                                \
+        EMITW(0x7AE00014 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define ilojx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7AE00014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihijx_rr(XG, XS)                                                    \
+        ihijx3rr(W(XG), W(XG), W(XS))
+
+#define ihijx_ld(XG, MS, DS)                                                \
+        ihijx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihijx3rr(XD, XS, XT)                                                \
+        EMITW(0x7A600014 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define ihijx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7A600014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revjx_rx(XG)                                                        \
+        revjx_rr(W(XG), W(XG))
+
+#define revjx_rr(XD, XS)                                                    \
+        EMITW(0x7A4E0002 | MXM(REG(XD), REG(XS), 0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -679,6 +771,27 @@
         cvtjs_rr(W(XD), W(XS))                                              \
         FCTRL_LEAVE(mode)
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvljs_rr(XD, XS)                                                    \
+        EMITW(0x7B33001E | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhjs_rr(XD, XS)                                                    \
+        EMITW(0x7B31001E | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsis_rr(XD, XS, XT)                                                \
+        EMITW(0x7A20001B | MXM(REG(XD), REG(XT), REG(XS)))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -713,6 +826,22 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x78E0000E | MXM(REG(XD), REG(XS), TmmM))
 
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define muljx_rr(XG, XS)                                                    \
+        muljx3rr(W(XG), W(XG), W(XS))
+
+#define muljx_ld(XG, MS, DS)                                                \
+        muljx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define muljx3rr(XD, XS, XT)                                                \
+        EMITW(0x78600012 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define muljx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x78600012 | MXM(REG(XD), REG(XS), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -788,6 +788,31 @@
         cvtds_rr(W(XD), W(XS))                                              \
         FCTRL_LEAVE(mode)
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlds_rr(XD, XS)                                                    \
+        EMITW(0x7B31001E | MXM(RYG(XD), REG(XS), 0x00))                     \
+        EMITW(0x7B33001E | MXM(REG(XD), REG(XS), 0x00))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhds_rr(XD, XS)                                                    \
+        EMITW(0x7B33001E | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x7B31001E | MXM(RYG(XD), RYG(XS), 0x00))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvscs_rr(XD, XS, XT)                                                \
+        EMITW(0x7A20001B | MXM(TmmM,    RYG(XS), REG(XS)))                  \
+        EMITW(0x7A20001B | MXM(RYG(XD), RYG(XT), REG(XT)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
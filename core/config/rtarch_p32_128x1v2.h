@@ -225,6 +225,27 @@
         EMITW(0x7C000719 | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))   \
                                                        /* ^ == -1 if true */
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selix_rr(XG, XM, XS)                                                \
+        EMITW(0xF000003F | MXM(REG(XG), REG(XG), REG(XS)) | REG(XM) << 6)
+
+#define selix_ld(XG, XM, MS, DS)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0xF000003F | MXM(REG(XG), REG(XG), TmmM) | REG(XM) << 6)
+
+#define selix3rr(XD, XM, XS, XT)                                            \
+        EMITW(0xF000003F | MXM(REG(XD), REG(XS), REG(XT)) | REG(XM) << 6)
+
+#define selix3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0xF000003F | MXM(REG(XD), REG(XS), TmmM) | REG(XM) << 6)
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -505,6 +526,44 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed single-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1] + S[2] + S[3]), result in lowest element of D */
+
+#define adhis_rr(XD, XS)                                                    \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000207 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000207 | MXM(REG(XD), REG(XD), TmmM))
+
+#define adhis_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        adhis_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mnhis_rr(XD, XS)                                                    \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000647 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000647 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mnhis_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        mnhis_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mxhis_rr(XD, XS)                                                    \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000607 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000607 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mxhis_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        mxhis_rr(W(XD), W(XD))
+
 /*************   packed single-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -851,6 +910,27 @@
         EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000480 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
 
+#if (RT_128X1 >= 2)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulix_rr(XG, XS)                                                    \
+        mulix3rr(W(XG), W(XG), W(XS))
+
+#define mulix_ld(XG, MS, DS)                                                \
+        mulix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulix3rr(XD, XS, XT)                                                \
+        EMITW(0x10000089 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mulix3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000089 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+#endif /* RT_128X1 >= 2 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -1004,6 +1084,404 @@
         EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000384 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
 
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addgx_rr(XG, XS)                                                    \
+        addgx3rr(W(XG), W(XG), W(XS))
+
+#define addgx_ld(XG, MS, DS)                                                \
+        addgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000040 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000040 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subgx_rr(XG, XS)                                                    \
+        subgx3rr(W(XG), W(XG), W(XS))
+
+#define subgx_ld(XG, MS, DS)                                                \
+        subgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000440 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000440 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsgx_rr(XG, XS)                                                    \
+        adsgx3rr(W(XG), W(XG), W(XS))
+
+#define adsgx_ld(XG, MS, DS)                                                \
+        adsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000240 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000240 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsgn_rr(XG, XS)                                                    \
+        adsgn3rr(W(XG), W(XG), W(XS))
+
+#define adsgn_ld(XG, MS, DS)                                                \
+        adsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000340 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000340 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsgx_rr(XG, XS)                                                    \
+        sbsgx3rr(W(XG), W(XG), W(XS))
+
+#define sbsgx_ld(XG, MS, DS)                                                \
+        sbsgx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000640 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000640 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsgn_rr(XG, XS)                                                    \
+        sbsgn3rr(W(XG), W(XG), W(XS))
+
+#define sbsgn_ld(XG, MS, DS)                                                \
+        sbsgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000740 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgn3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000740 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avggx_rr(XG, XS)                                                    \
+        avggx3rr(W(XG), W(XG), W(XS))
+
+#define avggx_ld(XG, MS, DS)                                                \
+        avggx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000442 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000442 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define mingn_rr(XG, XS)                                                    \
+        mingn3rr(W(XG), W(XG), W(XS))
+
+#define mingn_ld(XG, MS, DS)                                                \
+        mingn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000342 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingn3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000342 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxgn_rr(XG, XS)                                                    \
+        maxgn3rr(W(XG), W(XG), W(XS))
+
+#define maxgn_ld(XG, MS, DS)                                                \
+        maxgn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgn3rr(XD, XS, XT)                                                \
+        EMITW(0x10000142 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgn3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000142 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addgb_rr(XG, XS)                                                    \
+        addgb3rr(W(XG), W(XG), W(XS))
+
+#define addgb_ld(XG, MS, DS)                                                \
+        addgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addgb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000000 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define addgb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000000 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subgb_rr(XG, XS)                                                    \
+        subgb3rr(W(XG), W(XG), W(XS))
+
+#define subgb_ld(XG, MS, DS)                                                \
+        subgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subgb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define subgb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000400 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsgb_rr(XG, XS)                                                    \
+        adsgb3rr(W(XG), W(XG), W(XS))
+
+#define adsgb_ld(XG, MS, DS)                                                \
+        adsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsgb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000200 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define adsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000200 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsgb_rr(XG, XS)                                                    \
+        sbsgb3rr(W(XG), W(XG), W(XS))
+
+#define sbsgb_ld(XG, MS, DS)                                                \
+        sbsgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsgb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000600 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define sbsgb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000600 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avggb_rr(XG, XS)                                                    \
+        avggb3rr(W(XG), W(XG), W(XS))
+
+#define avggb_ld(XG, MS, DS)                                                \
+        avggb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avggb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000402 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define avggb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000402 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define mingb_rr(XG, XS)                                                    \
+        mingb3rr(W(XG), W(XG), W(XS))
+
+#define mingb_ld(XG, MS, DS)                                                \
+        mingb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mingb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000202 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mingb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000202 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxgb_rr(XG, XS)                                                    \
+        maxgb3rr(W(XG), W(XG), W(XS))
+
+#define maxgb_ld(XG, MS, DS)                                                \
+        maxgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxgb3rr(XD, XS, XT)                                                \
+        EMITW(0x10000002 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define maxgb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000002 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvlgx_rr(XD, XS)                                                    \
+        EMITW(0x1000038C | MXM(TmmM,    0x10,    0x00))                     \
+        EMITW(0x10000084 | MXM(TmmM,    REG(XS), TmmM))                     \
+        EMITW(0x1000000C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000244 | MXM(REG(XD), REG(XD), TmmM))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvlgx_rr(XD, XS)                                                    \
+        EMITW(0x1000000C | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000244 | MXM(REG(XD), REG(XD), TmmM))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvlgn_rr(XD, XS)                                                    \
+        EMITW(0x1000038C | MXM(TmmM,    0x10,    0x00))                     \
+        EMITW(0x10000084 | MXM(TmmM,    REG(XS), TmmM))                     \
+        EMITW(0x1000000C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000344 | MXM(REG(XD), REG(XD), TmmM))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvlgn_rr(XD, XS)                                                    \
+        EMITW(0x1000000C | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000344 | MXM(REG(XD), REG(XD), TmmM))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvhgx_rr(XD, XS)                                                    \
+        EMITW(0x1000038C | MXM(TmmM,    0x10,    0x00))                     \
+        EMITW(0x10000084 | MXM(TmmM,    REG(XS), TmmM))                     \
+        EMITW(0x1000010C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000244 | MXM(REG(XD), REG(XD), TmmM))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvhgx_rr(XD, XS)                                                    \
+        EMITW(0x1000010C | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000244 | MXM(REG(XD), REG(XD), TmmM))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#if RT_ENDIAN == 0
+
+#define cvhgn_rr(XD, XS)                                                    \
+        EMITW(0x1000038C | MXM(TmmM,    0x10,    0x00))                     \
+        EMITW(0x10000084 | MXM(TmmM,    REG(XS), TmmM))                     \
+        EMITW(0x1000010C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000344 | MXM(REG(XD), REG(XD), TmmM))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvhgn_rr(XD, XS)                                                    \
+        EMITW(0x1000010C | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x1000034C | MXM(TmmM,    0x08,    0x00))                     \
+        EMITW(0x10000344 | MXM(REG(XD), REG(XD), TmmM))
+
+#endif /* RT_ENDIAN == 1 */
+
+#if RT_ENDIAN == 0
+
+#define cvxgb_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000010E | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x1000038C | MXM(TmmM,    0x10,    0x00))                     \
+        EMITW(0x10000084 | MXM(REG(XG), REG(XG), TmmM))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvxgb_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000010E | MXM(REG(XG), REG(XG), TmmM))
+
+#endif /* RT_ENDIAN == 1 */
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#if RT_ENDIAN == 0
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        EMITW(0x1000010E | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x1000038C | MXM(TmmM,    0x10,    0x00))                     \
+        EMITW(0x10000084 | MXM(REG(XD), REG(XD), TmmM))
+
+#else /* RT_ENDIAN == 1 */
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        EMITW(0x1000010E | MXM(REG(XD), REG(XS), REG(XT)))
+
+#endif /* RT_ENDIAN == 1 */
+
 /************************   helper macros (FPU mode)   ************************/
 
 /* simd mode
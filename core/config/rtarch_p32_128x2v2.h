@@ -523,6 +523,47 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed single-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1] + ... + S[7]), result in lowest element of D */
+
+#define adhcs_rr(XD, XS)                                                    \
+        EMITW(0xF0000207 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000207 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000207 | MXM(REG(XD), REG(XD), TmmM))
+
+#define adhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        adhcs_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1], ..., S[7])), result in lowest element of D */
+
+#define mnhcs_rr(XD, XS)                                                    \
+        EMITW(0xF0000647 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000647 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000647 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mnhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhcs_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1], ..., S[7])), result in lowest element of D */
+
+#define mxhcs_rr(XD, XS)                                                    \
+        EMITW(0xF0000607 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000607 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000607 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mxhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhcs_rr(W(XD), W(XD))
+
 /*************   packed single-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -1138,6 +1179,429 @@
         EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000384 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
 
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addax_rr(XG, XS)                                                    \
+        addax3rr(W(XG), W(XG), W(XS))
+
+#define addax_ld(XG, MS, DS)                                                \
+        addax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000040 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000040 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define addax3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000040 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000040 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subax_rr(XG, XS)                                                    \
+        subax3rr(W(XG), W(XG), W(XS))
+
+#define subax_ld(XG, MS, DS)                                                \
+        subax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000440 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000440 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define subax3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000440 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000440 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsax_rr(XG, XS)                                                    \
+        adsax3rr(W(XG), W(XG), W(XS))
+
+#define adsax_ld(XG, MS, DS)                                                \
+        adsax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000240 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000240 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define adsax3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000240 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000240 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsan_rr(XG, XS)                                                    \
+        adsan3rr(W(XG), W(XG), W(XS))
+
+#define adsan_ld(XG, MS, DS)                                                \
+        adsan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsan3rr(XD, XS, XT)                                                \
+        EMITW(0x10000340 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000340 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define adsan3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000340 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000340 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsax_rr(XG, XS)                                                    \
+        sbsax3rr(W(XG), W(XG), W(XS))
+
+#define sbsax_ld(XG, MS, DS)                                                \
+        sbsax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000640 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000640 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define sbsax3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000640 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000640 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsan_rr(XG, XS)                                                    \
+        sbsan3rr(W(XG), W(XG), W(XS))
+
+#define sbsan_ld(XG, MS, DS)                                                \
+        sbsan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsan3rr(XD, XS, XT)                                                \
+        EMITW(0x10000740 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000740 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define sbsan3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000740 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000740 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avgax_rr(XG, XS)                                                    \
+        avgax3rr(W(XG), W(XG), W(XS))
+
+#define avgax_ld(XG, MS, DS)                                                \
+        avgax3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgax3rr(XD, XS, XT)                                                \
+        EMITW(0x10000442 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000442 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define avgax3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000442 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000442 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minan_rr(XG, XS)                                                    \
+        minan3rr(W(XG), W(XG), W(XS))
+
+#define minan_ld(XG, MS, DS)                                                \
+        minan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minan3rr(XD, XS, XT)                                                \
+        EMITW(0x10000342 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000342 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define minan3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000342 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000342 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxan_rr(XG, XS)                                                    \
+        maxan3rr(W(XG), W(XG), W(XS))
+
+#define maxan_ld(XG, MS, DS)                                                \
+        maxan3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxan3rr(XD, XS, XT)                                                \
+        EMITW(0x10000142 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000142 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define maxan3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000142 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000142 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addab_rr(XG, XS)                                                    \
+        addab3rr(W(XG), W(XG), W(XS))
+
+#define addab_ld(XG, MS, DS)                                                \
+        addab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000000 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000000 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define addab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000000 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000000 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subab_rr(XG, XS)                                                    \
+        subab3rr(W(XG), W(XG), W(XS))
+
+#define subab_ld(XG, MS, DS)                                                \
+        subab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000400 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000400 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define subab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000400 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000400 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsab_rr(XG, XS)                                                    \
+        adsab3rr(W(XG), W(XG), W(XS))
+
+#define adsab_ld(XG, MS, DS)                                                \
+        adsab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000200 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000200 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define adsab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000200 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000200 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsab_rr(XG, XS)                                                    \
+        sbsab3rr(W(XG), W(XG), W(XS))
+
+#define sbsab_ld(XG, MS, DS)                                                \
+        sbsab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000600 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000600 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define sbsab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000600 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000600 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avgab_rr(XG, XS)                                                    \
+        avgab3rr(W(XG), W(XG), W(XS))
+
+#define avgab_ld(XG, MS, DS)                                                \
+        avgab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000402 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000402 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define avgab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000402 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000402 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define minab_rr(XG, XS)                                                    \
+        minab3rr(W(XG), W(XG), W(XS))
+
+#define minab_ld(XG, MS, DS)                                                \
+        minab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000202 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000202 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define minab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000202 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000202 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxab_rr(XG, XS)                                                    \
+        maxab3rr(W(XG), W(XG), W(XS))
+
+#define maxab_ld(XG, MS, DS)                                                \
+        maxab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxab3rr(XD, XS, XT)                                                \
+        EMITW(0x10000002 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000002 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#define maxab3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000002 | MXM(REG(XD), REG(XS), TmmM))/* ^ == -1 if true */\
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VYL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VYL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000002 | MXM(RYG(XD), RYG(XS), TmmM))/* ^ == -1 if true */
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlax_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvlgx_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvhgx_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlan_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvlgn_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvhgn_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhax_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        cvlgx_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        cvhgx_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhan_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        cvlgn_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        cvhgn_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsab_rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxgb_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        cvxgb_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
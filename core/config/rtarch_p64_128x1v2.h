@@ -140,6 +140,27 @@
         EMITW(0x7C000799 | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))   \
                                                        /* ^ == -1 if true */
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define seljx_rr(XG, XM, XS)                                                \
+        EMITW(0xF000003F | MXM(REG(XG), REG(XG), REG(XS)) | REG(XM) << 6)
+
+#define seljx_ld(XG, XM, MS, DS)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000699 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0xF000003F | MXM(REG(XG), REG(XG), TmmM) | REG(XM) << 6)
+
+#define seljx3rr(XD, XM, XS, XT)                                            \
+        EMITW(0xF000003F | MXM(REG(XD), REG(XS), REG(XT)) | REG(XM) << 6)
+
+#define seljx3ld(XD, XM, XS, MT, DT)                                        \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000699 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0xF000003F | MXM(REG(XD), REG(XS), TmmM) | REG(XM) << 6)
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -418,6 +439,38 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed double-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1]), result in lowest element of D */
+
+#define adhjs_rr(XD, XS)                                                    \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000307 | MXM(REG(XD), REG(XS), TmmM))
+
+#define adhjs_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        adhjs_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1])), result in lowest element of D */
+
+#define mnhjs_rr(XD, XS)                                                    \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000747 | MXM(REG(XD), REG(XS), TmmM))
+
+#define mnhjs_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhjs_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1])), result in lowest element of D */
+
+#define mxhjs_rr(XD, XS)                                                    \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000707 | MXM(REG(XD), REG(XS), TmmM))
+
+#define mxhjs_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhjs_rr(W(XD), W(XD))
+
 /*************   packed double-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -729,6 +782,56 @@
         rnrjs_rr(W(XD), W(XS), mode)                                        \
         cvzjs_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvljs_rr(XD, XS)                                                    \
+        EMITW(0xF0000097 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhjs_rr(XD, XS)                                                    \
+        EMITW(0xF0000197 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#if (RT_128X1 < 2)
+
+#define cvsis_rr(XD, XS, XT)                                                \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x04))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x0C))                              \
+        stack_ld(Reax)                                                      \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_128X1 >= 2 */
+
+#define cvsis_rr(XD, XS, XT)                                                \
+        EMITW(0xF0000057 | MXM(TmmM,    REG(XS), REG(XT)))                  \
+        EMITW(0xF0000627 | MXM(TmmM,    0x00,    TmmM))                     \
+        EMITW(0xF0000357 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0x1000078C | MXM(REG(XD), TmmM,    REG(XD)))
+
+#endif /* RT_128X1 >= 2 */
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_128X1 < 2)
@@ -497,6 +497,41 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/*************   packed double-precision horizontal reductions   **************/
+
+/* adh (D = S[0] + S[1] + S[2] + S[3]), result in lowest element of D */
+
+#define adhds_rr(XD, XS)                                                    \
+        EMITW(0xF0000307 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000307 | MXM(REG(XD), REG(XD), TmmM))
+
+#define adhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        adhds_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mnhds_rr(XD, XS)                                                    \
+        EMITW(0xF0000747 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000747 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mnhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhds_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], S[1], S[2], S[3])), result in lowest element of D */
+
+#define mxhds_rr(XD, XS)                                                    \
+        EMITW(0xF0000707 | MXM(REG(XD), REG(XS), RYG(XS)))                  \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0xF0000707 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mxhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhds_rr(W(XD), W(XD))
+
 /*************   packed double-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -888,6 +923,57 @@
         rnrds_rr(W(XD), W(XS), mode)                                        \
         cvzds_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlds_rr(XD, XS)                                                    \
+        EMITW(0xF0000197 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(RYG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000097 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhds_rr(XD, XS)                                                    \
+        EMITW(0xF0000097 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000197 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0xF0000727 | MXM(RYG(XD), 0x00,    TmmM))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvscs_rr(XD, XS, XT)                                                \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        EMITW(0xF0000627 | MXM(RYG(XD), 0x00,    RYG(XS)))                  \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0xF0000627 | MXM(RYG(XD), 0x00,    RYG(XD)))                  \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x04))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x10))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x18))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x0C))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x10))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x14))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x10))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x18))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x18))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x1C))                              \
+        stack_ld(Reax)                                                      \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_128X2 < 2)
@@ -890,6 +890,57 @@
         rnrds_rr(W(XD), W(XS), mode)                                        \
         cvzds_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlds_rr(XD, XS)                                                    \
+        EMITW(0xF0000197 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000726 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000097 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhds_rr(XD, XS)                                                    \
+        EMITW(0xF0000091 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000191 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000726 | MXM(REG(XD), 0x00,    TmmM))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvscs_rr(XD, XS, XT)                                                \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        EMITW(0xF0000624 | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0xF0000624 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x04))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x10))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x18))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x0C))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x10))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x14))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x10))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x18))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x18))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x1C))                              \
+        stack_ld(Reax)                                                      \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_128X2 < 8)
@@ -1206,6 +1206,85 @@
         rnrqs_rr(W(XD), W(XS), mode)                                        \
         cvzqs_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        EMITW(0xF0000197 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0xF0000726 | MXM(RYG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000097 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0xF0000726 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000197 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(RYG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000097 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhqs_rr(XD, XS)                                                    \
+        EMITW(0xF0000091 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000191 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0xF0000727 | MXM(RYG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000091 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0xF0000726 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF0000191 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0xF0000726 | MXM(RYG(XD), 0x00,    TmmM))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        EMITW(0xF0000627 | MXM(RYG(XD), 0x00,    RYG(XS)))                  \
+        EMITW(0xF0000624 | MXM(REG(XD), 0x00,    REG(XS)))                  \
+        EMITW(0xF0000624 | MXM(RYG(XD), 0x00,    RYG(XS)))                  \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        EMITW(0xF0000627 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0xF0000627 | MXM(RYG(XD), 0x00,    RYG(XD)))                  \
+        EMITW(0xF0000624 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0xF0000624 | MXM(RYG(XD), 0x00,    RYG(XD)))                  \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x04))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x10))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x18))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x0C))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x20))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x10))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x28))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x14))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x30))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x18))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x38))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x1C))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x20))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x08))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x24))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x10))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x28))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x18))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x2C))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x20))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x30))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x28))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x34))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x30))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x38))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x38))                              \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x3C))                              \
+        stack_ld(Reax)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_128X4 < 2)
@@ -182,6 +182,20 @@
         EMITB(0x00 | (1 - (rxg)) << 7 | 1 << 6 | (1 - (rxm)) << 5 | (aux))  \
         EMITB(0x80 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
 
+/* 3-byte VEX prefix with VSIB index-extension (W0) */
+#define VSX(rxg, rxi, rxm, ren, len, pfx, aux)                              \
+        EMITB(0xC4)                                                         \
+        EMITB(0x00 | (1 - (rxg)) << 7 | (1 - (rxi)) << 6 | (1 - (rxm)) << 5 \
+                   | (aux))                                                 \
+        EMITB(0x00 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
+
+/* 3-byte VEX prefix with VSIB index-extension (W1) */
+#define VSW(rxg, rxi, rxm, ren, len, pfx, aux)                              \
+        EMITB(0xC4)                                                         \
+        EMITB(0x00 | (1 - (rxg)) << 7 | (1 - (rxi)) << 6 | (1 - (rxm)) << 5 \
+                   | (aux))                                                 \
+        EMITB(0x80 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
+
 /* 4-byte EVEX prefix with full customization (W0, K0) */
 #define EVX(rxg, rxm, ren, len, pfx, aux)                                   \
         EMITB(0x62)                                                         \
@@ -1486,6 +1500,16 @@
 #define cpuid_xx() /* destroys Reax, Recx, Rebx, Redx, reads Reax, Recx */  \
         EMITB(0x0F) EMITB(0xA2)     /* not portable, do not use outside */
 
+/* pcn (D = population count of S), popcnt is available on all AVX targets */
+
+#define pcnwx_rr(RD, RS)     /* not portable, do not use outside */         \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define pcnzx_rr(RD, RS)     /* not portable, do not use outside */         \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
 #define verxx_xx() /* destroys Reax, Recx, Rebx, Redx, Resi, Redi */        \
         /* request cpuid:eax=1 */                                           \
         movwx_ri(Reax, IB(1))                                               \
@@ -1579,6 +1603,20 @@
 
      /* adrpx_ld(RD, MS, DS) in 32-bit rtarch_***_***.h files, SIMD-aligned */
 
+/* prf (prefetch line at S into L1/L2 data-cache)
+ * set-flags: no
+ * hint only, doesn't fault on invalid addresses, may be ignored by the core */
+
+#define prfxx_l1(MS, DS)                                                    \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(0x01,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define prfxx_l2(MS, DS)                                                    \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(0x02,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1617,6 +1655,52 @@
 
 #endif /* defined (RT_X32, RT_X64) */
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        code_jump(__Code__, #lb, 0xEB); /* jmp */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        code_jump(__Code__, #lb, 0x74); /* jz */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        code_jump(__Code__, #lb, 0x75); /* jnz */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x74); /* je */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x75); /* jne */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x72); /* jb */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x76); /* jbe */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x77); /* ja */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x73); /* jae */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7C); /* jl */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7E); /* jle */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7F); /* jg */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7D); /* jge */
+
+#define LBL(lb)                                          /* code label */   \
+        code_label(__Code__, #lb);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(jmp, lb) ASM_END
 
@@ -1659,6 +1743,8 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
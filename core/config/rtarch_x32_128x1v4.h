@@ -168,6 +168,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mov (D = S) non-temporal (streaming) store, bypasses caches
+ * destination must be SIMD-aligned, weakly-ordered with regular stores */
+
+#define movix_nt(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
 
@@ -204,6 +212,100 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         orrix_rr(Xmm0, W(XS))                                               \
         movix_st(Xmm0, W(MG), W(DG))
 
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splix_rr(XD, RS)                                                    \
+    ESC REX(RXB(XD), RXB(RS)) EMITB(0x0F) EMITB(0x6E)                       \
+        MRM(REG(XD), MOD(RS), REG(RS))                                      \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
+#define splix_ld(XD, MS, DS)                                                \
+ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x6E)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extix_rr(RD, XS, IS)                                                \
+    ESC REX(RXB(XS), RXB(RD)) EMITB(0x0F) EMITB(0x3A) EMITB(0x16)           \
+        MRM(REG(XS), MOD(RD), REG(RD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x03))
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insix_rr(XG, RS, IS)                                                \
+    ESC REX(RXB(XG), RXB(RS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x22)           \
+        MRM(REG(XG), MOD(RS), REG(RS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x03))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#define shfix_ri(XG, IS)                                                    \
+        shfix3ri(W(XG), W(XG), W(IS))
+
+#define shfix3ri(XD, XS, IT)                                                \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define iloix_rr(XG, XS)                                                    \
+        REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define iloix_ld(XG, MS, DS)                                                \
+    ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define iloix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        iloix_rr(W(XD), W(XT))
+
+#define iloix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        iloix_ld(W(XD), W(MT), W(DT))
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#define ihiix_rr(XG, XS)                                                    \
+        REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ihiix_ld(XG, MS, DS)                                                \
+    ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ihiix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        ihiix_rr(W(XD), W(XT))
+
+#define ihiix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        ihiix_ld(W(XD), W(MT), W(DT))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revix_rx(XG)                                                        \
+        revix_rr(W(XG), W(XG))
+
+#define revix_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -451,6 +553,24 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         /* rsq defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#define cvyis_rr(XD, XS)     /* not portable, do not use outside */         \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyis_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvxjs_rr(XD, XS)     /* not portable, do not use outside */         \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define prmix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
 #if RT_SIMD_COMPAT_FMA == 0
 
 /* fma (G = G + S * T) if (#G != #S && #G != #T)
@@ -473,7 +593,10 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
 
 /* fma (G = G + S * T) if (#G != #S && #G != #T)
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured,
+ * RT_SIMD_COMPAT_FMR == 2 selects faster fp64 SIMD fallbacks (current mode),
+ * both round the sum twice (to 64/53-bit, then to fp32), which may differ
+ * from fused result in the last bit, with fp64 more often than with x87 */
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -517,6 +640,57 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         movwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
         fpucw_ld(Mebp,  inf_SCR02(0))
 
+#elif RT_SIMD_COMPAT_FMR == 2
+
+#define fmais_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvyis_rr(W(XG), W(XT))                     /* 1st-pass -> */        \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_rr(W(XG), W(XS))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x00))                              \
+        addjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x00))     /* 1st-pass <- */        \
+        prmix_rr(W(XG), W(XT), IB(0x4E))           /* 2nd-pass -> */        \
+        cvyis_rr(W(XG), W(XG))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        prmix_rr(W(XG), W(XS), IB(0x4E))                                    \
+        cvyis_rr(W(XG), W(XG))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x08))                              \
+        addjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x08))     /* 2nd-pass <- */        \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define fmais_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvyis_ld(W(XG), W(MT), W(DT))              /* 1st-pass -> */        \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_rr(W(XG), W(XS))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x00))                              \
+        addjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x00))     /* 1st-pass <- */        \
+        movix_ld(W(XG), W(MT), W(DT))              /* 2nd-pass -> */        \
+        prmix_rr(W(XG), W(XG), IB(0x4E))                                    \
+        cvyis_rr(W(XG), W(XG))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        prmix_rr(W(XG), W(XS), IB(0x4E))                                    \
+        cvyis_rr(W(XG), W(XG))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x08))                              \
+        addjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x08))     /* 2nd-pass <- */        \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
 #endif /* RT_SIMD_COMPAT_FMR */
 
 #define fmais_rx(XG) /* not portable, do not use outside */                 \
@@ -607,6 +781,57 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         movwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
         fpucw_ld(Mebp,  inf_SCR02(0))
 
+#elif RT_SIMD_COMPAT_FMR == 2
+
+#define fmsis_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvyis_rr(W(XG), W(XT))                     /* 1st-pass -> */        \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_rr(W(XG), W(XS))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x00))                              \
+        subjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x00))     /* 1st-pass <- */        \
+        prmix_rr(W(XG), W(XT), IB(0x4E))           /* 2nd-pass -> */        \
+        cvyis_rr(W(XG), W(XG))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        prmix_rr(W(XG), W(XS), IB(0x4E))                                    \
+        cvyis_rr(W(XG), W(XG))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x08))                              \
+        subjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x08))     /* 2nd-pass <- */        \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define fmsis_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvyis_ld(W(XG), W(MT), W(DT))              /* 1st-pass -> */        \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_rr(W(XG), W(XS))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x00))                              \
+        subjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x00))     /* 1st-pass <- */        \
+        movix_ld(W(XG), W(MT), W(DT))              /* 2nd-pass -> */        \
+        prmix_rr(W(XG), W(XG), IB(0x4E))                                    \
+        cvyis_rr(W(XG), W(XG))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        prmix_rr(W(XG), W(XS), IB(0x4E))                                    \
+        cvyis_rr(W(XG), W(XG))                                              \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyis_ld(W(XG), Mebp, inf_SCR01(0x08))                              \
+        subjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XG))                                              \
+        movts_st(W(XG), Mebp, inf_SCR01(0x08))     /* 2nd-pass <- */        \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
 #endif /* RT_SIMD_COMPAT_FMR */
 
 #define fmsis_rx(XG) /* not portable, do not use outside */                 \
@@ -629,6 +854,161 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         fpuws_st(Mebp,  inf_SCR02(0x00))                                    \
         movix_ld(W(XG), Mebp, inf_SCR02(0))
 
+#endif /* RT_SIMD_COMPAT_FMS */
+#if RT_SIMD_COMPAT_FMA == 0
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmars_rr(XG, XS, XT)                                                \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_rr(W(XS), W(XT))                                              \
+        addrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmars_ld(XG, XS, MT, DT)                                            \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_ld(W(XS), W(MT), W(DT))                                       \
+        addrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#elif RT_SIMD_COMPAT_FMA == 1
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMR == 0
+
+#define fmars_rr(XG, XS, XT)                                                \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        fmars_rx(W(XG))
+
+#define fmars_ld(XG, XS, MT, DT)                                            \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_ld(W(XS), W(MT), W(DT))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        fmars_rx(W(XG))
+
+#elif RT_SIMD_COMPAT_FMR >= 1
+
+#define fmars_rr(XG, XS, XT)                                                \
+        mxcsr_st(Mebp,  inf_SCR02(0))                                       \
+        shrwx_mi(Mebp,  inf_SCR02(0), IB(3))                                \
+        andwx_mi(Mebp,  inf_SCR02(0), IH(0x0C00))                           \
+        orrwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        fmars_rx(W(XG))                                                     \
+        movwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))
+
+#define fmars_ld(XG, XS, MT, DT)                                            \
+        mxcsr_st(Mebp,  inf_SCR02(0))                                       \
+        shrwx_mi(Mebp,  inf_SCR02(0), IB(3))                                \
+        andwx_mi(Mebp,  inf_SCR02(0), IH(0x0C00))                           \
+        orrwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_ld(W(XS), W(MT), W(DT))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        fmars_rx(W(XG))                                                     \
+        movwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_FMR */
+
+#define fmars_rx(XG) /* not portable, do not use outside */                 \
+        fpuws_ld(Mebp,  inf_SCR01(0x00))                                    \
+        mulws_ld(Mebp,  inf_SCR02(0x00))                                    \
+        movrs_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        addws_ld(Mebp,  inf_SCR02(0x00))                                    \
+        fpuws_st(Mebp,  inf_SCR02(0x00))                                    \
+        movrs_ld(W(XG), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+#if RT_SIMD_COMPAT_FMS == 0
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#define fmsrs_rr(XG, XS, XT)                                                \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_rr(W(XS), W(XT))                                              \
+        subrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsrs_ld(XG, XS, MT, DT)                                            \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_ld(W(XS), W(MT), W(DT))                                       \
+        subrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#elif RT_SIMD_COMPAT_FMS == 1
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMR == 0
+
+#define fmsrs_rr(XG, XS, XT)                                                \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        fmsrs_rx(W(XG))
+
+#define fmsrs_ld(XG, XS, MT, DT)                                            \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_ld(W(XS), W(MT), W(DT))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        fmsrs_rx(W(XG))
+
+#elif RT_SIMD_COMPAT_FMR >= 1
+
+#define fmsrs_rr(XG, XS, XT)                                                \
+        mxcsr_st(Mebp,  inf_SCR02(0))                                       \
+        shrwx_mi(Mebp,  inf_SCR02(0), IB(3))                                \
+        andwx_mi(Mebp,  inf_SCR02(0), IH(0x0C00))                           \
+        orrwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        fmsrs_rx(W(XG))                                                     \
+        movwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))
+
+#define fmsrs_ld(XG, XS, MT, DT)                                            \
+        mxcsr_st(Mebp,  inf_SCR02(0))                                       \
+        shrwx_mi(Mebp,  inf_SCR02(0), IB(3))                                \
+        andwx_mi(Mebp,  inf_SCR02(0), IH(0x0C00))                           \
+        orrwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movrs_ld(W(XS), W(MT), W(DT))                                       \
+        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        fmsrs_rx(W(XG))                                                     \
+        movwx_mi(Mebp,  inf_SCR02(0), IH(0x037F))                           \
+        fpucw_ld(Mebp,  inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_FMR */
+
+#define fmsrs_rx(XG) /* not portable, do not use outside */                 \
+        fpuws_ld(Mebp,  inf_SCR01(0x00))                                    \
+        mulws_ld(Mebp,  inf_SCR02(0x00))                                    \
+        movrs_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        sbrws_ld(Mebp,  inf_SCR02(0x00))                                    \
+        fpuws_st(Mebp,  inf_SCR02(0x00))                                    \
+        movrs_ld(W(XG), Mebp, inf_SCR02(0))
+
 #endif /* RT_SIMD_COMPAT_FMS */
 
 /*************   packed single-precision floating-point compare   *************/
@@ -802,6 +1182,12 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbix_rr(RD, XS)                                                    \
+        REX(RXB(RD), RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1103,6 +1489,38 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xFA)                       \
         movix_rr(W(XD), W(XS))                                              \
         subix_ld(W(XD), W(MT), W(DT))
 
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* abs (G = |G|), (D = |S|) - signed */
+
+#define absin_rx(XG)                                                        \
+        absin_rr(W(XG), W(XG))
+
+#define absin_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x1E)           \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulix_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x40)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define mulix_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x40)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mulix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        mulix_rr(W(XD), W(XT))
+
+#define mulix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        mulix_ld(W(XD), W(MT), W(DT))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -1286,6 +1704,493 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE2)                       \
         stack_ld(Recx)                                                      \
         movix_ld(W(XD), Mebp, inf_SCR01(0))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqix_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x76)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ceqix_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x76)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ceqix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        ceqix_rr(W(XD), W(XT))
+
+#define ceqix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        ceqix_ld(W(XD), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtin_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x66)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define cgtin_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x66)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cgtin3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        cgtin_rr(W(XD), W(XT))
+
+#define cgtin3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        cgtin_ld(W(XD), W(MT), W(DT))
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#define minix_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3B)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minix_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3B)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define minix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        minix_rr(W(XD), W(XT))
+
+#define minix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        minix_ld(W(XD), W(MT), W(DT))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minin_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x39)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minin_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x39)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define minin3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        minin_rr(W(XD), W(XT))
+
+#define minin3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        minin_ld(W(XD), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#define maxix_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3F)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxix_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3F)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        maxix_rr(W(XD), W(XT))
+
+#define maxix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        maxix_ld(W(XD), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxin_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3D)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxin_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3D)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxin3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        maxin_rr(W(XD), W(XT))
+
+#define maxin3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        maxin_ld(W(XD), W(MT), W(DT))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addgx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xFD)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define addgx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xFD)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define addgx3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        addgx_rr(W(XD), W(XT))
+
+#define addgx3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        addgx_ld(W(XD), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subgx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xF9)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define subgx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF9)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define subgx3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        subgx_rr(W(XD), W(XT))
+
+#define subgx3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        subgx_ld(W(XD), W(MT), W(DT))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsgx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDD)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define adsgx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDD)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define adsgx3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        adsgx_rr(W(XD), W(XT))
+
+#define adsgx3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        adsgx_ld(W(XD), W(MT), W(DT))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsgn_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xED)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define adsgn_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xED)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define adsgn3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        adsgn_rr(W(XD), W(XT))
+
+#define adsgn3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        adsgn_ld(W(XD), W(MT), W(DT))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsgx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xD9)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define sbsgx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD9)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define sbsgx3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        sbsgx_rr(W(XD), W(XT))
+
+#define sbsgx3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        sbsgx_ld(W(XD), W(MT), W(DT))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsgn_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE9)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define sbsgn_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE9)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define sbsgn3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        sbsgn_rr(W(XD), W(XT))
+
+#define sbsgn3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        sbsgn_ld(W(XD), W(MT), W(DT))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avggx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE3)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define avggx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE3)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define avggx3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        avggx_rr(W(XD), W(XT))
+
+#define avggx3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        avggx_ld(W(XD), W(MT), W(DT))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define mingn_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xEA)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define mingn_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xEA)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mingn3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        mingn_rr(W(XD), W(XT))
+
+#define mingn3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        mingn_ld(W(XD), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxgn_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xEE)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxgn_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xEE)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxgn3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        maxgn_rr(W(XD), W(XT))
+
+#define maxgn3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        maxgn_ld(W(XD), W(MT), W(DT))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addgb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xFC)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define addgb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xFC)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define addgb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        addgb_rr(W(XD), W(XT))
+
+#define addgb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        addgb_ld(W(XD), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define subgb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xF8)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define subgb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF8)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define subgb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        subgb_rr(W(XD), W(XT))
+
+#define subgb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        subgb_ld(W(XD), W(MT), W(DT))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsgb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDC)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define adsgb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDC)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define adsgb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        adsgb_rr(W(XD), W(XT))
+
+#define adsgb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        adsgb_ld(W(XD), W(MT), W(DT))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsgb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xD8)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define sbsgb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD8)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define sbsgb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        sbsgb_rr(W(XD), W(XT))
+
+#define sbsgb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        sbsgb_ld(W(XD), W(MT), W(DT))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avggb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE0)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define avggb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE0)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define avggb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        avggb_rr(W(XD), W(XT))
+
+#define avggb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        avggb_ld(W(XD), W(MT), W(DT))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define mingb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDA)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define mingb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDA)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mingb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        mingb_rr(W(XD), W(XT))
+
+#define mingb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        mingb_ld(W(XD), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxgb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDE)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxgb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDE)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxgb3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        maxgb_rr(W(XD), W(XT))
+
+#define maxgb3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        maxgb_ld(W(XD), W(MT), W(DT))
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlgx_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x60)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    ESC REX(0,       RXB(XD)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x02,    MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlgn_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x60)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    ESC REX(0,       RXB(XD)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x04,    MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhgx_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x68)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    ESC REX(0,       RXB(XD)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x02,    MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhgn_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x68)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    ESC REX(0,       RXB(XD)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x04,    MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+#define cvxgb_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x67)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsgb_rr(XD, XS, XT)                                                \
+        movix_st(W(XT), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XD), W(XS))                                              \
+        cvxgb_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************************   helper macros (FPU mode)   ************************/
 
 /* simd mode
@@ -1528,7 +2433,7 @@ ADR xF3 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmars_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmars_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -1606,7 +2511,7 @@ ADR xF3 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsrs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -139,6 +139,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* mov (D = S) non-temporal (streaming) store, bypasses caches
+ * destination must be SIMD-aligned, weakly-ordered with regular stores */
+
+#define movox_nt(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
 
@@ -159,11 +167,125 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, masked-out elems aren't accessed */
+
+#define mmzox_ld(XD, MS, DS)                                                \
+        ck1ox_rm(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR EZX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x28)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 #define ck1ox_rm(XS, MT, DT) /* not portable, do not use outside */         \
     ADR EVX(0,       RXB(MT), REN(XS), K, 1, 1) EMITB(0x76)                 \
         MRM(0x01,    MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selox_rr(XG, XM, XS)                                                \
+        selox3rr(W(XG), W(XM), W(XG), W(XS))
+
+#define selox_ld(XG, XM, MS, DS)                                            \
+        selox3ld(W(XG), W(XM), W(XG), W(MS), W(DS))
+
+#define selox3rr(XD, XM, XS, XT)                                            \
+        ck1ox_rm(W(XM), Mebp, inf_GPC07)                                    \
+        EKX(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x64)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define selox3ld(XD, XM, XS, MT, DT)                                        \
+        ck1ox_rm(W(XM), Mebp, inf_GPC07)                                    \
+    ADR EKX(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x64)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splox_rr(XD, RS)                                                    \
+        EVX(RXB(XD), RXB(RS),    0x00, K, 1, 2) EMITB(0x7C)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))
+
+#define splox_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x58)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#define shfox_ri(XG, IS)                                                    \
+        shfox3ri(W(XG), W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define iloox_rr(XG, XS)                                                    \
+        iloox3rr(W(XG), W(XG), W(XS))
+
+#define iloox_ld(XG, MS, DS)                                                \
+        iloox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define iloox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#define ihiox_rr(XG, XS)                                                    \
+        ihiox3rr(W(XG), W(XG), W(XS))
+
+#define ihiox_ld(XG, MS, DS)                                                \
+        ihiox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihiox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revox_rx(XG)                                                        \
+        revox_rr(W(XG), W(XG))
+
+#define revox_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVX(RXB(XD), RXB(XD), REN(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))
+
+/* fld (G = elems of G from bytes [n, 2n) in bytes [0, n), in any order),
+ * other elems of G are undefined upon completion, used in reductions */
+
+#define fldox_rx(XG, n)                                                     \
+        fldox_##n(W(XG))
+
+#define fldox_20(XG)                                                        \
+        EVX(RXB(XG), RXB(XG), REN(XG), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x0E))
+
+#define fldox_10(XG)                                                        \
+        EVX(RXB(XG), RXB(XG), REN(XG), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
 #if (RT_512X1 < 8)
 
 /* and (G = G & S), (D = S & T) if (#D != #S) */
@@ -535,6 +657,45 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/* adr (G = G + S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define adros_rr(XG, XS, mode)                                              \
+        ERX(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x58) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* sbr (G = G - S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define sbros_rr(XG, XS, mode)                                              \
+        ERX(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x5C) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* mlr (G = G * S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define mlros_rr(XG, XS, mode)                                              \
+        ERX(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x59) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* dvr (G = G / S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define dvros_rr(XG, XS, mode)                                              \
+        ERX(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x5E) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* fmr (G = G + S * T) if (#G != #S && #G != #T)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#if RT_SIMD_COMPAT_FMA <= 1
+
+#define fmros_rr(XG, XS, XT, mode)                                          \
+        ERX(RXB(XG), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 1, 2)         \
+        EMITB(0xB8) MRM(REG(XG), MOD(XT), REG(XT))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
 /*************   packed single-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -712,6 +873,18 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbox_rr(RD, XS)                                                    \
+        ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcox_rr(RD, XS)                                                    \
+        mkbox_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -868,6 +1041,20 @@
         ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B)\
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/* cvf (D = fp16-to-fp32 S), loads half-width memory */
+
+#define cvfos_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory */
+
+#define cvfos_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x04))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -904,6 +1091,32 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* abs (G = |G|), (D = |S|) - signed */
+
+#define abson_rx(XG)                                                        \
+        abson_rr(W(XG), W(XG))
+
+#define abson_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x1E)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulox_rr(XG, XS)                                                    \
+        mulox3rr(W(XG), W(XG), W(XS))
+
+#define mulox_ld(XG, MS, DS)                                                \
+        mulox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x40)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define mulox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x40)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -1015,6 +1228,1190 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/****************   packed single-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#define minox_rr(XG, XS)                                                    \
+        minox3rr(W(XG), W(XG), W(XS))
+
+#define minox_ld(XG, MS, DS)                                                \
+        minox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x3B)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x3B)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minon_rr(XG, XS)                                                    \
+        minon3rr(W(XG), W(XG), W(XS))
+
+#define minon_ld(XG, MS, DS)                                                \
+        minon3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minon3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x39)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minon3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x39)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#define maxox_rr(XG, XS)                                                    \
+        maxox3rr(W(XG), W(XG), W(XS))
+
+#define maxox_ld(XG, MS, DS)                                                \
+        maxox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x3F)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x3F)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxon_rr(XG, XS)                                                    \
+        maxon3rr(W(XG), W(XG), W(XS))
+
+#define maxon_ld(XG, MS, DS)                                                \
+        maxon3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxon3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x3D)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxon3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x3D)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqox_rr(XG, XS)                                                    \
+        ceqox3rr(W(XG), W(XG), W(XS))
+
+#define ceqox_ld(XG, MS, DS)                                                \
+        ceqox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqox3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define ceqox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x00))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneox_rr(XG, XS)                                                    \
+        cneox3rr(W(XG), W(XG), W(XS))
+
+#define cneox_ld(XG, MS, DS)                                                \
+        cneox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cneox3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cneox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x04))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cltox_rr(XG, XS)                                                    \
+        cltox3rr(W(XG), W(XG), W(XS))
+
+#define cltox_ld(XG, MS, DS)                                                \
+        cltox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltox3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cltox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x01))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#define clton_rr(XG, XS)                                                    \
+        clton3rr(W(XG), W(XG), W(XS))
+
+#define clton_ld(XG, MS, DS)                                                \
+        clton3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define clton3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define clton3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x01))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cleox_rr(XG, XS)                                                    \
+        cleox3rr(W(XG), W(XG), W(XS))
+
+#define cleox_ld(XG, MS, DS)                                                \
+        cleox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cleox3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cleox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x02))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#define cleon_rr(XG, XS)                                                    \
+        cleon3rr(W(XG), W(XG), W(XS))
+
+#define cleon_ld(XG, MS, DS)                                                \
+        cleon3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cleon3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cleon3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x02))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgtox_rr(XG, XS)                                                    \
+        cgtox3rr(W(XG), W(XG), W(XS))
+
+#define cgtox_ld(XG, MS, DS)                                                \
+        cgtox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtox3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x06))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgtox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x06))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgton_rr(XG, XS)                                                    \
+        cgton3rr(W(XG), W(XG), W(XS))
+
+#define cgton_ld(XG, MS, DS)                                                \
+        cgton3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgton3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x06))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgton3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x06))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgeox_rr(XG, XS)                                                    \
+        cgeox3rr(W(XG), W(XG), W(XS))
+
+#define cgeox_ld(XG, MS, DS)                                                \
+        cgeox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgeox3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgeox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x05))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgeon_rr(XG, XS)                                                    \
+        cgeon3rr(W(XG), W(XG), W(XS))
+
+#define cgeon_ld(XG, MS, DS)                                                \
+        cgeon3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgeon3rr(XD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgeon3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x05))                                  \
+        mz1ox_ld(W(XD), Mebp, inf_GPC07)
+
+
+/*****************   packed single-precision gather/scatter   *****************/
+
+/* gat (D[i] = [RB + I[i] * 4]) if (#D != #I), uses k1 as mask register
+ * destroys k1 */
+
+#define gatox_ld(XD, RB, XI)                                                \
+        EMITB(0xC5) EMITB(0xF4) EMITB(0x46) EMITB(0xC9) /* kxnorw */        \
+    ADR EKX(RXB(XD), RXB(RB) | (RXB(XI) & 1) << 1, REN(XI) & 0x10, K, 1, 2) \
+        EMITB(0x92) MRM(REG(XD), 0x01, 0x04)                                \
+        AUX(EMITB(0x80 | REG(XI) << 3 | REG(RB)), EMITB(0x00), EMPTY)
+
+/* sct ([RB + I[i] * 4] = S[i]), uses k1 as mask register
+ * destroys k1 */
+
+#define sctox_st(XS, RB, XI)                                                \
+        EMITB(0xC5) EMITB(0xF4) EMITB(0x46) EMITB(0xC9) /* kxnorw */        \
+    ADR EKX(RXB(XS), RXB(RB) | (RXB(XI) & 1) << 1, REN(XI) & 0x10, K, 1, 2) \
+        EMITB(0xA2) MRM(REG(XS), 0x01, 0x04)                                \
+        AUX(EMITB(0x80 | REG(XI) << 3 | REG(RB)), EMITB(0x00), EMPTY)
+
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+#if (RT_512X1 < 8)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addmx_rr(XG, XS)                                                    \
+        addmx3rr(W(XG), W(XG), W(XS))
+
+#define addmx_ld(XG, MS, DS)                                                \
+        addmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define addmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define submx_rr(XG, XS)                                                    \
+        submx3rr(W(XG), W(XG), W(XS))
+
+#define submx_ld(XG, MS, DS)                                                \
+        submx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define submx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsmx_rr(XG, XS)                                                    \
+        adsmx3rr(W(XG), W(XG), W(XS))
+
+#define adsmx_ld(XG, MS, DS)                                                \
+        adsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsmn_rr(XG, XS)                                                    \
+        adsmn3rr(W(XG), W(XG), W(XS))
+
+#define adsmn_ld(XG, MS, DS)                                                \
+        adsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsmx_rr(XG, XS)                                                    \
+        sbsmx3rr(W(XG), W(XG), W(XS))
+
+#define sbsmx_ld(XG, MS, DS)                                                \
+        sbsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsmn_rr(XG, XS)                                                    \
+        sbsmn3rr(W(XG), W(XG), W(XS))
+
+#define sbsmn_ld(XG, MS, DS)                                                \
+        sbsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avgmx_rr(XG, XS)                                                    \
+        avgmx3rr(W(XG), W(XG), W(XS))
+
+#define avgmx_ld(XG, MS, DS)                                                \
+        avgmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define avgmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minmn_rr(XG, XS)                                                    \
+        minmn3rr(W(XG), W(XG), W(XS))
+
+#define minmn_ld(XG, MS, DS)                                                \
+        minmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define minmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxmn_rr(XG, XS)                                                    \
+        maxmn3rr(W(XG), W(XG), W(XS))
+
+#define maxmn_ld(XG, MS, DS)                                                \
+        maxmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define maxmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addmb_rr(XG, XS)                                                    \
+        addmb3rr(W(XG), W(XG), W(XS))
+
+#define addmb_ld(XG, MS, DS)                                                \
+        addmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define addmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define submb_rr(XG, XS)                                                    \
+        submb3rr(W(XG), W(XG), W(XS))
+
+#define submb_ld(XG, MS, DS)                                                \
+        submb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define submb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsmb_rr(XG, XS)                                                    \
+        adsmb3rr(W(XG), W(XG), W(XS))
+
+#define adsmb_ld(XG, MS, DS)                                                \
+        adsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define adsmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsmb_rr(XG, XS)                                                    \
+        sbsmb3rr(W(XG), W(XG), W(XS))
+
+#define sbsmb_ld(XG, MS, DS)                                                \
+        sbsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sbsmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avgmb_rr(XG, XS)                                                    \
+        avgmb3rr(W(XG), W(XG), W(XS))
+
+#define avgmb_ld(XG, MS, DS)                                                \
+        avgmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define avgmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define minmb_rr(XG, XS)                                                    \
+        minmb3rr(W(XG), W(XG), W(XS))
+
+#define minmb_ld(XG, MS, DS)                                                \
+        minmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define minmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxmb_rr(XG, XS)                                                    \
+        maxmb3rr(W(XG), W(XG), W(XS))
+
+#define maxmb_ld(XG, MS, DS)                                                \
+        maxmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define maxmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlmx_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvlax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvhax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlmn_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvlan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvhan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhmx_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvlax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvhax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhmn_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvlan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvhan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsmb_rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxab_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        cvxab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_512X1 >= 8 */
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addmx_rr(XG, XS)                                                    \
+        addmx3rr(W(XG), W(XG), W(XS))
+
+#define addmx_ld(XG, MS, DS)                                                \
+        addmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xFD)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define addmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xFD)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define submx_rr(XG, XS)                                                    \
+        submx3rr(W(XG), W(XG), W(XS))
+
+#define submx_ld(XG, MS, DS)                                                \
+        submx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xF9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define submx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xF9)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsmx_rr(XG, XS)                                                    \
+        adsmx3rr(W(XG), W(XG), W(XS))
+
+#define adsmx_ld(XG, MS, DS)                                                \
+        adsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDD)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDD)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsmn_rr(XG, XS)                                                    \
+        adsmn3rr(W(XG), W(XG), W(XS))
+
+#define adsmn_ld(XG, MS, DS)                                                \
+        adsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xED)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xED)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsmx_rr(XG, XS)                                                    \
+        sbsmx3rr(W(XG), W(XG), W(XS))
+
+#define sbsmx_ld(XG, MS, DS)                                                \
+        sbsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xD9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xD9)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsmn_rr(XG, XS)                                                    \
+        sbsmn3rr(W(XG), W(XG), W(XS))
+
+#define sbsmn_ld(XG, MS, DS)                                                \
+        sbsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xE9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xE9)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avgmx_rr(XG, XS)                                                    \
+        avgmx3rr(W(XG), W(XG), W(XS))
+
+#define avgmx_ld(XG, MS, DS)                                                \
+        avgmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xE3)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define avgmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xE3)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minmn_rr(XG, XS)                                                    \
+        minmn3rr(W(XG), W(XG), W(XS))
+
+#define minmn_ld(XG, MS, DS)                                                \
+        minmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xEA)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xEA)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxmn_rr(XG, XS)                                                    \
+        maxmn3rr(W(XG), W(XG), W(XS))
+
+#define maxmn_ld(XG, MS, DS)                                                \
+        maxmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xEE)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xEE)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addmb_rr(XG, XS)                                                    \
+        addmb3rr(W(XG), W(XG), W(XS))
+
+#define addmb_ld(XG, MS, DS)                                                \
+        addmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xFC)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define addmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xFC)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define submb_rr(XG, XS)                                                    \
+        submb3rr(W(XG), W(XG), W(XS))
+
+#define submb_ld(XG, MS, DS)                                                \
+        submb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xF8)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define submb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xF8)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsmb_rr(XG, XS)                                                    \
+        adsmb3rr(W(XG), W(XG), W(XS))
+
+#define adsmb_ld(XG, MS, DS)                                                \
+        adsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDC)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define adsmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDC)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsmb_rr(XG, XS)                                                    \
+        sbsmb3rr(W(XG), W(XG), W(XS))
+
+#define sbsmb_ld(XG, MS, DS)                                                \
+        sbsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xD8)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define sbsmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xD8)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avgmb_rr(XG, XS)                                                    \
+        avgmb3rr(W(XG), W(XG), W(XS))
+
+#define avgmb_ld(XG, MS, DS)                                                \
+        avgmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xE0)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define avgmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xE0)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define minmb_rr(XG, XS)                                                    \
+        minmb3rr(W(XG), W(XG), W(XS))
+
+#define minmb_ld(XG, MS, DS)                                                \
+        minmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDA)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDA)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxmb_rr(XG, XS)                                                    \
+        maxmb3rr(W(XG), W(XG), W(XS))
+
+#define maxmb_ld(XG, MS, DS)                                                \
+        maxmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDE)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDE)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlmx_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x30)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlmn_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x20)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhmx_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x3B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvlmx_rr(W(XD), W(XD))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhmn_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x3B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvlmn_rr(W(XD), W(XD))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsmb_rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0x67)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(RXB(XD), RXB(XD),    0x00, K, 1, 3) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xD8))                                  \
+        EVW(RXB(XD), RXB(XD), REN(XD), K, 1, 3) EMITB(0x43)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xD8))
+
+#endif /* RT_512X1 >= 8 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -152,6 +152,17 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
 
+/* mov (D = S) non-temporal (streaming) store, bypasses caches
+ * destination must be SIMD-aligned, weakly-ordered with regular stores */
+
+#define movox_nt(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
 
@@ -188,6 +199,109 @@
         MRM(0x01,       0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)
 
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#define shfox_ri(XG, IS)                                                    \
+        shfox3ri(W(XG), W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+        EVX(RMB(XD), RMB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define iloox_rr(XG, XS)                                                    \
+        iloox3rr(W(XG), W(XG), W(XS))
+
+#define iloox_ld(XG, MS, DS)                                                \
+        iloox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define iloox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#define ihiox_rr(XG, XS)                                                    \
+        ihiox3rr(W(XG), W(XG), W(XS))
+
+#define ihiox_ld(XG, MS, DS)                                                \
+        ihiox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihiox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revox_rx(XG)                                                        \
+        revox_rr(W(XG), W(XG))
+
+#define revox_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVX(RXB(XD), RXB(XD), REN(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVX(RMB(XD), RMB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVX(RMB(XD), RMB(XD), REM(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVX(RXB(XD), RMB(XD), REN(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(RMB(XD), RXB(XD), REM(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(RXB(XD), RMB(XD), REN(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* fld (G = elems of G from bytes [n, 2n) in bytes [0, n), in any order),
+ * other elems of G are undefined upon completion, used in reductions */
+
+#define fldox_rx(XG, n)                                                     \
+        fldox_##n(W(XG))
+
+#define fldox_40(XG)                                                        \
+        EVX(RXB(XG), RMB(XG),    0x00, K, 0, 1) EMITB(0x28)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))
+
+#define fldox_20(XG)                                                        \
+        EVX(RXB(XG), RXB(XG), REN(XG), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x0E))
+
+#define fldox_10(XG)                                                        \
+        EVX(RXB(XG), RXB(XG), REN(XG), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
 #if (RT_512X2 < 2)
 
 /* and (G = G & S), (D = S & T) if (#D != #S) */
@@ -884,6 +998,26 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_1K4))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbox_rr(RD, XS)                                                    \
+        ck1ox_rm(X(XS), Mebp, inf_GPC07)                                    \
+        VEX(1,             0,    0x00, 0, 0, 1) EMITB(0x93)                 \
+        MRM(0x07,       0x03, 0x01)                                         \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x04,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(0x10))                                  \
+        ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))                                                     \
+        REX(RXB(RD),       1) EMITB(0x0B)                                   \
+        MRM(REG(RD),    0x03, 0x07)
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcox_rr(RD, XS)                                                    \
+        mkbox_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1094,6 +1228,26 @@
         ERX(RMB(XD), RMB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B)\
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/* cvf (D = fp16-to-fp32 S), loads half-width memory */
+
+#define cvfos_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory */
+
+#define cvfos_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMITB(0x04))                           \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMITB(0x04))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1284,6 +1438,1155 @@
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
 
+/****************   packed half-word/byte integer arithmetic   ****************/
+
+#if (RT_512X2 < 2)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addmx_rr(XG, XS)                                                    \
+        addmx3rr(W(XG), W(XG), W(XS))
+
+#define addmx_ld(XG, MS, DS)                                                \
+        addmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define addmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        addax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define submx_rr(XG, XS)                                                    \
+        submx3rr(W(XG), W(XG), W(XS))
+
+#define submx_ld(XG, MS, DS)                                                \
+        submx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define submx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        subax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsmx_rr(XG, XS)                                                    \
+        adsmx3rr(W(XG), W(XG), W(XS))
+
+#define adsmx_ld(XG, MS, DS)                                                \
+        adsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        adsax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsmn_rr(XG, XS)                                                    \
+        adsmn3rr(W(XG), W(XG), W(XS))
+
+#define adsmn_ld(XG, MS, DS)                                                \
+        adsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        adsan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsmx_rr(XG, XS)                                                    \
+        sbsmx3rr(W(XG), W(XG), W(XS))
+
+#define sbsmx_ld(XG, MS, DS)                                                \
+        sbsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        sbsax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsmn_rr(XG, XS)                                                    \
+        sbsmn3rr(W(XG), W(XG), W(XS))
+
+#define sbsmn_ld(XG, MS, DS)                                                \
+        sbsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        sbsan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avgmx_rr(XG, XS)                                                    \
+        avgmx3rr(W(XG), W(XG), W(XS))
+
+#define avgmx_ld(XG, MS, DS)                                                \
+        avgmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmx3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define avgmx3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        avgax_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minmn_rr(XG, XS)                                                    \
+        minmn3rr(W(XG), W(XG), W(XS))
+
+#define minmn_ld(XG, MS, DS)                                                \
+        minmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define minmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        minan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxmn_rr(XG, XS)                                                    \
+        maxmn3rr(W(XG), W(XG), W(XS))
+
+#define maxmn_ld(XG, MS, DS)                                                \
+        maxmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmn3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define maxmn3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        maxan_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addmb_rr(XG, XS)                                                    \
+        addmb3rr(W(XG), W(XG), W(XS))
+
+#define addmb_ld(XG, MS, DS)                                                \
+        addmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define addmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        addab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define submb_rr(XG, XS)                                                    \
+        submb3rr(W(XG), W(XG), W(XS))
+
+#define submb_ld(XG, MS, DS)                                                \
+        submb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define submb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        subab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsmb_rr(XG, XS)                                                    \
+        adsmb3rr(W(XG), W(XG), W(XS))
+
+#define adsmb_ld(XG, MS, DS)                                                \
+        adsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define adsmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        adsab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsmb_rr(XG, XS)                                                    \
+        sbsmb3rr(W(XG), W(XG), W(XS))
+
+#define sbsmb_ld(XG, MS, DS)                                                \
+        sbsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define sbsmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        sbsab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avgmb_rr(XG, XS)                                                    \
+        avgmb3rr(W(XG), W(XG), W(XS))
+
+#define avgmb_ld(XG, MS, DS)                                                \
+        avgmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define avgmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        avgab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define minmb_rr(XG, XS)                                                    \
+        minmb3rr(W(XG), W(XG), W(XS))
+
+#define minmb_ld(XG, MS, DS)                                                \
+        minmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define minmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        minab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxmb_rr(XG, XS)                                                    \
+        maxmb3rr(W(XG), W(XG), W(XS))
+
+#define maxmb_ld(XG, MS, DS)                                                \
+        maxmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmb3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define maxmb3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        maxab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_512X2 >= 2 */
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addmx_rr(XG, XS)                                                    \
+        addmx3rr(W(XG), W(XG), W(XS))
+
+#define addmx_ld(XG, MS, DS)                                                \
+        addmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xFD)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xFD)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define addmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xFD)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xFD)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define submx_rr(XG, XS)                                                    \
+        submx3rr(W(XG), W(XG), W(XS))
+
+#define submx_ld(XG, MS, DS)                                                \
+        submx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xF9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xF9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define submx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xF9)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xF9)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsmx_rr(XG, XS)                                                    \
+        adsmx3rr(W(XG), W(XG), W(XS))
+
+#define adsmx_ld(XG, MS, DS)                                                \
+        adsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDD)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xDD)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDD)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xDD)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsmn_rr(XG, XS)                                                    \
+        adsmn3rr(W(XG), W(XG), W(XS))
+
+#define adsmn_ld(XG, MS, DS)                                                \
+        adsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xED)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xED)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xED)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xED)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsmx_rr(XG, XS)                                                    \
+        sbsmx3rr(W(XG), W(XG), W(XS))
+
+#define sbsmx_ld(XG, MS, DS)                                                \
+        sbsmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xD9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xD9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xD9)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xD9)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsmn_rr(XG, XS)                                                    \
+        sbsmn3rr(W(XG), W(XG), W(XS))
+
+#define sbsmn_ld(XG, MS, DS)                                                \
+        sbsmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xE9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xE9)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xE9)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xE9)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
+
+#define avgmx_rr(XG, XS)                                                    \
+        avgmx3rr(W(XG), W(XG), W(XS))
+
+#define avgmx_ld(XG, MS, DS)                                                \
+        avgmx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xE3)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xE3)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define avgmx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xE3)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xE3)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minmn_rr(XG, XS)                                                    \
+        minmn3rr(W(XG), W(XG), W(XS))
+
+#define minmn_ld(XG, MS, DS)                                                \
+        minmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xEA)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xEA)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xEA)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xEA)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxmn_rr(XG, XS)                                                    \
+        maxmn3rr(W(XG), W(XG), W(XS))
+
+#define maxmn_ld(XG, MS, DS)                                                \
+        maxmn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmn3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xEE)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xEE)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxmn3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xEE)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xEE)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
+
+#define addmb_rr(XG, XS)                                                    \
+        addmb3rr(W(XG), W(XG), W(XS))
+
+#define addmb_ld(XG, MS, DS)                                                \
+        addmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xFC)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xFC)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define addmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xFC)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xFC)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
+
+#define submb_rr(XG, XS)                                                    \
+        submb3rr(W(XG), W(XG), W(XS))
+
+#define submb_ld(XG, MS, DS)                                                \
+        submb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define submb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xF8)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xF8)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define submb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xF8)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xF8)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
+
+#define adsmb_rr(XG, XS)                                                    \
+        adsmb3rr(W(XG), W(XG), W(XS))
+
+#define adsmb_ld(XG, MS, DS)                                                \
+        adsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define adsmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDC)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xDC)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define adsmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDC)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xDC)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
+
+#define sbsmb_rr(XG, XS)                                                    \
+        sbsmb3rr(W(XG), W(XG), W(XS))
+
+#define sbsmb_ld(XG, MS, DS)                                                \
+        sbsmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define sbsmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xD8)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xD8)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define sbsmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xD8)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xD8)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
+
+#define avgmb_rr(XG, XS)                                                    \
+        avgmb3rr(W(XG), W(XG), W(XS))
+
+#define avgmb_ld(XG, MS, DS)                                                \
+        avgmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define avgmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xE0)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xE0)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define avgmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xE0)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xE0)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
+
+#define minmb_rr(XG, XS)                                                    \
+        minmb3rr(W(XG), W(XG), W(XS))
+
+#define minmb_ld(XG, MS, DS)                                                \
+        minmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDA)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xDA)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDA)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xDA)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
+
+#define maxmb_rr(XG, XS)                                                    \
+        maxmb3rr(W(XG), W(XG), W(XS))
+
+#define maxmb_ld(XG, MS, DS)                                                \
+        maxmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxmb3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xDE)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVX(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0xDE)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxmb3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xDE)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0xDE)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+#endif /* RT_512X2 >= 2 */
+
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvlmx_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvlax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvhax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvlax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvhax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvlmn_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvlan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvhan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvlan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvhan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
+
+#define cvhmx_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvlax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvhax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvlax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvhax_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
+
+#define cvhmn_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvlan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvhan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvlan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvhan_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
+
+#define cvsmb_rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxab_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvxab_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        cvxab_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        cvxab_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
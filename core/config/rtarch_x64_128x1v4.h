@@ -159,6 +159,101 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x15)           \
         orrjx_rr(Xmm0, W(XS))                                               \
         movjx_st(Xmm0, W(MG), W(DG))
 
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define spljx_rr(XD, RS)                                                    \
+    ESC REW(RXB(XD), RXB(RS)) EMITB(0x0F) EMITB(0x6E)                       \
+        MRM(REG(XD), MOD(RS), REG(RS))                                      \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x44))
+
+#define spljx_ld(XD, MS, DS)                                                \
+ADR ESC REW(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x6E)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x44))
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extjx_rr(RD, XS, IS)                                                \
+    ESC REW(RXB(XS), RXB(RD)) EMITB(0x0F) EMITB(0x3A) EMITB(0x16)           \
+        MRM(REG(XS), MOD(RD), REG(RD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x01))
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insjx_rr(XG, RS, IS)                                                \
+    ESC REW(RXB(XG), RXB(RS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x22)           \
+        MRM(REG(XG), MOD(RS), REG(RS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x01))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfjx_ri(XG, IS)                                                    \
+    ESC REX(RXB(XG), RXB(XG)) EMITB(0x0F) EMITB(0xC6)                       \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x03))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        shfjx_ri(W(XD), W(IT))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilojx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ilojx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ilojx3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        ilojx_rr(W(XD), W(XT))
+
+#define ilojx3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        ilojx_ld(W(XD), W(MT), W(DT))
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihijx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ihijx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ihijx3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        ihijx_rr(W(XD), W(XT))
+
+#define ihijx3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        ihijx_ld(W(XD), W(MT), W(DT))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revjx_rx(XG)                                                        \
+        revjx_rr(W(XG), W(XG))
+
+#define revjx_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -438,7 +533,7 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmajs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmajs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -520,7 +615,7 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsjs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -735,6 +830,12 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_128))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbjx_rr(RD, XS)                                                    \
+    ESC REX(RXB(RD), RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1035,6 +1136,43 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
 
 #endif /* RT_SIMD_COMPAT_SSE >= 4 */
 
+#define cvxjs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x5A)                   \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvhis_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x16)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvljs_rr(XD, XS)                                                    \
+        cvyis_rr(W(XD), W(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhjs_rr(XD, XS)                                                    \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvyis_rr(W(XD), W(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsis_rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvxjs_rr(W(XD), W(XT))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvxjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        mvhis_ld(W(XD), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1237,6 +1375,51 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD3)                       \
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/****************   packed double-precision integer compare   *****************/
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqjx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x29)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ceqjx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x29)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ceqjx3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        ceqjx_rr(W(XD), W(XT))
+
+#define ceqjx3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        ceqjx_ld(W(XD), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtjn_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x37)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define cgtjn_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x37)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cgtjn3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        cgtjn_rr(W(XD), W(XT))
+
+#define cgtjn3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        cgtjn_ld(W(XD), W(MT), W(DT))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+
 /*********   scalar double-precision floating-point move/arithmetic   *********/
 
 /* mov (D = S) */
@@ -1415,7 +1598,7 @@ ADR xF2 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movts_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmats_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmats_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -1493,7 +1676,7 @@ ADR xF2 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movts_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsts_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsts_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -137,6 +137,116 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, masked-out elems aren't accessed */
+
+#define mmzjx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x2D)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define seljx_rr(XG, XM, XS)                                                \
+        seljx3rr(W(XG), W(XM), W(XG), W(XS))
+
+#define seljx_ld(XG, XM, MS, DS)                                            \
+        seljx3ld(W(XG), W(XM), W(XG), W(MS), W(DS))
+
+#define seljx3rr(XD, XM, XS, XT)                                            \
+        VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 3) EMITB(0x4B)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(REN(XM) << 4))
+
+#define seljx3ld(XD, XM, XS, MT, DT)                                        \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 0, 1, 3) EMITB(0x4B)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(REN(XM) << 4))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define spljx_rr(XD, RS)                                                    \
+        VEW(RXB(XD), RXB(RS),    0x00, 0, 1, 1) EMITB(0x6E)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))                                      \
+        VEX(RXB(XD), RXB(XD),    0x00, 0, 1, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x44))
+
+#define spljx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 3, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extjx_rr(RD, XS, IS)                                                \
+        VEW(RXB(XS), RXB(RD),    0x00, 0, 1, 3) EMITB(0x16)                 \
+        MRM(REG(XS), MOD(RD), REG(RD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x01))
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define insjx_rr(XG, RS, IS)                                                \
+        VEW(RXB(XG), RXB(RS), REN(XG), 0, 1, 3) EMITB(0x22)                 \
+        MRM(REG(XG), MOD(RS), REG(RS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x01))
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfjx_ri(XG, IS)                                                    \
+        shfjx3ri(W(XG), W(XG), W(IS))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03)))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilojx_rr(XG, XS)                                                    \
+        ilojx3rr(W(XG), W(XG), W(XS))
+
+#define ilojx_ld(XG, MS, DS)                                                \
+        ilojx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ilojx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ilojx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 0, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihijx_rr(XG, XS)                                                    \
+        ihijx3rr(W(XG), W(XG), W(XS))
+
+#define ihijx_ld(XG, MS, DS)                                                \
+        ihijx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihijx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihijx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 0, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revjx_rx(XG)                                                        \
+        revjx_rr(W(XG), W(XG))
+
+#define revjx_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -400,7 +510,7 @@
         movjx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmajs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmajs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -482,7 +592,7 @@
         movjx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsjs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -719,6 +829,18 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_128))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbjx_rr(RD, XS)                                                    \
+        VEX(RXB(RD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x50)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcjx_rr(RD, XS)                                                    \
+        mkbjx_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -906,6 +1028,48 @@
         rnrjs_rr(W(XD), W(XS), mode)                                        \
         cvzjs_rr(W(XD), W(XD))
 
+#define cvxjs_rr(XD, XS)     /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxjs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvhis_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS), REN(XD), 0, 0, 1) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvljs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhjs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS), REN(XS), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvljs_rr(W(XD), W(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsis_rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvxjs_rr(W(XD), W(XT))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvxjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        mvhis_ld(W(XD), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1130,6 +1294,43 @@
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqjx_rr(XG, XS)                                                    \
+        ceqjx3rr(W(XG), W(XG), W(XS))
+
+#define ceqjx_ld(XG, MS, DS)                                                \
+        ceqjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqjx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 2) EMITB(0x29)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ceqjx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 0, 1, 2) EMITB(0x29)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtjn_rr(XG, XS)                                                    \
+        cgtjn3rr(W(XG), W(XG), W(XS))
+
+#define cgtjn_ld(XG, MS, DS)                                                \
+        cgtjn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtjn3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 2) EMITB(0x37)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define cgtjn3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 0, 1, 2) EMITB(0x37)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+
 /*********   scalar double-precision floating-point move/arithmetic   *********/
 
 /* mov (D = S) */
@@ -1302,7 +1503,7 @@
         movts_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmats_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmats_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -1380,7 +1581,7 @@
         movts_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsts_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsts_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
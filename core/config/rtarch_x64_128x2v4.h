@@ -152,6 +152,88 @@ ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         orrdx_rr(Xmm0, W(XS))                                               \
         movdx_st(Xmm0, W(MG), W(DG))
 
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfdx_ri(XG, IS)                                                    \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0xC6)                       \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x03))                        \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0xC6)                       \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x03))
+
+#define shfdx3ri(XD, XS, IT)                                                \
+        movdx_rr(W(XD), W(XS))                                              \
+        shfdx_ri(W(XD), W(IT))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilodx_rr(XG, XS)                                                    \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ilodx_ld(XG, MS, DS)                                                \
+ADR ESC REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#define ilodx3rr(XD, XS, XT)                                                \
+        movdx_rr(W(XD), W(XS))                                              \
+        ilodx_rr(W(XD), W(XT))
+
+#define ilodx3ld(XD, XS, MT, DT)                                            \
+        movdx_rr(W(XD), W(XS))                                              \
+        ilodx_ld(W(XD), W(MT), W(DT))
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihidx_rr(XG, XS)                                                    \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define ihidx_ld(XG, MS, DS)                                                \
+ADR ESC REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#define ihidx3rr(XD, XS, XT)                                                \
+        movdx_rr(W(XD), W(XS))                                              \
+        ihidx_rr(W(XD), W(XT))
+
+#define ihidx3ld(XD, XS, MT, DT)                                            \
+        movdx_rr(W(XD), W(XS))                                              \
+        ihidx_ld(W(XD), W(MT), W(DT))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revdx_rx(XG)                                                        \
+        revdx_rr(W(XG), W(XG))
+
+#define revdx_rr(XD, XS)                                                    \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))                                  \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))                                  \
+        REX(0,             1) EMITB(0x0F) EMITB(0x57)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(1,             0) EMITB(0x0F) EMITB(0x57)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x57)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -476,7 +558,7 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movdx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmads_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmads_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -566,7 +648,7 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         movdx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsds_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsds_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -842,6 +924,19 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_256))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbdx_rr(RD, XS)                                                    \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x04,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+    ESC REX(RXB(RD),       0) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        REX(RXB(RD),       1) EMITB(0x0B)                                   \
+        MRM(REG(RD),    0x03, 0x07)
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1187,6 +1282,49 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
 
 #endif /* RT_SIMD_COMPAT_SSE >= 4 */
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlds_rr(XD, XS)                                                    \
+        REX(1,             0) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(0,             0) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhds_rr(XD, XS)                                                    \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvscs_rr(XD, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        cvxjs_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        cvxjs_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mvhis_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxjs_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x10))                              \
+        cvxjs_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        mvhis_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -137,6 +137,119 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, masked-out elems aren't accessed */
+
+#define mmzdx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x2D)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define seldx_rr(XG, XM, XS)                                                \
+        seldx3rr(W(XG), W(XM), W(XG), W(XS))
+
+#define seldx_ld(XG, XM, MS, DS)                                            \
+        seldx3ld(W(XG), W(XM), W(XG), W(MS), W(DS))
+
+#define seldx3rr(XD, XM, XS, XT)                                            \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 3) EMITB(0x4B)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(REN(XM) << 4))
+
+#define seldx3ld(XD, XM, XS, MT, DT)                                        \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 3) EMITB(0x4B)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(REN(XM) << 4))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#if (RT_256X1 < 2)
+
+#define spldx_rr(XD, RS)                                                    \
+        VEW(RXB(XD), RXB(RS),    0x00, 0, 1, 1) EMITB(0x6E)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))                                      \
+        VEX(RXB(XD), RXB(XD),    0x00, 0, 3, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(RXB(XD), RXB(XD), REN(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+#define spldx_rr(XD, RS)                                                    \
+        VEW(RXB(XD), RXB(RS),    0x00, 0, 1, 1) EMITB(0x6E)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))                                      \
+        VEX(RXB(XD), RXB(XD),    0x00, 1, 1, 2) EMITB(0x59)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+#define spldx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x19)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfdx_ri(XG, IS)                                                    \
+        shfdx3ri(W(XG), W(XG), W(IS))
+
+#define shfdx3ri(XD, XS, IT)                                                \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x05))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilodx_rr(XG, XS)                                                    \
+        ilodx3rr(W(XG), W(XG), W(XS))
+
+#define ilodx_ld(XG, MS, DS)                                                \
+        ilodx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ilodx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ilodx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihidx_rr(XG, XS)                                                    \
+        ihidx3rr(W(XG), W(XG), W(XS))
+
+#define ihidx_ld(XG, MS, DS)                                                \
+        ihidx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihidx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihidx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revdx_rx(XG)                                                        \
+        revdx_rr(W(XG), W(XG))
+
+#define revdx_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        VEX(RXB(XD), RXB(XD), REN(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -400,7 +513,7 @@
         movdx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmads_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmads_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -490,7 +603,7 @@
         movdx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsds_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsds_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -735,6 +848,18 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_256))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbdx_rr(RD, XS)                                                    \
+        VEX(RXB(RD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x50)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcdx_rr(RD, XS)                                                    \
+        mkbdx_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -922,6 +1047,46 @@
         rnrds_rr(W(XD), W(XS), mode)                                        \
         cvzds_rr(W(XD), W(XD))
 
+#define cvxds_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvhcs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS), REN(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x01))
+
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlds_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhds_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvlds_rr(W(XD), W(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvscs_rr(XD, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XD), RXB(XT),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_256X1 < 2)
@@ -1232,6 +1397,21 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/*****************   packed double-precision gather/scatter   *****************/
+
+/* gat (D[i] = [RB + I[i] * 8]) if (#D != #I), uses Xmm0 as mask register
+ * destroys Xmm0 */
+
+#if (RT_SIMD == 256)
+
+#define gatqx_ld(XD, RB, XI)                                                \
+        movcx_ld(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR VSW(RXB(XD), RXB(XI), RXB(RB), 0x00, 1, 1, 2) EMITB(0x93)           \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        AUX(EMITB(0xC0 | REG(XI) << 3 | REG(RB)), EMITB(0x00), EMPTY)
+
+#endif /* RT_SIMD == 256 */
+
 #endif /* RT_256X1 >= 2, AVX2 */
 
 /* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
@@ -1302,6 +1482,80 @@
         stack_ld(Recx)                                                      \
         movdx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/****************   packed double-precision integer compare   *****************/
+
+#if (RT_256X1 < 2)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqdx_rr(XG, XS)                                                    \
+        ceqdx3rr(W(XG), W(XG), W(XS))
+
+#define ceqdx_ld(XG, MS, DS)                                                \
+        ceqdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqdx3rr(XD, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        ceqjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        ceqjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define ceqdx3ld(XD, XS, MT, DT)                                            \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_ld(W(XD), W(MT), W(DT))                                       \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        ceqjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        ceqjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqdx_rr(XG, XS)                                                    \
+        ceqdx3rr(W(XG), W(XG), W(XS))
+
+#define ceqdx_ld(XG, MS, DS)                                                \
+        ceqdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqdx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 2) EMITB(0x29)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ceqdx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x29)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtdn_rr(XG, XS)                                                    \
+        cgtdn3rr(W(XG), W(XG), W(XS))
+
+#define cgtdn_ld(XG, MS, DS)                                                \
+        cgtdn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtdn3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 2) EMITB(0x37)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define cgtdn3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x37)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -154,6 +154,89 @@
         MRM(REG(XS),    0x02, REG(MG))                                      \
         AUX(SIB(MG), EMITW(VXL(DG)), EMPTY)
 
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        VEX(0,             0,    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x05))               \
+        VEX(1,             1,    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x05))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define iloqx_rr(XG, XS)                                                    \
+        iloqx3rr(W(XG), W(XG), W(XS))
+
+#define iloqx_ld(XG, MS, DS)                                                \
+        iloqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloqx3rr(XD, XS, XT)                                                \
+        VEX(0,             0, REG(XS), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        VEX(1,             1, REH(XS), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(0,       RXB(MT), REG(XS), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MT), REH(XS), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihiqx_rr(XG, XS)                                                    \
+        ihiqx3rr(W(XG), W(XG), W(XS))
+
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihiqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiqx3rr(XD, XS, XT)                                                \
+        VEX(0,             0, REG(XS), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        VEX(1,             1, REH(XS), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(0,       RXB(MT), REG(XS), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MT), REH(XS), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revqx_rx(XG)                                                        \
+        revqx_rr(W(XG), W(XG))
+
+#define revqx_rr(XD, XS)                                                    \
+        VEX(0,             0,    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        VEX(0,             0, REG(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,             1,    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        VEX(1,             1, REH(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(0,             1, REG(XD), 1, 0, 1) EMITB(0x57)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(1,             0, REH(XD), 1, 0, 1) EMITB(0x57)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(0,             1, REG(XD), 1, 0, 1) EMITB(0x57)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -462,7 +545,7 @@
         movqx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmaqs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmaqs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -568,7 +651,7 @@
         movqx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsqs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsqs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -892,6 +975,25 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_512))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbqx_rr(RD, XS)                                                    \
+        VEX(1,             1,    0x00, 1, 1, 1) EMITB(0x50)                 \
+        MRM(0x07,    MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x04,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        VEX(RXB(RD),       0,    0x00, 1, 1, 1) EMITB(0x50)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))                                      \
+        REX(RXB(RD),       1) EMITB(0x0B)                                   \
+        MRM(REG(RD),    0x03, 0x07)
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcqx_rr(RD, XS)                                                    \
+        mkbqx_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1136,6 +1238,51 @@
         rnrqs_rr(W(XD), W(XS), mode)                                        \
         cvzqs_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        VEX(0,             1,    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhqs_rr(XD, XS)                                                    \
+        VEX(0,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        VEX(1,             1,    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_256X2 < 2)
@@ -139,11 +139,109 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, masked-out elems aren't accessed */
+
+#define mmzqx_ld(XD, MS, DS)                                                \
+        ck1qx_rm(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR EZW(RXB(XD), RXB(MS),    0x00, K, 1, 1) EMITB(0x28)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 #define ck1qx_rm(XS, MT, DT) /* not portable, do not use outside */         \
     ADR EVW(0,       RXB(MT), REN(XS), K, 1, 2) EMITB(0x29)                 \
         MRM(0x01,    MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selqx_rr(XG, XM, XS)                                                \
+        selqx3rr(W(XG), W(XM), W(XG), W(XS))
+
+#define selqx_ld(XG, XM, MS, DS)                                            \
+        selqx3ld(W(XG), W(XM), W(XG), W(MS), W(DS))
+
+#define selqx3rr(XD, XM, XS, XT)                                            \
+        ck1qx_rm(W(XM), Mebp, inf_GPC07)                                    \
+        EKW(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x64)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define selqx3ld(XD, XM, XS, MT, DT)                                        \
+        ck1qx_rm(W(XM), Mebp, inf_GPC07)                                    \
+    ADR EKW(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x64)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splqx_rr(XD, RS)                                                    \
+        EVW(RXB(XD), RXB(RS),    0x00, K, 1, 2) EMITB(0x7C)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))
+
+#define splqx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x59)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define iloqx_rr(XG, XS)                                                    \
+        iloqx3rr(W(XG), W(XG), W(XS))
+
+#define iloqx_ld(XG, MS, DS)                                                \
+        iloqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihiqx_rr(XG, XS)                                                    \
+        ihiqx3rr(W(XG), W(XG), W(XS))
+
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihiqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revqx_rx(XG)                                                        \
+        revqx_rr(W(XG), W(XG))
+
+#define revqx_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(RXB(XD), RXB(XD), REN(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))
+
 #if (RT_512X1 < 8)
 
 /* and (G = G & S), (D = S & T) if (#D != #S) */
@@ -515,6 +613,45 @@
 
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/* adr (G = G + S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define adrqs_rr(XG, XS, mode)                                              \
+        ERW(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x58) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* sbr (G = G - S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define sbrqs_rr(XG, XS, mode)                                              \
+        ERW(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5C) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* mlr (G = G * S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define mlrqs_rr(XG, XS, mode)                                              \
+        ERW(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x59) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* dvr (G = G / S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define dvrqs_rr(XG, XS, mode)                                              \
+        ERW(RXB(XG), RXB(XS), REN(XG), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5E) MRM(REG(XG), MOD(XS), REG(XS))
+
+/* fmr (G = G + S * T) if (#G != #S && #G != #T)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#if RT_SIMD_COMPAT_FMA <= 1
+
+#define fmrqs_rr(XG, XS, XT, mode)                                          \
+        ERW(RXB(XG), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 1, 2)         \
+        EMITB(0xB8) MRM(REG(XG), MOD(XT), REG(XT))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
 /*************   packed double-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
@@ -691,6 +828,18 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_512))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbqx_rr(RD, XS)                                                    \
+        ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcqx_rr(RD, XS)                                                    \
+        mkbqx_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1015,6 +1164,49 @@
 
 #endif /* RT_512X1 >= 8 */
 
+#define cvxqs_rr(XD, XS)     /* not portable, do not use outside */         \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxqs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvhos_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVW(RXB(XD), RXB(MS), REN(XD), K, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x01))
+
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhqs_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvlqs_rr(W(XD), W(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvxqs_rr(W(XD), W(XT))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvxqs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        mvhos_ld(W(XD), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1051,6 +1243,36 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* abs (G = |G|), (D = |S|) - signed */
+
+#define absqn_rx(XG)                                                        \
+        absqn_rr(W(XG), W(XG))
+
+#define absqn_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x1F)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#if (RT_512X1 >= 8)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#define mulqx_rr(XG, XS)                                                    \
+        mulqx3rr(W(XG), W(XG), W(XS))
+
+#define mulqx_ld(XG, MS, DS)                                                \
+        mulqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x40)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x40)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_512X1 >= 8 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -1162,6 +1384,297 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/****************   packed double-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#define minqx_rr(XG, XS)                                                    \
+        minqx3rr(W(XG), W(XG), W(XS))
+
+#define minqx_ld(XG, MS, DS)                                                \
+        minqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x3B)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x3B)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#define minqn_rr(XG, XS)                                                    \
+        minqn3rr(W(XG), W(XG), W(XS))
+
+#define minqn_ld(XG, MS, DS)                                                \
+        minqn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minqn3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x39)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minqn3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x39)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#define maxqx_rr(XG, XS)                                                    \
+        maxqx3rr(W(XG), W(XG), W(XS))
+
+#define maxqx_ld(XG, MS, DS)                                                \
+        maxqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x3F)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x3F)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#define maxqn_rr(XG, XS)                                                    \
+        maxqn3rr(W(XG), W(XG), W(XS))
+
+#define maxqn_ld(XG, MS, DS)                                                \
+        maxqn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxqn3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 2) EMITB(0x3D)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxqn3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 2) EMITB(0x3D)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqqx_rr(XG, XS)                                                    \
+        ceqqx3rr(W(XG), W(XG), W(XS))
+
+#define ceqqx_ld(XG, MS, DS)                                                \
+        ceqqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqqx3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define ceqqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x00))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneqx_rr(XG, XS)                                                    \
+        cneqx3rr(W(XG), W(XG), W(XS))
+
+#define cneqx_ld(XG, MS, DS)                                                \
+        cneqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cneqx3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cneqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x04))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cltqx_rr(XG, XS)                                                    \
+        cltqx3rr(W(XG), W(XG), W(XS))
+
+#define cltqx_ld(XG, MS, DS)                                                \
+        cltqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltqx3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cltqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x01))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#define cltqn_rr(XG, XS)                                                    \
+        cltqn3rr(W(XG), W(XG), W(XS))
+
+#define cltqn_ld(XG, MS, DS)                                                \
+        cltqn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltqn3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cltqn3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x01))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cleqx_rr(XG, XS)                                                    \
+        cleqx3rr(W(XG), W(XG), W(XS))
+
+#define cleqx_ld(XG, MS, DS)                                                \
+        cleqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cleqx3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cleqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x02))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#define cleqn_rr(XG, XS)                                                    \
+        cleqn3rr(W(XG), W(XG), W(XS))
+
+#define cleqn_ld(XG, MS, DS)                                                \
+        cleqn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cleqn3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cleqn3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x02))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgtqx_rr(XG, XS)                                                    \
+        cgtqx3rr(W(XG), W(XG), W(XS))
+
+#define cgtqx_ld(XG, MS, DS)                                                \
+        cgtqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtqx3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x06))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgtqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x06))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgtqn_rr(XG, XS)                                                    \
+        cgtqn3rr(W(XG), W(XG), W(XS))
+
+#define cgtqn_ld(XG, MS, DS)                                                \
+        cgtqn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtqn3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x06))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgtqn3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x06))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#define cgeqx_rr(XG, XS)                                                    \
+        cgeqx3rr(W(XG), W(XG), W(XS))
+
+#define cgeqx_ld(XG, MS, DS)                                                \
+        cgeqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgeqx3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgeqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1E)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x05))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#define cgeqn_rr(XG, XS)                                                    \
+        cgeqn3rr(W(XG), W(XG), W(XS))
+
+#define cgeqn_ld(XG, MS, DS)                                                \
+        cgeqn3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgeqn3rr(XD, XS, XT)                                                \
+        EVW(0,       RXB(XT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+#define cgeqn3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 1, 3) EMITB(0x1F)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x05))                                  \
+        mz1qx_ld(W(XD), Mebp, inf_GPC07)
+
+
+/*****************   packed double-precision gather/scatter   *****************/
+
+/* gat (D[i] = [RB + I[i] * 8]) if (#D != #I), uses k1 as mask register
+ * destroys k1 */
+
+#define gatqx_ld(XD, RB, XI)                                                \
+        EMITB(0xC5) EMITB(0xF4) EMITB(0x46) EMITB(0xC9) /* kxnorw */        \
+    ADR EKW(RXB(XD), RXB(RB) | (RXB(XI) & 1) << 1, REN(XI) & 0x10, K, 1, 2) \
+        EMITB(0x93) MRM(REG(XD), 0x01, 0x04)                                \
+        AUX(EMITB(0xC0 | REG(XI) << 3 | REG(RB)), EMITB(0x00), EMPTY)
+
+/* sct ([RB + I[i] * 8] = S[i]), uses k1 as mask register
+ * destroys k1 */
+
+#define sctqx_st(XS, RB, XI)                                                \
+        EMITB(0xC5) EMITB(0xF4) EMITB(0x46) EMITB(0xC9) /* kxnorw */        \
+    ADR EKW(RXB(XS), RXB(RB) | (RXB(XI) & 1) << 1, REN(XI) & 0x10, K, 1, 2) \
+        EMITB(0xA3) MRM(REG(XS), 0x01, 0x04)                                \
+        AUX(EMITB(0xC0 | REG(XI) << 3 | REG(RB)), EMITB(0x00), EMPTY)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
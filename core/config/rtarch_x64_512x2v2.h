@@ -163,6 +163,89 @@
         MRM(0x01,       0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)
 
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))               \
+        EVW(RMB(XD), RMB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define iloqx_rr(XG, XS)                                                    \
+        iloqx3rr(W(XG), W(XG), W(XS))
+
+#define iloqx_ld(XG, MS, DS)                                                \
+        iloqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVW(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihiqx_rr(XG, XS)                                                    \
+        ihiqx3rr(W(XG), W(XG), W(XS))
+
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihiqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(RMB(XD), RMB(XT), REM(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVW(RMB(XD), RXB(MT), REM(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revqx_rx(XG)                                                        \
+        revqx_rr(W(XG), W(XG))
+
+#define revqx_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(RXB(XD), RXB(XD), REN(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVW(RMB(XD), RMB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(RMB(XD), RMB(XD), REM(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVW(RXB(XD), RMB(XD), REN(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(RMB(XD), RXB(XD), REM(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(RXB(XD), RMB(XD), REN(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 #if (RT_512X2 < 2)
 
 /* and (G = G & S), (D = S & T) if (#D != #S) */
@@ -858,6 +941,26 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_1K4))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbqx_rr(RD, XS)                                                    \
+        ck1qx_rm(X(XS), Mebp, inf_GPC07)                                    \
+        VEX(1,             0,    0x00, 0, 0, 1) EMITB(0x93)                 \
+        MRM(0x07,       0x03, 0x01)                                         \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x04,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))                                  \
+        ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))                                                     \
+        REX(RXB(RD),       1) EMITB(0x0B)                                   \
+        MRM(REG(RD),    0x03, 0x07)
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcqx_rr(RD, XS)                                                    \
+        mkbqx_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1294,6 +1397,61 @@
 
 #endif /* RT_512X2 >= 2 */
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RMB(XD),    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(RMB(XD), RMB(XD),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhqs_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RMB(XS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(RMB(XS), RMB(XD),    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(RMB(XD), RMB(XD),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x60))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -201,6 +201,133 @@
         MRM(0x01,       0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)
 
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        EVW(0,             0,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))               \
+        EVW(1,             1,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))               \
+        EVW(2,             2,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))               \
+        EVW(3,             3,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT) & 0x03) * 0x55))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define iloqx_rr(XG, XS)                                                    \
+        iloqx3rr(W(XG), W(XG), W(XS))
+
+#define iloqx_ld(XG, MS, DS)                                                \
+        iloqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define iloqx3rr(XD, XS, XT)                                                \
+        EVW(0,             0, REG(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(1,             1, REH(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(2,             2, REI(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(3,             3, REJ(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REG(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVW(1,       RXB(MT), REH(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)                                 \
+    ADR EVW(2,       RXB(MT), REI(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VSL(DT)), EMPTY)                                 \
+    ADR EVW(3,       RXB(MT), REJ(XS), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VTL(DT)), EMPTY)
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihiqx_rr(XG, XS)                                                    \
+        ihiqx3rr(W(XG), W(XG), W(XS))
+
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihiqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ihiqx3rr(XD, XS, XT)                                                \
+        EVW(0,             0, REG(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(1,             1, REH(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(2,             2, REI(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EVW(3,             3, REJ(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+    ADR EVW(0,       RXB(MT), REG(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EVW(1,       RXB(MT), REH(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)                                 \
+    ADR EVW(2,       RXB(MT), REI(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VSL(DT)), EMPTY)                                 \
+    ADR EVW(3,       RXB(MT), REJ(XS), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VTL(DT)), EMPTY)
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revqx_rx(XG)                                                        \
+        revqx_rr(W(XG), W(XG))
+
+#define revqx_rr(XD, XS)                                                    \
+        EVW(0,             0,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(0,             0, REG(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVW(1,             1,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(1,             1, REH(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVW(2,             2,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(2,             2, REI(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVW(3,             3,    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x55))                                  \
+        EVW(3,             3, REJ(XD), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x1B))                                  \
+        EVW(0,             3, REG(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(3,             0, REJ(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(0,             3, REG(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(1,             2, REH(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(2,             1, REI(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVW(1,             2, REH(XD), K, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 #if (RT_512X4 < 2)
 
 /* and (G = G & S), (D = S & T) if (#D != #S) */
@@ -1188,6 +1315,40 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_2K8))                     \
         jeqxx_lb(lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbqx_rr(RD, XS)                                                    \
+        ck1qx_rm(Z(XS), Mebp, inf_GPC07)                                    \
+        VEX(1,             0,    0x00, 0, 0, 1) EMITB(0x93)                 \
+        MRM(0x07,       0x03, 0x01)                                         \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x04,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))                                  \
+        ck1qx_rm(X(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))                                                     \
+        REX(1,       RXB(RD)) EMITB(0x0B)                                   \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x04,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(0x10))                                  \
+        ck1qx_rm(V(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))                                                     \
+        REX(0,       RXB(RD)) EMITB(0xC1)                                   \
+        MRM(0x04,    MOD(RD), REG(RD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))                                  \
+        REX(1,       RXB(RD)) EMITB(0x0B)                                   \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))                                                     \
+        REX(RXB(RD),       1) EMITB(0x0B)                                   \
+        MRM(REG(RD),    0x03, 0x07)
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcqx_rr(RD, XS)                                                    \
+        mkbqx_rr(W(RD), W(XS))                                              \
+        pcnwx_rr(W(RD), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1848,6 +2009,95 @@
 
 #endif /* RT_512X4 >= 2 */
 
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        EVW(1,             3,    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(3,             3,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(2,             1,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(0,             1,    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(1,             1,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(0,             0,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhqs_rr(XD, XS)                                                    \
+        EVX(0,             2,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(2,             1,    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(1,             1,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(2,             3,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(3,             3,    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(3,             3,    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0x80))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x20))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0x80))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0x60))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0x80))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        cvxds_ld(W(XD), Mebp, inf_SCR02(0xC0))                              \
+        mvhcs_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movcx_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
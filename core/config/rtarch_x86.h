@@ -1390,6 +1390,20 @@
 
      /* adrpx_ld(RD, MS, DS) in 32-bit rtarch_***_***.h files, SIMD-aligned */
 
+/* prf (prefetch line at S into L1/L2 data-cache)
+ * set-flags: no
+ * hint only, doesn't fault on invalid addresses, may be ignored by the core */
+
+#define prfxx_l1(MS, DS)                                                    \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(0x01,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define prfxx_l2(MS, DS)                                                    \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(0x02,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1415,6 +1429,52 @@
         MRM(0x04,    MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+#if   (defined RT_DYNAMIC_CODE)
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        code_jump(__Code__, #lb, 0xEB); /* jmp */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        code_jump(__Code__, #lb, 0x74); /* jz */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        code_jump(__Code__, #lb, 0x75); /* jnz */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x74); /* je */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x75); /* jne */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x72); /* jb */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x76); /* jbe */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x77); /* ja */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x73); /* jae */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7C); /* jl */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7E); /* jle */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7F); /* jg */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, #lb, 0x7D); /* jge */
+
+#define LBL(lb)                                          /* code label */   \
+        code_label(__Code__, #lb);
+
+#else /* RT_DYNAMIC_CODE */
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(jmp, lb) ASM_END
 
@@ -1457,6 +1517,8 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#endif /* RT_DYNAMIC_CODE */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
@@ -480,7 +480,7 @@
         movix_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmais_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmais_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -570,7 +570,7 @@
         movix_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsis_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsis_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -1868,7 +1868,7 @@
         movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmars_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmars_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -1946,7 +1946,7 @@
         movrs_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         fmsrs_rx(W(XG))
 
-#elif RT_SIMD_COMPAT_FMR == 1
+#elif RT_SIMD_COMPAT_FMR >= 1
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         mxcsr_st(Mebp,  inf_SCR02(0))                                       \
@@ -316,6 +316,18 @@ typedef const char         *rt_pstr;
 
 #define RT_POW32(a, b)      (powf(a, b))
 
+#define RT_EXP32(a)         (expf(a))
+
+#define RT_LOG32(a)         (logf(a))
+
+#define RT_SIN32(a)         (sinf(a))
+
+#define RT_COS32(a)         (cosf(a))
+
+#define RT_ATAN2_32(a, b)   (atan2f(a, b))
+
+#define RT_FMA32(a, b, c)   (fmaf(a, b, c))
+
 #define RT_SQRT32(a)        ((a)  <=   0.0f ?  0.0f :                       \
                              sqrtf(a))
 
@@ -362,6 +374,18 @@ typedef const char         *rt_pstr;
 
 #define RT_POW64(a, b)      (pow(a, b))
 
+#define RT_EXP64(a)         (exp(a))
+
+#define RT_LOG64(a)         (log(a))
+
+#define RT_SIN64(a)         (sin(a))
+
+#define RT_COS64(a)         (cos(a))
+
+#define RT_ATAN2_64(a, b)   (atan2(a, b))
+
+#define RT_FMA64(a, b, c)   (fma(a, b, c))
+
 #define RT_SQRT64(a)        ((a)  <=   0.0 ?  0.0 :                         \
                              sqrt(a))
 
@@ -400,6 +424,12 @@ typedef const char         *rt_pstr;
 #define RT_CEIL(a)          RT_CEIL32(a)
 #define RT_SIGN(a)          RT_SIGN32(a)
 #define RT_POW(a, b)        RT_POW32(a, b)
+#define RT_EXP(a)           RT_EXP32(a)
+#define RT_LOG(a)           RT_LOG32(a)
+#define RT_SIN(a)           RT_SIN32(a)
+#define RT_COS(a)           RT_COS32(a)
+#define RT_ATAN2(a, b)      RT_ATAN2_32(a, b)
+#define RT_FMA(a, b, c)     RT_FMA32(a, b, c)
 #define RT_SQRT(a)          RT_SQRT32(a)
 #define RT_ASIN(a)          RT_ASIN32(a)
 #define RT_ACOS(a)          RT_ACOS32(a)
@@ -415,6 +445,12 @@ typedef const char         *rt_pstr;
 #define RT_CEIL(a)          RT_CEIL64(a)
 #define RT_SIGN(a)          RT_SIGN64(a)
 #define RT_POW(a, b)        RT_POW64(a, b)
+#define RT_EXP(a)           RT_EXP64(a)
+#define RT_LOG(a)           RT_LOG64(a)
+#define RT_SIN(a)           RT_SIN64(a)
+#define RT_COS(a)           RT_COS64(a)
+#define RT_ATAN2(a, b)      RT_ATAN2_64(a, b)
+#define RT_FMA(a, b, c)     RT_FMA64(a, b, c)
 #define RT_SQRT(a)          RT_SQRT64(a)
 #define RT_ASIN(a)          RT_ASIN64(a)
 #define RT_ACOS(a)          RT_ACOS64(a)
@@ -527,14 +563,306 @@ struct rt_SIMD_INFO
 
 #endif /* RT_ELEMENT */
 
-
+/*
+ * SIMD regs structure for ASM_ENTER/ASM_LEAVE contains register file storage
+ * and constant tables for transcendental, pseudo-random and fp16 conversion
+ * meta-instructions, kept out of the info structure to keep its layout fixed.
+ * Tables are addressed with Iebp and DF offsets below, Reax holding inf_REGS
+ * minus Rebp (destroyed), as Reax is the only BASE reg free to clobber.
+ * Structure is read-write in backend.
+ */
 struct rt_SIMD_REGS
 {
-    /* register file */
+    /* register file, also fits full AVX-512 regs saved by 128-bit target */
 
-    rt_real file[S*64];
+    rt_real file[S*128];
 #define reg_FILE            DP(Q*0x000)
 
+    /* math constants for exp/log/pow (32-bit) */
+
+    rt_fp32 log2e_32[R];    /* +1.4426950216e+00f */
+#define reg_LOG2E_32        DF(Q*0x800)
+
+    rt_fp32 ln2hi_32[R];    /* +6.9314575195e-01f */
+#define reg_LN2HI_32        DF(Q*0x810)
+
+    rt_fp32 ln2lo_32[R];    /* +1.4286067653e-06f */
+#define reg_LN2LO_32        DF(Q*0x820)
+
+    rt_fp32 exphi_32[R];    /* +8.8722831726e+01f */
+#define reg_EXPHI_32        DF(Q*0x830)
+
+    rt_fp32 explo_32[R];    /* -8.7336540222e+01f */
+#define reg_EXPLO_32        DF(Q*0x840)
+
+    rt_fp32 expp1_32[R];    /* +1.6666625440e-01f */
+#define reg_EXPP1_32        DF(Q*0x850)
+
+    rt_fp32 expp2_32[R];    /* -2.7667332906e-03f */
+#define reg_EXPP2_32        DF(Q*0x860)
+
+    rt_fp32 sqrth_32[R];    /* +7.0710676908e-01f */
+#define reg_SQRTH_32        DF(Q*0x870)
+
+    rt_fp32 logl1_32[R];    /* +6.6666662693e-01f */
+#define reg_LOGL1_32        DF(Q*0x880)
+
+    rt_fp32 logl2_32[R];    /* +4.0000972152e-01f */
+#define reg_LOGL2_32        DF(Q*0x890)
+
+    rt_fp32 logl3_32[R];    /* +2.8498786688e-01f */
+#define reg_LOGL3_32        DF(Q*0x8A0)
+
+    rt_fp32 logl4_32[R];    /* +2.4279078841e-01f */
+#define reg_LOGL4_32        DF(Q*0x8B0)
+
+    /* math constants for exp/log/pow (64-bit) */
+
+    rt_fp64 log2e_64[T];    /* +1.44269504088896338700e+00 */
+#define reg_LOG2E_64        DF(Q*0x8C0)
+
+    rt_fp64 ln2hi_64[T];    /* +6.93147180369123816490e-01 */
+#define reg_LN2HI_64        DF(Q*0x8D0)
+
+    rt_fp64 ln2lo_64[T];    /* +1.90821492927058770002e-10 */
+#define reg_LN2LO_64        DF(Q*0x8E0)
+
+    rt_fp64 exphi_64[T];    /* +7.09782712893000000000e+02 */
+#define reg_EXPHI_64        DF(Q*0x8F0)
+
+    rt_fp64 explo_64[T];    /* -7.08396418532264106224e+02 */
+#define reg_EXPLO_64        DF(Q*0x900)
+
+    rt_fp64 expp1_64[T];    /* +1.66666666666666019037e-01 */
+#define reg_EXPP1_64        DF(Q*0x910)
+
+    rt_fp64 expp2_64[T];    /* -2.77777777770155933842e-03 */
+#define reg_EXPP2_64        DF(Q*0x920)
+
+    rt_fp64 expp3_64[T];    /* +6.61375632143793436117e-05 */
+#define reg_EXPP3_64        DF(Q*0x930)
+
+    rt_fp64 expp4_64[T];    /* -1.65339022054652515390e-06 */
+#define reg_EXPP4_64        DF(Q*0x940)
+
+    rt_fp64 expp5_64[T];    /* +4.13813679705723846039e-08 */
+#define reg_EXPP5_64        DF(Q*0x950)
+
+    rt_fp64 sqrth_64[T];    /* +7.07106781186547524401e-01 */
+#define reg_SQRTH_64        DF(Q*0x960)
+
+    rt_fp64 logl1_64[T];    /* +6.66666666666673513e-01 */
+#define reg_LOGL1_64        DF(Q*0x970)
+
+    rt_fp64 logl2_64[T];    /* +3.99999999994094191e-01 */
+#define reg_LOGL2_64        DF(Q*0x980)
+
+    rt_fp64 logl3_64[T];    /* +2.85714287436623915e-01 */
+#define reg_LOGL3_64        DF(Q*0x990)
+
+    rt_fp64 logl4_64[T];    /* +2.22221984321497840e-01 */
+#define reg_LOGL4_64        DF(Q*0x9A0)
+
+    rt_fp64 logl5_64[T];    /* +1.81835721616180501e-01 */
+#define reg_LOGL5_64        DF(Q*0x9B0)
+
+    rt_fp64 logl6_64[T];    /* +1.53138376992093733e-01 */
+#define reg_LOGL6_64        DF(Q*0x9C0)
+
+    rt_fp64 logl7_64[T];    /* +1.47981986051165859e-01 */
+#define reg_LOGL7_64        DF(Q*0x9D0)
+
+    /* math constants for sin/cos/atan2 (32-bit) */
+
+    rt_fp32 rpio2_32[R];    /* +6.3661974669e-01f */
+#define reg_RPIO2_32        DF(Q*0x9E0)
+
+    rt_fp32 pio21_32[R];    /* +1.5707963705e+00f */
+#define reg_PIO21_32        DF(Q*0x9F0)
+
+    rt_fp32 pio22_32[R];    /* -4.3711388287e-08f */
+#define reg_PIO22_32        DF(Q*0xA00)
+
+    rt_fp32 pio23_32[R];    /* -1.7151245100e-15f */
+#define reg_PIO23_32        DF(Q*0xA10)
+
+    rt_fp32 sinp1_32[R];    /* -1.6666655242e-01f */
+#define reg_SINP1_32        DF(Q*0xA20)
+
+    rt_fp32 sinp2_32[R];    /* +8.3321612328e-03f */
+#define reg_SINP2_32        DF(Q*0xA30)
+
+    rt_fp32 sinp3_32[R];    /* -1.9515295571e-04f */
+#define reg_SINP3_32        DF(Q*0xA40)
+
+    rt_fp32 cosp1_32[R];    /* +4.1666645557e-02f */
+#define reg_COSP1_32        DF(Q*0xA50)
+
+    rt_fp32 cosp2_32[R];    /* -1.3887316454e-03f */
+#define reg_COSP2_32        DF(Q*0xA60)
+
+    rt_fp32 cosp3_32[R];    /* +2.4433156796e-05f */
+#define reg_COSP3_32        DF(Q*0xA70)
+
+    rt_fp32 tanp8_32[R];    /* +4.1421356797e-01f */
+#define reg_TANP8_32        DF(Q*0xA80)
+
+    rt_fp32 pio4_32[R];     /* +7.8539818525e-01f */
+#define reg_PIO4_32         DF(Q*0xA90)
+
+    rt_fp32 pio2_32[R];     /* +1.5707963705e+00f */
+#define reg_PIO2_32         DF(Q*0xAA0)
+
+    rt_fp32 pi_32[R];       /* +3.1415927410e+00f */
+#define reg_PI_32           DF(Q*0xAB0)
+
+    rt_fp32 atnp1_32[R];    /* -3.3332949877e-01f */
+#define reg_ATNP1_32        DF(Q*0xAC0)
+
+    rt_fp32 atnp2_32[R];    /* +1.9977711141e-01f */
+#define reg_ATNP2_32        DF(Q*0xAD0)
+
+    rt_fp32 atnp3_32[R];    /* -1.3877685368e-01f */
+#define reg_ATNP3_32        DF(Q*0xAE0)
+
+    rt_fp32 atnp4_32[R];    /* +8.0537445843e-02f */
+#define reg_ATNP4_32        DF(Q*0xAF0)
+
+    /* math constants for sin/cos/atan2 (64-bit) */
+
+    rt_fp64 rpio2_64[T];    /* +6.36619772367581382433e-01 */
+#define reg_RPIO2_64        DF(Q*0xB00)
+
+    rt_fp64 pio21_64[T];    /* +1.57079632673412561417e+00 */
+#define reg_PIO21_64        DF(Q*0xB10)
+
+    rt_fp64 pio22_64[T];    /* +6.07710050630396597660e-11 */
+#define reg_PIO22_64        DF(Q*0xB20)
+
+    rt_fp64 pio23_64[T];    /* +2.02226624871116645580e-21 */
+#define reg_PIO23_64        DF(Q*0xB30)
+
+    rt_fp64 sinp1_64[T];    /* -1.66666666666666324348e-01 */
+#define reg_SINP1_64        DF(Q*0xB40)
+
+    rt_fp64 sinp2_64[T];    /* +8.33333333332248946124e-03 */
+#define reg_SINP2_64        DF(Q*0xB50)
+
+    rt_fp64 sinp3_64[T];    /* -1.98412698298579493134e-04 */
+#define reg_SINP3_64        DF(Q*0xB60)
+
+    rt_fp64 sinp4_64[T];    /* +2.75573137070700676789e-06 */
+#define reg_SINP4_64        DF(Q*0xB70)
+
+    rt_fp64 sinp5_64[T];    /* -2.50507602534068634195e-08 */
+#define reg_SINP5_64        DF(Q*0xB80)
+
+    rt_fp64 sinp6_64[T];    /* +1.58969099521155010221e-10 */
+#define reg_SINP6_64        DF(Q*0xB90)
+
+    rt_fp64 cosp1_64[T];    /* +4.16666666666666019037e-02 */
+#define reg_COSP1_64        DF(Q*0xBA0)
+
+    rt_fp64 cosp2_64[T];    /* -1.38888888888741095749e-03 */
+#define reg_COSP2_64        DF(Q*0xBB0)
+
+    rt_fp64 cosp3_64[T];    /* +2.48015872894767294178e-05 */
+#define reg_COSP3_64        DF(Q*0xBC0)
+
+    rt_fp64 cosp4_64[T];    /* -2.75573143513906633035e-07 */
+#define reg_COSP4_64        DF(Q*0xBD0)
+
+    rt_fp64 cosp5_64[T];    /* +2.08757232129817482790e-09 */
+#define reg_COSP5_64        DF(Q*0xBE0)
+
+    rt_fp64 cosp6_64[T];    /* -1.13596475577881948265e-11 */
+#define reg_COSP6_64        DF(Q*0xBF0)
+
+    rt_fp64 tanp8_64[T];    /* +4.14213562373095034452e-01 */
+#define reg_TANP8_64        DF(Q*0xC00)
+
+    rt_fp64 pio4_64[T];     /* +7.85398163397448278999e-01 */
+#define reg_PIO4_64         DF(Q*0xC10)
+
+    rt_fp64 pio2_64[T];     /* +1.57079632679489655800e+00 */
+#define reg_PIO2_64         DF(Q*0xC20)
+
+    rt_fp64 pi_64[T];       /* +3.14159265358979311600e+00 */
+#define reg_PI_64           DF(Q*0xC30)
+
+    rt_fp64 atnp1_64[T];    /* -3.33333333333329318027e-01 */
+#define reg_ATNP1_64        DF(Q*0xC40)
+
+    rt_fp64 atnp2_64[T];    /* +1.99999999998764832476e-01 */
+#define reg_ATNP2_64        DF(Q*0xC50)
+
+    rt_fp64 atnp3_64[T];    /* -1.42857142725034663711e-01 */
+#define reg_ATNP3_64        DF(Q*0xC60)
+
+    rt_fp64 atnp4_64[T];    /* +1.11111104054623557880e-01 */
+#define reg_ATNP4_64        DF(Q*0xC70)
+
+    rt_fp64 atnp5_64[T];    /* -9.09088713343650656196e-02 */
+#define reg_ATNP5_64        DF(Q*0xC80)
+
+    rt_fp64 atnp6_64[T];    /* +7.69187620504482999495e-02 */
+#define reg_ATNP6_64        DF(Q*0xC90)
+
+    rt_fp64 atnp7_64[T];    /* -6.66107313738753120669e-02 */
+#define reg_ATNP7_64        DF(Q*0xCA0)
+
+    rt_fp64 atnp8_64[T];    /* +5.83357013379057348645e-02 */
+#define reg_ATNP8_64        DF(Q*0xCB0)
+
+    rt_fp64 atnp9_64[T];    /* -4.97687799461593236017e-02 */
+#define reg_ATNP9_64        DF(Q*0xCC0)
+
+    rt_fp64 atnp10_64[T];   /* +3.65315727442169155270e-02 */
+#define reg_ATNP10_64       DF(Q*0xCD0)
+
+    rt_fp64 atnp11_64[T];   /* -1.62858201153657823623e-02 */
+#define reg_ATNP11_64       DF(Q*0xCE0)
+
+    /* pseudo-random generator multipliers */
+
+    rt_si32 rngm_32[R];     /* 0x9E3779BB */
+#define reg_RNGM_32         DF(Q*0xCF0)
+
+    rt_si64 rngm_64[T];     /* 0x2545F4914F6CDD1D */
+#define reg_RNGM_64         DF(Q*0xD00)
+
+    /* fp16 storage conversion constants */
+
+    rt_si32 hlf01_32[R];    /* 0x8FFFE000 */
+#define reg_HLF01_32        DF(Q*0xD10)
+
+    rt_si32 hlf02_32[R];    /* 0x77800000 */
+#define reg_HLF02_32        DF(Q*0xD20)
+
+    rt_si32 hlf03_32[R];    /* 0x47800000 */
+#define reg_HLF03_32        DF(Q*0xD30)
+
+    rt_si32 hlf04_32[R];    /* 0x7F800000 */
+#define reg_HLF04_32        DF(Q*0xD40)
+
+    rt_si32 hlf05_32[R];    /* 0x08800000 */
+#define reg_HLF05_32        DF(Q*0xD50)
+
+    rt_si32 hlf06_32[R];    /* 0x38800000 */
+#define reg_HLF06_32        DF(Q*0xD60)
+
+    rt_si32 hlf07_32[R];    /* 0x47000000 */
+#define reg_HLF07_32        DF(Q*0xD70)
+
+    rt_si32 hlf08_32[R];    /* 0x7FC00200 */
+#define reg_HLF08_32        DF(Q*0xD80)
+
+    rt_si32 hlf09_32[R];    /* 0x00007C00 */
+#define reg_HLF09_32        DF(Q*0xD90)
+
+    rt_si32 hlf10_32[R];    /* 0x80000FFF */
+#define reg_HLF10_32        DF(Q*0xDA0)
+
 };
 
 #define ASM_INIT(__Info__, __Regs__)                                        \
@@ -551,10 +879,179 @@ struct rt_SIMD_REGS
     RT_SIMD_SET64(__Info__->gpc04_64, LL(0x7FFFFFFFFFFFFFFF));              \
     RT_SIMD_SET64(__Info__->gpc05_64, LL(0x3FF0000000000000));              \
     RT_SIMD_SET64(__Info__->gpc06_64, LL(0x8000000000000000));              \
+    RT_SIMD_SET32(__Regs__->log2e_32, +1.4426950216e+00f);                  \
+    RT_SIMD_SET32(__Regs__->ln2hi_32, +6.9314575195e-01f);                  \
+    RT_SIMD_SET32(__Regs__->ln2lo_32, +1.4286067653e-06f);                  \
+    RT_SIMD_SET32(__Regs__->exphi_32, +8.8722831726e+01f);                  \
+    RT_SIMD_SET32(__Regs__->explo_32, -8.7336540222e+01f);                  \
+    RT_SIMD_SET32(__Regs__->expp1_32, +1.6666625440e-01f);                  \
+    RT_SIMD_SET32(__Regs__->expp2_32, -2.7667332906e-03f);                  \
+    RT_SIMD_SET32(__Regs__->sqrth_32, +7.0710676908e-01f);                  \
+    RT_SIMD_SET32(__Regs__->logl1_32, +6.6666662693e-01f);                  \
+    RT_SIMD_SET32(__Regs__->logl2_32, +4.0000972152e-01f);                  \
+    RT_SIMD_SET32(__Regs__->logl3_32, +2.8498786688e-01f);                  \
+    RT_SIMD_SET32(__Regs__->logl4_32, +2.4279078841e-01f);                  \
+    RT_SIMD_SET64(__Regs__->log2e_64, +1.44269504088896338700e+00);         \
+    RT_SIMD_SET64(__Regs__->ln2hi_64, +6.93147180369123816490e-01);         \
+    RT_SIMD_SET64(__Regs__->ln2lo_64, +1.90821492927058770002e-10);         \
+    RT_SIMD_SET64(__Regs__->exphi_64, +7.09782712893000000000e+02);         \
+    RT_SIMD_SET64(__Regs__->explo_64, -7.08396418532264106224e+02);         \
+    RT_SIMD_SET64(__Regs__->expp1_64, +1.66666666666666019037e-01);         \
+    RT_SIMD_SET64(__Regs__->expp2_64, -2.77777777770155933842e-03);         \
+    RT_SIMD_SET64(__Regs__->expp3_64, +6.61375632143793436117e-05);         \
+    RT_SIMD_SET64(__Regs__->expp4_64, -1.65339022054652515390e-06);         \
+    RT_SIMD_SET64(__Regs__->expp5_64, +4.13813679705723846039e-08);         \
+    RT_SIMD_SET64(__Regs__->sqrth_64, +7.07106781186547524401e-01);         \
+    RT_SIMD_SET64(__Regs__->logl1_64, +6.66666666666673513e-01);            \
+    RT_SIMD_SET64(__Regs__->logl2_64, +3.99999999994094191e-01);            \
+    RT_SIMD_SET64(__Regs__->logl3_64, +2.85714287436623915e-01);            \
+    RT_SIMD_SET64(__Regs__->logl4_64, +2.22221984321497840e-01);            \
+    RT_SIMD_SET64(__Regs__->logl5_64, +1.81835721616180501e-01);            \
+    RT_SIMD_SET64(__Regs__->logl6_64, +1.53138376992093733e-01);            \
+    RT_SIMD_SET64(__Regs__->logl7_64, +1.47981986051165859e-01);            \
+    RT_SIMD_SET32(__Regs__->rpio2_32, +6.3661974669e-01f);                  \
+    RT_SIMD_SET32(__Regs__->pio21_32, +1.5707963705e+00f);                  \
+    RT_SIMD_SET32(__Regs__->pio22_32, -4.3711388287e-08f);                  \
+    RT_SIMD_SET32(__Regs__->pio23_32, -1.7151245100e-15f);                  \
+    RT_SIMD_SET32(__Regs__->sinp1_32, -1.6666655242e-01f);                  \
+    RT_SIMD_SET32(__Regs__->sinp2_32, +8.3321612328e-03f);                  \
+    RT_SIMD_SET32(__Regs__->sinp3_32, -1.9515295571e-04f);                  \
+    RT_SIMD_SET32(__Regs__->cosp1_32, +4.1666645557e-02f);                  \
+    RT_SIMD_SET32(__Regs__->cosp2_32, -1.3887316454e-03f);                  \
+    RT_SIMD_SET32(__Regs__->cosp3_32, +2.4433156796e-05f);                  \
+    RT_SIMD_SET32(__Regs__->tanp8_32, +4.1421356797e-01f);                  \
+    RT_SIMD_SET32(__Regs__->pio4_32, +7.8539818525e-01f);                   \
+    RT_SIMD_SET32(__Regs__->pio2_32, +1.5707963705e+00f);                   \
+    RT_SIMD_SET32(__Regs__->pi_32, +3.1415927410e+00f);                     \
+    RT_SIMD_SET32(__Regs__->atnp1_32, -3.3332949877e-01f);                  \
+    RT_SIMD_SET32(__Regs__->atnp2_32, +1.9977711141e-01f);                  \
+    RT_SIMD_SET32(__Regs__->atnp3_32, -1.3877685368e-01f);                  \
+    RT_SIMD_SET32(__Regs__->atnp4_32, +8.0537445843e-02f);                  \
+    RT_SIMD_SET64(__Regs__->rpio2_64, +6.36619772367581382433e-01);         \
+    RT_SIMD_SET64(__Regs__->pio21_64, +1.57079632673412561417e+00);         \
+    RT_SIMD_SET64(__Regs__->pio22_64, +6.07710050630396597660e-11);         \
+    RT_SIMD_SET64(__Regs__->pio23_64, +2.02226624871116645580e-21);         \
+    RT_SIMD_SET64(__Regs__->sinp1_64, -1.66666666666666324348e-01);         \
+    RT_SIMD_SET64(__Regs__->sinp2_64, +8.33333333332248946124e-03);         \
+    RT_SIMD_SET64(__Regs__->sinp3_64, -1.98412698298579493134e-04);         \
+    RT_SIMD_SET64(__Regs__->sinp4_64, +2.75573137070700676789e-06);         \
+    RT_SIMD_SET64(__Regs__->sinp5_64, -2.50507602534068634195e-08);         \
+    RT_SIMD_SET64(__Regs__->sinp6_64, +1.58969099521155010221e-10);         \
+    RT_SIMD_SET64(__Regs__->cosp1_64, +4.16666666666666019037e-02);         \
+    RT_SIMD_SET64(__Regs__->cosp2_64, -1.38888888888741095749e-03);         \
+    RT_SIMD_SET64(__Regs__->cosp3_64, +2.48015872894767294178e-05);         \
+    RT_SIMD_SET64(__Regs__->cosp4_64, -2.75573143513906633035e-07);         \
+    RT_SIMD_SET64(__Regs__->cosp5_64, +2.08757232129817482790e-09);         \
+    RT_SIMD_SET64(__Regs__->cosp6_64, -1.13596475577881948265e-11);         \
+    RT_SIMD_SET64(__Regs__->tanp8_64, +4.14213562373095034452e-01);         \
+    RT_SIMD_SET64(__Regs__->pio4_64, +7.85398163397448278999e-01);          \
+    RT_SIMD_SET64(__Regs__->pio2_64, +1.57079632679489655800e+00);          \
+    RT_SIMD_SET64(__Regs__->pi_64, +3.14159265358979311600e+00);            \
+    RT_SIMD_SET64(__Regs__->atnp1_64, -3.33333333333329318027e-01);         \
+    RT_SIMD_SET64(__Regs__->atnp2_64, +1.99999999998764832476e-01);         \
+    RT_SIMD_SET64(__Regs__->atnp3_64, -1.42857142725034663711e-01);         \
+    RT_SIMD_SET64(__Regs__->atnp4_64, +1.11111104054623557880e-01);         \
+    RT_SIMD_SET64(__Regs__->atnp5_64, -9.09088713343650656196e-02);         \
+    RT_SIMD_SET64(__Regs__->atnp6_64, +7.69187620504482999495e-02);         \
+    RT_SIMD_SET64(__Regs__->atnp7_64, -6.66107313738753120669e-02);         \
+    RT_SIMD_SET64(__Regs__->atnp8_64, +5.83357013379057348645e-02);         \
+    RT_SIMD_SET64(__Regs__->atnp9_64, -4.97687799461593236017e-02);         \
+    RT_SIMD_SET64(__Regs__->atnp10_64, +3.65315727442169155270e-02);        \
+    RT_SIMD_SET64(__Regs__->atnp11_64, -1.62858201153657823623e-02);        \
+    RT_SIMD_SET32(__Regs__->rngm_32, 0x9E3779BB);                           \
+    RT_SIMD_SET64(__Regs__->rngm_64, LL(0x2545F4914F6CDD1D));               \
+    RT_SIMD_SET32(__Regs__->hlf01_32, 0x8FFFE000);                          \
+    RT_SIMD_SET32(__Regs__->hlf02_32, 0x77800000);                          \
+    RT_SIMD_SET32(__Regs__->hlf03_32, 0x47800000);                          \
+    RT_SIMD_SET32(__Regs__->hlf04_32, 0x7F800000);                          \
+    RT_SIMD_SET32(__Regs__->hlf05_32, 0x08800000);                          \
+    RT_SIMD_SET32(__Regs__->hlf06_32, 0x38800000);                          \
+    RT_SIMD_SET32(__Regs__->hlf07_32, 0x47000000);                          \
+    RT_SIMD_SET32(__Regs__->hlf08_32, 0x7FC00200);                          \
+    RT_SIMD_SET32(__Regs__->hlf09_32, 0x00007C00);                          \
+    RT_SIMD_SET32(__Regs__->hlf10_32, 0x80000FFF);                          \
     __Info__->regs = (rt_ui64)(rt_word)__Regs__;
 
 #define ASM_DONE(__Info__)
 
+/*
+ * Targets without lightweight ASM_ENTER_L/ASM_LEAVE_L (RISCs with hidden temps,
+ * MSVC, RT_DYNAMIC_CODE) fall back to heavy versions, ignoring declarations.
+ */
+
+#ifndef ASM_ENTER_L
+#define ASM_ENTER_L(__Info__, __Regs__) ASM_ENTER(__Info__)
+#define ASM_LEAVE_L(__Info__, __Regs__) ASM_LEAVE(__Info__)
+#endif /* ASM_ENTER_L */
+
+/*
+ * Clearing upper halves of SIMD registers (vzero_xx) is only needed on x86
+ * AVX targets, where it is also done in ASM_LEAVE (see RT_SIMD_COMPAT_VZU).
+ */
+
+#ifndef vzero_xx
+#define vzero_xx()
+#endif /* vzero_xx */
+
+/*
+ * Batched dispatch runs the code between batch_beg/batch_end over an array
+ * of work items within a single ASM_ENTER/ASM_LEAVE, paying entry cost once.
+ * The descriptor is kept in the entered info structure at displacements:
+ * DP - P-size pointer to the current work item (advanced in place),
+ * DC - 32-bit number of work items (counted down to 0 in place, must be > 0),
+ * DS - 32-bit non-negative stride between work items in bytes.
+ * RD is loaded with the current work item pointer on each iteration,
+ * while Mebp still refers to the entered info for constants and FCTRL,
+ * Reax is destroyed in batch_end, other registers carry over to next item.
+ */
+
+#define batch_beg(RD, DP, lb)                                               \
+        LBL(lb)                                                             \
+        movxx_ld(W(RD), Mebp, W(DP))
+
+#define batch_end(DP, DC, DS, lb)                                           \
+        movwx_ld(Reax, Mebp, W(DS))                                         \
+        addxx_st(Reax, Mebp, W(DP))                                         \
+        arjwx_mi(Mebp, W(DC), IB(1),                                        \
+        sub_x,   NZ_x, lb)
+
+/*
+ * Strip-mined loop runs the code between strip_beg/strip_end once per full
+ * SIMD register of the configurable-element subset (cmdp*), which allows
+ * the same kernel to cover any number of elements at any SIMD width.
+ * RC is a BASE register with the 32-bit non-negative number of elements,
+ * it is reduced in place to the number of elements left for the tail,
+ * RN is used as the loop counter, the body must preserve both RC and RN,
+ * access memory at AJ0 from its pointers and advance them with strip_adv.
+ * The tail (RC < RT_SIMD_WIDTH) is then processed either in-register
+ * between strip_tail/strip_done, where the mask for mmzpx_ld/mmvpx_st
+ * is prepared in Xmm0 (destroying Reax), or element-wise with scalar ops.
+ */
+
+#define strip_beg(RC, RN, lb, le)                                           \
+        movwx_rr(W(RN), W(RC))                                              \
+        andwx_ri(W(RC), IB(RT_SIMD_WIDTH-1))                                \
+        subwx_rr(W(RN), W(RC))                                              \
+        cmjwx_rz(W(RN),                                                     \
+        /* if */ EQ_x, le)                                                  \
+        LBL(lb)
+
+#define strip_end(RN, lb, le)                                               \
+        arjwx_ri(W(RN), IB(RT_SIMD_WIDTH),                                  \
+        sub_x,   NZ_x, lb)                                                  \
+        LBL(le)
+
+#define strip_adv(RP)                                                       \
+        addxx_ri(W(RP), IH(Q*0x010))
+
+#define strip_tail(RC, lt)                                                  \
+        cmjwx_rz(W(RC),                                                     \
+        /* if */ EQ_x, lt)                                                  \
+        mktpx_xr(W(RC))
+
+#define strip_done(lt)                                                      \
+        LBL(lt)
+
 /*
  * Return SIMD target mask (in rt_SIMD_INFO->ver format) from "simd" parameters:
  * SIMD native-size (1, 2, 4) in 0th (lowest) byte  <- number of 128-bit chunks
@@ -779,3516 +1276,9715 @@ rt_si32 from_mask(rt_si32 mask)
     return (v_regs << 24) | (k_size << 16) | (s_type << 8) | (n_simd);
 }
 
-/******************************************************************************/
-/************************   COMMON SIMD INSTRUCTIONS   ************************/
-/******************************************************************************/
-
 /*
- * Recommended naming scheme for instructions:
- *
- * cmdp*_ri - applies [cmd] to [p]acked: [r]egister from [i]mmediate
- * cmdp*_rr - applies [cmd] to [p]acked: [r]egister from [r]egister
- *
- * cmdp*_rm - applies [cmd] to [p]acked: [r]egister from [m]emory
- * cmdp*_ld - applies [cmd] to [p]acked: as above
- *
- * cmdi*_** - applies [cmd] to 32-bit SIMD element args, packed-128-bit
- * cmdj*_** - applies [cmd] to 64-bit SIMD element args, packed-128-bit
- * cmdl*_** - applies [cmd] to L-size SIMD element args, packed-128-bit
- *
- * cmdc*_** - applies [cmd] to 32-bit SIMD element args, packed-256-bit
- * cmdd*_** - applies [cmd] to 64-bit SIMD element args, packed-256-bit
- * cmdf*_** - applies [cmd] to L-size SIMD element args, packed-256-bit
- *
- * cmdo*_** - applies [cmd] to 32-bit SIMD element args, packed-var-len
- * cmdp*_** - applies [cmd] to L-size SIMD element args, packed-var-len
- * cmdq*_** - applies [cmd] to 64-bit SIMD element args, packed-var-len
- *
- * cmd*x_** - applies [cmd] to [p]acked unsigned integer args, [x] - default
- * cmd*n_** - applies [cmd] to [p]acked   signed integer args, [n] - negatable
- * cmd*s_** - applies [cmd] to [p]acked floating point   args, [s] - scalable
- *
- * The cmdp*_** (rtbase.h) instructions are intended for SPMD programming model
- * and can be configured to work with 32/64-bit data-elements (int, fp).
- * In this model data-paths are fixed-width, BASE and SIMD data-elements are
- * width-compatible, code-path divergence is handled via mkj**_** pseudo-ops.
- * Matching element-sized BASE subset cmdy*_** is defined in rtbase.h as well.
- *
- * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
- * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
- * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
- * This happens when registers written in 128-bit subset are then used/read
- * from within 256-bit subset. The same rule applies to mixing of 256/512-bit.
- *
- * Interpretation of instruction parameters:
- *
- * upper-case params have triplet structure and require W to pass-forward
- * lower-case params are singular and can be used/passed as such directly
- *
- * XD - SIMD register serving as destination only, if present
- * XG - SIMD register serving as destination and fisrt source
- * XS - SIMD register serving as second source (first if any)
- * XT - SIMD register serving as third source (second if any)
- *
- * RD - BASE register serving as destination only, if present
- * RG - BASE register serving as destination and fisrt source
- * RS - BASE register serving as second source (first if any)
- * RT - BASE register serving as third source (second if any)
- *
- * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
- * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
- * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
- * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
- *
- * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
- * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
- * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
- * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
- *
- * IS - immediate value (is used as a second or first source)
- * IT - immediate value (is used as a third or second source)
+ * Pick the widest SIMD target supported by "ver" (returned from verxx_xx)
+ * among "num" candidate targets in "list" (in rt_SIMD_INFO->ver format).
+ * Candidates are ranked by their parameters from from_mask: total width first,
+ * then native-size, then number of registers, then SIMD type (newer ISA),
+ * remaining ties are resolved in favour of the candidate coming first.
+ * Return index of the chosen candidate or -1 if none of them is supported.
  */
+static inline
+rt_si32 mask_pick(rt_si32 ver, rt_si32 *list, rt_si32 num)
+{
+    rt_si32 i, k = -1, simd, rank, best = 0;
 
-#if (defined RT_SIMD_CODE)
-
-/****************** original CHECK_MASK macro (configurable) ******************/
+    for (i = 0; i < num; i++)
+    {
+        if ((list[i] & ver) == 0 || mask_init(from_mask(list[i])) == 0)
+        {
+            continue;
+        }
 
-#define CHECK_MASK(lb, mask, XS) /* destroys Reax, jump lb if mask == S */  \
-        mkjpx_rx(W(XS), mask, lb)
+        simd = from_mask(list[i]);
+        rank = ((simd & 0xFF) * ((simd >> 16) & 0xFF)) << 24 |
+               ((simd & 0xFF) << 16) | ((simd >> 16) & 0xFF00) |
+               ((simd >> 8) & 0xFF);
 
-/****************** original FCTRL blocks (cannot be nested) ******************/
+        if (rank > best)
+        {
+            best = rank;
+            k = i;
+        }
+    }
 
-#define FCTRL_ENTER(mode) /* assumes default mode (ROUNDN) upon entry */    \
-        FCTRL_SET(mode)
+    return k;
+}
 
-#define FCTRL_LEAVE(mode) /* resumes default mode (ROUNDN) upon leave */    \
-        FCTRL_RESET()
+/*
+ * SIMD target of the current build config (in rt_SIMD_INFO->ver format).
+ * Used to check the target against the hardware (verxx_xx) and in builds
+ * with multiple SIMD targets (one per compilation unit) to pick the widest.
+ */
+#if   (RT_2K8_R8) && (RT_SIMD == 2048)
+#define RT_SIMD_TARGET      (RT_2K8_R8 << 0x1C)
+#elif (RT_1K4)    && (RT_SIMD == 1024)
+#define RT_SIMD_TARGET      (RT_1K4 << 0x18)
+#elif (RT_1K4_R8) && (RT_SIMD == 1024)
+#define RT_SIMD_TARGET      (RT_1K4_R8 << 0x14)
+#elif (RT_512)    && (RT_SIMD == 512)
+#define RT_SIMD_TARGET      (RT_512 << 0x10)
+#elif (RT_512_R8) && (RT_SIMD == 512)
+#define RT_SIMD_TARGET      (RT_512_R8 << 0x0C)
+#elif (RT_256)    && (RT_SIMD == 256)
+#define RT_SIMD_TARGET      (RT_256 << 0x08)
+#elif (RT_256_R8) && (RT_SIMD == 256)
+#define RT_SIMD_TARGET      (RT_256_R8 << 0x04)
+#elif (RT_128)    && (RT_SIMD == 128)
+#define RT_SIMD_TARGET      (RT_128 << 0x00)
+#else /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+#define RT_SIMD_TARGET      0
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
 /******************************************************************************/
-/**** var-len **** SIMD instructions with fixed-32-bit-element **** 512-bit ***/
+/************************   RUN-TIME CODE GENERATION   ************************/
 /******************************************************************************/
 
-#if   (RT_SIMD >= 512)
+#if   (defined RT_DYNAMIC_CODE)
+
+#if   !(defined ASM_CODE_ENTER)
+#error "run-time code generation is not supported on this target, check flags"
+#endif /* ASM_CODE_ENTER */
 
 /*
- * main block of var-len SIMD instructions is defined in 512/1K4/2K8-bit headers
+ * Initial size of the code buffer used in run-time code generation mode.
+ * The buffer is doubled each time the emitted code doesn't fit in it.
  */
+#ifndef RT_CODE_SIZE
+#define RT_CODE_SIZE        0x10000
+#endif /* RT_CODE_SIZE */
 
-/* cbr (D = cbrt S) */
+/*
+ * Initial number of labels and label references (fixups) in the code buffer.
+ * Both tables are doubled each time the new entry doesn't fit in them.
+ */
+#ifndef RT_CODE_LBLS
+#define RT_CODE_LBLS        0x40
+#endif /* RT_CODE_LBLS */
 
 /*
- * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
- * available at http://www.musicdsp.org/showone.php?id=206
- * converted to S-way SIMD version by VectorChief.
+ * Label reference kinds other than jumps (which are encoded with their opcode).
  */
-#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbeos_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsos_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsos_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsos_rr(W(XD), W(X1), W(X2), W(XS))
+#define RT_CODE_REL32       (-1)    /* 32-bit pc-relative field (to its end) */
+#define RT_CODE_ABS32       (-2)    /* 32-bit absolute address field */
 
-#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        /* cube root estimate, the exponent is divided by three             \
-         * in such a way that remainder bits get shoved into                \
-         * the top of the normalized mantissa */                            \
-        movox_ld(W(X2), Mebp, inf_GPC04_32)                                 \
-        movox_rr(W(XD), W(XS))                                              \
-        andox_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
-        subox_ld(W(XD), Mebp, inf_GPC05_32) /* convert to 2's complement */ \
-        shron_ri(W(XD), IB(10))  /* XD / 1024 */                            \
-        movox_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
-        shlox_ri(W(X1), IB(2))                                              \
-        addox_rr(W(XD), W(X1))                                              \
-        shlox_ri(W(X1), IB(2))                                              \
-        addox_rr(W(XD), W(X1))                                              \
-        shlox_ri(W(X1), IB(2))                                              \
-        addox_rr(W(XD), W(X1))                                              \
-        shlox_ri(W(X1), IB(2))                                              \
-        addox_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
-        addox_ld(W(XD), Mebp, inf_GPC05_32) /* back to biased-127 */        \
-        andox_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
+/*
+ * Function type of the code generated between ASM_CODE_ENTER/ASM_CODE_LEAVE.
+ */
+typedef rt_void (*rt_FUNC_CODE)(rt_pntr info);
+
+/*
+ * Label defined with LBL at given offset in the code buffer.
+ */
+struct rt_CODE_LABEL
+{
+    rt_pstr         name;   /* label's name as written in the source code */
+    rt_size         pos;    /* offset of the label (in bytes) */
+};
+
+/*
+ * Label reference (jump or address field) to be resolved in code_done.
+ */
+struct rt_CODE_FIXUP
+{
+    rt_pstr         name;   /* referenced label's name */
+    rt_size         pos;    /* offset of the instruction (or field) */
+    rt_si32         op;     /* short-form opcode for jumps, RT_CODE_* else */
+    rt_si32         len;    /* current size of the instruction (or field) */
+};
+
+/*
+ * Code buffer, EMITB/EMITW write into it at the current offset (cur++),
+ * code_done makes it executable, then it can be called via its function.
+ */
+struct rt_CODE
+{
+    /* code buffer */
+
+    rt_byte        *buf;    /* read-write while emitting, read-exec after */
+    rt_size         cap;    /* size of the buffer (in bytes) */
+    rt_size         pos;    /* current offset (in bytes) */
+
+    /* label tables */
+
+    rt_CODE_LABEL  *lbl;    /* labels defined so far */
+    rt_si32         lbl_num;
+    rt_si32         lbl_cap;
+
+    rt_CODE_FIXUP  *fix;    /* label references in the order of emission */
+    rt_si32         fix_num;
+    rt_si32         fix_cap;
+
+    /* entry point */
+
+    rt_FUNC_CODE    fnc;    /* RT_NULL until code_done is called */
+};
+
+/*
+ * Allocate read-write memory for the code buffer of given "size".
+ */
+static
+rt_byte *code_map(rt_size size)
+{
+#if   (defined RT_WIN32) || (defined RT_WIN64)
+    rt_pntr ptr = VirtualAlloc(RT_NULL, size, MEM_COMMIT | MEM_RESERVE,
+                                                        PAGE_READWRITE);
+#else /* RT_LINUX */
+    rt_pntr ptr = mmap(RT_NULL, size, PROT_READ | PROT_WRITE,
+                                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ptr = ptr != MAP_FAILED ? ptr : RT_NULL;
+#endif /* OS */
+
+    if (ptr == RT_NULL)
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    return (rt_byte *)ptr;
+}
+
+/*
+ * Release memory of the code buffer "buf" of given "size".
+ */
+static
+rt_void code_unmap(rt_byte *buf, rt_size size)
+{
+#if   (defined RT_WIN32) || (defined RT_WIN64)
+    VirtualFree(buf, 0, MEM_RELEASE);
+#else /* RT_LINUX */
+    munmap(buf, size);
+#endif /* OS */
+}
+
+/*
+ * Prepare the "code" buffer for emitting, return it for ASM_CODE_ENTER.
+ */
+static
+rt_CODE *code_init(rt_CODE *code)
+{
+    code->buf = code_map(RT_CODE_SIZE);
+    code->cap = RT_CODE_SIZE;
+    code->pos = 0;
+
+    code->lbl = (rt_CODE_LABEL *)malloc(RT_CODE_LBLS * sizeof(rt_CODE_LABEL));
+    code->lbl_num = 0;
+    code->lbl_cap = RT_CODE_LBLS;
+
+    code->fix = (rt_CODE_FIXUP *)malloc(RT_CODE_LBLS * sizeof(rt_CODE_FIXUP));
+    code->fix_num = 0;
+    code->fix_cap = RT_CODE_LBLS;
+
+    if (code->lbl == RT_NULL || code->fix == RT_NULL)
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    code->fnc = RT_NULL;
+
+    return code;
+}
+
+/*
+ * Double the size of the "code" buffer keeping already emitted code.
+ */
+static
+rt_void code_grow(rt_CODE *code)
+{
+    rt_byte *buf = code_map(code->cap * 2);
+
+    memcpy(buf, code->buf, code->pos);
+    code_unmap(code->buf, code->cap);
+
+    code->buf = buf;
+    code->cap = code->cap * 2;
+}
+
+/*
+ * Emit 1 byte into the "code" buffer (EMITB).
+ */
+static
+rt_void code_emitb(rt_CODE *code, rt_ui32 b)
+{
+    if (code->pos + 1 > code->cap)
+    {
+        code_grow(code);
+    }
+
+    code->buf[code->pos] = (rt_byte)b;
+    code->pos += 1;
+}
+
+/*
+ * Emit 1 word (32-bit) into the "code" buffer in native byte order (EMITW).
+ */
+static
+rt_void code_emitw(rt_CODE *code, rt_ui32 w)
+{
+    if (code->pos + 4 > code->cap)
+    {
+        code_grow(code);
+    }
+
+    memcpy(code->buf + code->pos, &w, 4);
+    code->pos += 4;
+}
+
+/*
+ * Find label with given "name" in the "code" buffer, return its index or -1.
+ */
+static
+rt_si32 code_find(rt_CODE *code, rt_pstr name)
+{
+    rt_si32 i;
+
+    for (i = 0; i < code->lbl_num; i++)
+    {
+        if (strcmp(code->lbl[i].name, name) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * Define label with given "name" at the current offset of the "code" buffer.
+ */
+static
+rt_void code_label(rt_CODE *code, rt_pstr name)
+{
+    if (code_find(code, name) >= 0)
+    {
+        exit(EXIT_FAILURE); /* <- duplicate label, as static assembler */
+    }
+
+    if (code->lbl_num == code->lbl_cap)
+    {
+        code->lbl_cap = code->lbl_cap * 2;
+        code->lbl = (rt_CODE_LABEL *)realloc(code->lbl,
+                            code->lbl_cap * sizeof(rt_CODE_LABEL));
+        if (code->lbl == RT_NULL)
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    code->lbl[code->lbl_num].name = name;
+    code->lbl[code->lbl_num].pos = code->pos;
+    code->lbl_num++;
+}
+
+/*
+ * Record reference to label "name" of kind "op" at the current offset,
+ * then reserve "len" bytes for it (to be filled in code_done).
+ */
+static
+rt_void code_fixup(rt_CODE *code, rt_pstr name, rt_si32 op, rt_si32 len)
+{
+    rt_si32 i;
+
+    if (code->fix_num == code->fix_cap)
+    {
+        code->fix_cap = code->fix_cap * 2;
+        code->fix = (rt_CODE_FIXUP *)realloc(code->fix,
+                            code->fix_cap * sizeof(rt_CODE_FIXUP));
+        if (code->fix == RT_NULL)
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    code->fix[code->fix_num].name = name;
+    code->fix[code->fix_num].pos = code->pos;
+    code->fix[code->fix_num].op = op;
+    code->fix[code->fix_num].len = len;
+    code->fix_num++;
+
+    for (i = 0; i < len; i++)
+    {
+        code_emitb(code, 0x00);
+    }
+}
+
+#if   (defined RT_X32) || (defined RT_X64) || (defined RT_X86)
+
+/*
+ * Jumps are emitted in their long form first (rel32), as forward distances
+ * are not yet known, then shortened (rel8) in code_done where distances fit.
+ * Short-form opcodes are: jmp - 0xEB, jcc - 0x70 + cc (x86 condition code).
+ */
+#define RT_CODE_LONG(op)    ((op) == 0xEB ? 5 : 6)
+#define RT_CODE_SHRT(op)    2
+
+/*
+ * Record jump of kind "op" (short-form opcode) to label "name" (jmpxx_lb).
+ */
+static
+rt_void code_jump(rt_CODE *code, rt_pstr name, rt_si32 op)
+{
+    code_fixup(code, name, op, RT_CODE_LONG(op));
+}
+
+/*
+ * Encode jump of kind "op" and size "len" to the offset "dst" at offset "pos".
+ */
+static
+rt_void code_jenc(rt_CODE *code, rt_size pos, rt_si32 op, rt_si32 len,
+                                                            rt_size dst)
+{
+    rt_si32 rel = (rt_si32)(dst - (pos + len));
+
+    if (len == RT_CODE_SHRT(op))
+    {
+        code->buf[pos + 0] = (rt_byte)op;
+        code->buf[pos + 1] = (rt_byte)rel;
+    }
+    else
+    if (op == 0xEB)
+    {
+        code->buf[pos + 0] = 0xE9;
+        memcpy(code->buf + pos + 1, &rel, 4);
+    }
+    else
+    {
+        code->buf[pos + 0] = 0x0F;
+        code->buf[pos + 1] = (rt_byte)(op + 0x10);
+        memcpy(code->buf + pos + 2, &rel, 4);
+    }
+}
+
+#else /* RT_X32, RT_X64, RT_X86 */
+
+/*
+ * Jump encodings for AArch64/MIPS/POWER (fixed 4-byte branches with scaled
+ * displacements, far targets via inverted condition over unconditional branch)
+ * are deferred until run-time code generation is ported to these targets.
+ */
+#error "label fixups in run-time code generation are x86-only, check flags"
+
+#endif /* RT_X32, RT_X64, RT_X86 */
+
+/*
+ * Return new offset for "pos" in the "code" buffer once jumps are shortened.
+ */
+static
+rt_size code_move(rt_CODE *code, rt_size pos)
+{
+    rt_size shr = 0;
+    rt_si32 i;
+
+    for (i = 0; i < code->fix_num && code->fix[i].pos < pos; i++)
+    {
+        if (code->fix[i].op >= 0)
+        {
+            shr += RT_CODE_LONG(code->fix[i].op) - code->fix[i].len;
+        }
+    }
+
+    return pos - shr;
+}
+
+/*
+ * Resolve label references in the "code" buffer choosing the shortest jumps.
+ * As shortening never makes other distances longer, the process converges.
+ */
+static
+rt_void code_link(rt_CODE *code)
+{
+    rt_size src, dst, end;
+    rt_si32 i, k, n;
+
+    /* check that all referenced labels are defined */
+    for (i = 0; i < code->fix_num; i++)
+    {
+        if (code_find(code, code->fix[i].name) < 0)
+        {
+            exit(EXIT_FAILURE); /* <- undefined label, as static assembler */
+        }
+    }
+
+    /* shorten jumps with distances fitting into short form */
+    do
+    {
+        for (i = 0, n = 0; i < code->fix_num; i++)
+        {
+            rt_si32 op = code->fix[i].op;
+
+            if (op < 0 || code->fix[i].len == RT_CODE_SHRT(op))
+            {
+                continue;
+            }
+
+            k = code_find(code, code->fix[i].name);
+            src = code_move(code, code->fix[i].pos) + RT_CODE_SHRT(op);
+            dst = code_move(code, code->lbl[k].pos);
+
+            if ((rt_cell)(dst - src) >= -128 && (rt_cell)(dst - src) <= 127)
+            {
+                code->fix[i].len = RT_CODE_SHRT(op);
+                n++;
+            }
+        }
+    }
+    while (n > 0);
+
+    /* compact the code (moving it down) and encode label references */
+    for (i = 0, src = 0, dst = 0; i <= code->fix_num; i++)
+    {
+        end = i < code->fix_num ? code->fix[i].pos : code->pos;
+        memmove(code->buf + dst, code->buf + src, end - src);
+        dst += end - src;
+        src = end;
+
+        if (i == code->fix_num)
+        {
+            break;
+        }
+
+        if (code->fix[i].op >= 0)
+        {
+            src += RT_CODE_LONG(code->fix[i].op);
+            dst += code->fix[i].len;
+        }
+        else
+        {
+            src += code->fix[i].len;
+            dst += code->fix[i].len;
+        }
+    }
+
+    for (i = 0; i < code->fix_num; i++)
+    {
+        rt_si32 op = code->fix[i].op;
+
+        k = code_find(code, code->fix[i].name);
+        src = code_move(code, code->fix[i].pos);
+        end = code_move(code, code->lbl[k].pos);
+
+        if (op >= 0)
+        {
+            code_jenc(code, src, op, code->fix[i].len, end);
+        }
+        else
+        if (op == RT_CODE_REL32)
+        {
+            rt_si32 rel = (rt_si32)(end - (src + 4));
+            memcpy(code->buf + src, &rel, 4);
+        }
+        else
+        if (op == RT_CODE_ABS32)
+        {
+            rt_ui32 abs = (rt_ui32)(rt_word)(code->buf + end);
+            memcpy(code->buf + src, &abs, 4);
+        }
+    }
+
+    code->pos = code_move(code, code->pos);
+}
+
+/*
+ * Switch the "code" buffer from read-write to read-exec and set its function.
+ */
+static
+rt_void code_done(rt_CODE *code)
+{
+    code_link(code);
+
+    free(code->lbl);
+    code->lbl = RT_NULL;
+    code->lbl_num = 0;
+
+    free(code->fix);
+    code->fix = RT_NULL;
+    code->fix_num = 0;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64)
+    DWORD old;
+    VirtualProtect(code->buf, code->cap, PAGE_EXECUTE_READ, &old);
+    FlushInstructionCache(GetCurrentProcess(), code->buf, code->pos);
+#else /* RT_LINUX */
+    mprotect(code->buf, code->cap, PROT_READ | PROT_EXEC);
+    __builtin___clear_cache((char *)code->buf, (char *)code->buf + code->pos);
+#endif /* OS */
+
+    code->fnc = (rt_FUNC_CODE)(rt_word)code->buf;
+}
+
+/*
+ * Call the function built in the "code" buffer with "info" as its argument.
+ */
+static
+rt_void code_call(rt_CODE *code, rt_pntr info)
+{
+    code->fnc(info);
+}
+
+/*
+ * Release the "code" buffer along with the function built in it.
+ */
+static
+rt_void code_free(rt_CODE *code)
+{
+    code_unmap(code->buf, code->cap);
+
+    free(code->lbl);
+    code->lbl = RT_NULL;
+    code->lbl_num = 0;
+
+    free(code->fix);
+    code->fix = RT_NULL;
+    code->fix_num = 0;
+
+    code->buf = RT_NULL;
+    code->cap = 0;
+    code->pos = 0;
+    code->fnc = RT_NULL;
+}
+
+#define ASM_CODE_CALL(__Buf__, __Info__)                                    \
+    code_call(__Buf__, (rt_pntr)__Info__);
+
+#define ASM_CODE_FREE(__Buf__)                                              \
+    code_free(__Buf__);
+
+/*
+ * In run-time code generation mode ASM_ENTER/ASM_LEAVE build the code between
+ * them into a temporary buffer, call it with __Info__ once and release it.
+ * For code called repeatedly ASM_CODE_ENTER/ASM_CODE_LEAVE are preferred,
+ * as building and releasing of the code buffer involve system calls.
+ */
+#define ASM_ENTER(__Info__)                                                 \
+{                                                                           \
+    rt_CODE __Buf__;                                                        \
+    ASM_CODE_ENTER(&__Buf__)
+
+#define ASM_LEAVE(__Info__)                                                 \
+    ASM_CODE_LEAVE(&__Buf__)                                                \
+    ASM_CODE_CALL(&__Buf__, __Info__)                                       \
+    ASM_CODE_FREE(&__Buf__)                                                 \
+}
+
+#define ASM_ENTER_F(__Info__)                                               \
+{                                                                           \
+    rt_CODE __Buf__;                                                        \
+    ASM_CODE_ENTER_F(&__Buf__)
+
+#define ASM_LEAVE_F(__Info__)                                               \
+    ASM_CODE_LEAVE_F(&__Buf__)                                              \
+    ASM_CODE_CALL(&__Buf__, __Info__)                                       \
+    ASM_CODE_FREE(&__Buf__)                                                 \
+}
+
+#endif /* RT_DYNAMIC_CODE */
+
+/******************************************************************************/
+/************************   COMMON SIMD INSTRUCTIONS   ************************/
+/******************************************************************************/
+
+/*
+ * Recommended naming scheme for instructions:
+ *
+ * cmdp*_ri - applies [cmd] to [p]acked: [r]egister from [i]mmediate
+ * cmdp*_rr - applies [cmd] to [p]acked: [r]egister from [r]egister
+ *
+ * cmdp*_rm - applies [cmd] to [p]acked: [r]egister from [m]emory
+ * cmdp*_ld - applies [cmd] to [p]acked: as above
+ *
+ * cmdi*_** - applies [cmd] to 32-bit SIMD element args, packed-128-bit
+ * cmdj*_** - applies [cmd] to 64-bit SIMD element args, packed-128-bit
+ * cmdl*_** - applies [cmd] to L-size SIMD element args, packed-128-bit
+ *
+ * cmdc*_** - applies [cmd] to 32-bit SIMD element args, packed-256-bit
+ * cmdd*_** - applies [cmd] to 64-bit SIMD element args, packed-256-bit
+ * cmdf*_** - applies [cmd] to L-size SIMD element args, packed-256-bit
+ *
+ * cmdo*_** - applies [cmd] to 32-bit SIMD element args, packed-var-len
+ * cmdp*_** - applies [cmd] to L-size SIMD element args, packed-var-len
+ * cmdq*_** - applies [cmd] to 64-bit SIMD element args, packed-var-len
+ *
+ * cmd*x_** - applies [cmd] to [p]acked unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to [p]acked   signed integer args, [n] - negatable
+ * cmd*s_** - applies [cmd] to [p]acked floating point   args, [s] - scalable
+ *
+ * The cmdp*_** (rtbase.h) instructions are intended for SPMD programming model
+ * and can be configured to work with 32/64-bit data-elements (int, fp).
+ * In this model data-paths are fixed-width, BASE and SIMD data-elements are
+ * width-compatible, code-path divergence is handled via mkj**_** pseudo-ops.
+ * Matching element-sized BASE subset cmdy*_** is defined in rtbase.h as well.
+ *
+ * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
+ * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
+ * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
+ * This happens when registers written in 128-bit subset are then used/read
+ * from within 256-bit subset. The same rule applies to mixing of 256/512-bit.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and fisrt source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and fisrt source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ */
+
+#if (defined RT_SIMD_CODE)
+
+/****************** original CHECK_MASK macro (configurable) ******************/
+
+#define CHECK_MASK(lb, mask, XS) /* destroys Reax, jump lb if mask == S */  \
+        mkjpx_rx(W(XS), mask, lb)
+
+/****************** original FCTRL blocks (cannot be nested) ******************/
+
+#define FCTRL_ENTER(mode) /* assumes default mode (ROUNDN) upon entry */    \
+        FCTRL_SET(mode)
+
+#define FCTRL_LEAVE(mode) /* resumes default mode (ROUNDN) upon leave */    \
+        FCTRL_RESET()
+
+/*
+ * Single-op FCTRL blocks (internal, cannot be nested) for fallbacks of
+ * explicit-rounding instructions (adr, sbr, mlr, dvr, fmr) on targets
+ * without embedded rounding, which skip fp control register writes for
+ * the default mode (ROUNDN), keeping them for all other modes (incl. _F).
+ * As they assume ROUNDN on entry and resume it on leave, explicit-rounding
+ * instructions are not allowed inside original FCTRL blocks above: ROUNDN
+ * op would run in the block's mode, any other op would reset it to ROUNDN.
+ * Macros can't detect the nesting, so it isn't diagnosed at build time.
+ * This holds for portable code on all targets, even if AVX-512 encodes
+ * the mode directly, so keep them outside of FCTRL_ENTER/FCTRL_LEAVE.
+ */
+
+#define FCTRL_ENTER_R(mode)                                                 \
+        FCTRL_ENTER_##mode()
+
+#define FCTRL_LEAVE_R(mode)                                                 \
+        FCTRL_LEAVE_##mode()
+
+#define FCTRL_ENTER_ROUNDN()
+#define FCTRL_LEAVE_ROUNDN()
+
+#define FCTRL_ENTER_ROUNDM()                                                \
+        FCTRL_ENTER(ROUNDM)
+
+#define FCTRL_LEAVE_ROUNDM()                                                \
+        FCTRL_LEAVE(ROUNDM)
+
+#define FCTRL_ENTER_ROUNDP()                                                \
+        FCTRL_ENTER(ROUNDP)
+
+#define FCTRL_LEAVE_ROUNDP()                                                \
+        FCTRL_LEAVE(ROUNDP)
+
+#define FCTRL_ENTER_ROUNDZ()                                                \
+        FCTRL_ENTER(ROUNDZ)
+
+#define FCTRL_LEAVE_ROUNDZ()                                                \
+        FCTRL_LEAVE(ROUNDZ)
+
+#define FCTRL_ENTER_ROUNDN_F()                                              \
+        FCTRL_ENTER(ROUNDN_F)
+
+#define FCTRL_LEAVE_ROUNDN_F()                                              \
+        FCTRL_LEAVE(ROUNDN_F)
+
+#define FCTRL_ENTER_ROUNDM_F()                                              \
+        FCTRL_ENTER(ROUNDM_F)
+
+#define FCTRL_LEAVE_ROUNDM_F()                                              \
+        FCTRL_LEAVE(ROUNDM_F)
+
+#define FCTRL_ENTER_ROUNDP_F()                                              \
+        FCTRL_ENTER(ROUNDP_F)
+
+#define FCTRL_LEAVE_ROUNDP_F()                                              \
+        FCTRL_LEAVE(ROUNDP_F)
+
+#define FCTRL_ENTER_ROUNDZ_F()                                              \
+        FCTRL_ENTER(ROUNDZ_F)
+
+#define FCTRL_LEAVE_ROUNDZ_F()                                              \
+        FCTRL_LEAVE(ROUNDZ_F)
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-32-bit-element **** 512-bit ***/
+/******************************************************************************/
+
+#if   (RT_SIMD >= 512)
+
+/*
+ * main block of var-len SIMD instructions is defined in 512/1K4/2K8-bit headers
+ */
+
+/* cbr (D = cbrt S) */
+
+/*
+ * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
+ * available at http://www.musicdsp.org/showone.php?id=206
+ * converted to S-way SIMD version by VectorChief.
+ */
+#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbeos_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsos_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsos_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsos_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        /* cube root estimate, the exponent is divided by three             \
+         * in such a way that remainder bits get shoved into                \
+         * the top of the normalized mantissa */                            \
+        movox_ld(W(X2), Mebp, inf_GPC04_32)                                 \
+        movox_rr(W(XD), W(XS))                                              \
+        andox_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
+        subox_ld(W(XD), Mebp, inf_GPC05_32) /* convert to 2's complement */ \
+        shron_ri(W(XD), IB(10))  /* XD / 1024 */                            \
+        movox_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
+        shlox_ri(W(X1), IB(2))                                              \
+        addox_rr(W(XD), W(X1))                                              \
+        shlox_ri(W(X1), IB(2))                                              \
+        addox_rr(W(XD), W(X1))                                              \
+        shlox_ri(W(X1), IB(2))                                              \
+        addox_rr(W(XD), W(X1))                                              \
+        shlox_ri(W(X1), IB(2))                                              \
+        addox_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
+        addox_ld(W(XD), Mebp, inf_GPC05_32) /* back to biased-127 */        \
+        andox_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
         annox_rr(W(X2), W(XS))   /* original sign */                        \
         orrox_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
 
-#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        movox_rr(W(X1), W(XG))                                              \
-        mulos_rr(W(X1), W(XG))                                              \
-        movox_rr(W(X2), W(X1))                                              \
-        mulos_ld(W(X1), Mebp, inf_GPC03_32)                                 \
-        rceos_rr(W(X1), W(X1))                                              \
-        mulos_rr(W(X2), W(XG))                                              \
-        subos_rr(W(X2), W(XS))                                              \
-        mulos_rr(W(X2), W(X1))                                              \
-        subos_rr(W(XG), W(X2))
+#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movox_rr(W(X1), W(XG))                                              \
+        mulos_rr(W(X1), W(XG))                                              \
+        movox_rr(W(X2), W(X1))                                              \
+        mulos_ld(W(X1), Mebp, inf_GPC03_32)                                 \
+        rceos_rr(W(X1), W(X1))                                              \
+        mulos_rr(W(X2), W(XG))                                              \
+        subos_rr(W(X2), W(XS))                                              \
+        mulos_rr(W(X2), W(X1))                                              \
+        subos_rr(W(XG), W(X2))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcpos_rr(XD, XS) /* destroys XS */                                  \
+        rceos_rr(W(XD), W(XS))                                              \
+        rcsos_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcpos_rr(XD, XS) /* destroys XS */                                  \
+        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divos_rr(W(XD), W(XS))
+
+#define rceos_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divos_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcsos_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqos_rr(XD, XS) /* destroys XS */                                  \
+        rseos_rr(W(XD), W(XS))                                              \
+        rssos_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqos_rr(XD, XS) /* destroys XS */                                  \
+        sqros_rr(W(XS), W(XS))                                              \
+        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divos_rr(W(XD), W(XS))
+
+#define rseos_rr(XD, XS)                                                    \
+        sqros_rr(W(XD), W(XS))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divos_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rssos_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmaos_rr(XG, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulos_rr(W(XS), W(XT))                                              \
+        addos_rr(W(XG), W(XS))                                              \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmaos_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulos_ld(W(XS), W(MT), W(DT))                                       \
+        addos_rr(W(XG), W(XS))                                              \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmsos_rr(XG, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulos_rr(W(XS), W(XT))                                              \
+        subos_rr(W(XG), W(XS))                                              \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsos_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulos_ld(W(XS), W(MT), W(DT))                                       \
+        subos_rr(W(XG), W(XS))                                              \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-32-bit-element **** 256-bit ***/
+/******************************************************************************/
+
+#elif (RT_SIMD == 256)
+
+/***************   packed single-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movox_rr(XD, XS)                                                    \
+        movcx_rr(W(XD), W(XS))
+
+#define movox_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))
+
+#define movox_st(XS, MD, DD)                                                \
+        movcx_st(W(XS), W(MD), W(DD))
+
+#ifdef movcx_nt
+
+#define movox_nt(XS, MD, DD)                                                \
+        movcx_nt(W(XS), W(MD), W(DD))
+
+#endif /* movcx_nt */
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+
+#define mmvox_ld(XG, MS, DS)                                                \
+        mmvcx_ld(W(XG), W(MS), W(DS))
+
+#define mmvox_st(XS, MG, DG)                                                \
+        mmvcx_st(W(XS), W(MG), W(DG))
+
+#ifdef mmzcx_ld
+
+#define mmzox_ld(XD, MS, DS)                                                \
+        mmzcx_ld(W(XD), W(MS), W(DS))
+
+#endif /* mmzcx_ld */
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#ifdef selcx_rr
+
+#define selox_rr(XG, XM, XS)                                                \
+        selcx_rr(W(XG), W(XM), W(XS))
+
+#define selox_ld(XG, XM, MS, DS)                                            \
+        selcx_ld(W(XG), W(XM), W(MS), W(DS))
+
+#define selox3rr(XD, XM, XS, XT)                                            \
+        selcx3rr(W(XD), W(XM), W(XS), W(XT))
+
+#define selox3ld(XD, XM, XS, MT, DT)                                        \
+        selcx3ld(W(XD), W(XM), W(XS), W(MT), W(DT))
+
+#endif /* selcx_rr */
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#ifdef splcx_rr
+
+#define splox_rr(XD, RS)                                                    \
+        splcx_rr(W(XD), W(RS))
+
+#define splox_ld(XD, MS, DS)                                                \
+        splcx_ld(W(XD), W(MS), W(DS))
+
+#endif /* splcx_rr */
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#ifdef extcx_rr
+
+#define extox_rr(RD, XS, IS)                                                \
+        extcx_rr(W(RD), W(XS), W(IS))
+
+#endif /* extcx_rr */
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#ifdef inscx_rr
+
+#define insox_rr(XG, RS, IS)                                                \
+        inscx_rr(W(XG), W(RS), W(IS))
+
+#endif /* inscx_rr */
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#ifdef shfcx3ri
+
+#define shfox_ri(XG, IS)                                                    \
+        shfcx_ri(W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        shfcx3ri(W(XD), W(XS), W(IT))
+
+#endif /* shfcx3ri */
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#ifdef ilocx3rr
+
+#define iloox_rr(XG, XS)                                                    \
+        ilocx_rr(W(XG), W(XS))
+
+#define iloox_ld(XG, MS, DS)                                                \
+        ilocx_ld(W(XG), W(MS), W(DS))
+
+#define iloox3rr(XD, XS, XT)                                                \
+        ilocx3rr(W(XD), W(XS), W(XT))
+
+#define iloox3ld(XD, XS, MT, DT)                                            \
+        ilocx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ilocx3rr */
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#ifdef ihicx3rr
+
+#define ihiox_rr(XG, XS)                                                    \
+        ihicx_rr(W(XG), W(XS))
+
+#define ihiox_ld(XG, MS, DS)                                                \
+        ihicx_ld(W(XG), W(MS), W(DS))
+
+#define ihiox3rr(XD, XS, XT)                                                \
+        ihicx3rr(W(XD), W(XS), W(XT))
+
+#define ihiox3ld(XD, XS, MT, DT)                                            \
+        ihicx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ihicx3rr */
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#ifdef revcx_rr
+
+#define revox_rx(XG)                                                        \
+        revcx_rx(W(XG))
+
+#define revox_rr(XD, XS)                                                    \
+        revcx_rr(W(XD), W(XS))
+
+#endif /* revcx_rr */
+
+/* fld (G = elems of G from bytes [n, 2n) in bytes [0, n), in any order),
+ * other elems of G are undefined upon completion, used in reductions */
+
+#ifdef fldcx_rx
+
+#define fldox_rx(XG, n)                                                     \
+        fldcx_rx(W(XG), n)
+
+#endif /* fldcx_rx */
+
+/* adh, mnh, mxh (D = S[0] op S[1] op ... op S[n]) in lowest element of D */
+
+#ifdef adhcs_rr
+
+#define adhos_rr(XD, XS)                                                    \
+        adhcs_rr(W(XD), W(XS))
+
+#define adhos_ld(XD, MS, DS)                                                \
+        adhcs_ld(W(XD), W(MS), W(DS))
+
+#define mnhos_rr(XD, XS)                                                    \
+        mnhcs_rr(W(XD), W(XS))
+
+#define mnhos_ld(XD, MS, DS)                                                \
+        mnhcs_ld(W(XD), W(MS), W(DS))
+
+#define mxhos_rr(XD, XS)                                                    \
+        mxhcs_rr(W(XD), W(XS))
+
+#define mxhos_ld(XD, MS, DS)                                                \
+        mxhcs_ld(W(XD), W(MS), W(DS))
+
+#endif /* adhcs_rr */
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andox_rr(XG, XS)                                                    \
+        andcx_rr(W(XG), W(XS))
+
+#define andox_ld(XG, MS, DS)                                                \
+        andcx_ld(W(XG), W(MS), W(DS))
+
+#define andox3rr(XD, XS, XT)                                                \
+        andcx3rr(W(XD), W(XS), W(XT))
+
+#define andox3ld(XD, XS, MT, DT)                                            \
+        andcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annox_rr(XG, XS)                                                    \
+        anncx_rr(W(XG), W(XS))
+
+#define annox_ld(XG, MS, DS)                                                \
+        anncx_ld(W(XG), W(MS), W(DS))
+
+#define annox3rr(XD, XS, XT)                                                \
+        anncx3rr(W(XD), W(XS), W(XT))
+
+#define annox3ld(XD, XS, MT, DT)                                            \
+        anncx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrox_rr(XG, XS)                                                    \
+        orrcx_rr(W(XG), W(XS))
+
+#define orrox_ld(XG, MS, DS)                                                \
+        orrcx_ld(W(XG), W(MS), W(DS))
+
+#define orrox3rr(XD, XS, XT)                                                \
+        orrcx3rr(W(XD), W(XS), W(XT))
+
+#define orrox3ld(XD, XS, MT, DT)                                            \
+        orrcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornox_rr(XG, XS)                                                    \
+        orncx_rr(W(XG), W(XS))
+
+#define ornox_ld(XG, MS, DS)                                                \
+        orncx_ld(W(XG), W(MS), W(DS))
+
+#define ornox3rr(XD, XS, XT)                                                \
+        orncx3rr(W(XD), W(XS), W(XT))
+
+#define ornox3ld(XD, XS, MT, DT)                                            \
+        orncx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorox_rr(XG, XS)                                                    \
+        xorcx_rr(W(XG), W(XS))
+
+#define xorox_ld(XG, MS, DS)                                                \
+        xorcx_ld(W(XG), W(MS), W(DS))
+
+#define xorox3rr(XD, XS, XT)                                                \
+        xorcx3rr(W(XD), W(XS), W(XT))
+
+#define xorox3ld(XD, XS, MT, DT)                                            \
+        xorcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* not (G = ~G), (D = ~S) */
+
+#define notox_rx(XG)                                                        \
+        notcx_rx(W(XG))
+
+#define notox_rr(XD, XS)                                                    \
+        notcx_rr(W(XD), W(XS))
+
+/************   packed single-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negos_rx(XG)                                                        \
+        negcs_rx(W(XG))
+
+#define negos_rr(XD, XS)                                                    \
+        negcs_rr(W(XD), W(XS))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addos_rr(XG, XS)                                                    \
+        addcs_rr(W(XG), W(XS))
+
+#define addos_ld(XG, MS, DS)                                                \
+        addcs_ld(W(XG), W(MS), W(DS))
+
+#define addos3rr(XD, XS, XT)                                                \
+        addcs3rr(W(XD), W(XS), W(XT))
+
+#define addos3ld(XD, XS, MT, DT)                                            \
+        addcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subos_rr(XG, XS)                                                    \
+        subcs_rr(W(XG), W(XS))
+
+#define subos_ld(XG, MS, DS)                                                \
+        subcs_ld(W(XG), W(MS), W(DS))
+
+#define subos3rr(XD, XS, XT)                                                \
+        subcs3rr(W(XD), W(XS), W(XT))
+
+#define subos3ld(XD, XS, MT, DT)                                            \
+        subcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulos_rr(XG, XS)                                                    \
+        mulcs_rr(W(XG), W(XS))
+
+#define mulos_ld(XG, MS, DS)                                                \
+        mulcs_ld(W(XG), W(MS), W(DS))
+
+#define mulos3rr(XD, XS, XT)                                                \
+        mulcs3rr(W(XD), W(XS), W(XT))
+
+#define mulos3ld(XD, XS, MT, DT)                                            \
+        mulcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divos_rr(XG, XS)                                                    \
+        divcs_rr(W(XG), W(XS))
+
+#define divos_ld(XG, MS, DS)                                                \
+        divcs_ld(W(XG), W(MS), W(DS))
+
+#define divos3rr(XD, XS, XT)                                                \
+        divcs3rr(W(XD), W(XS), W(XT))
+
+#define divos3ld(XD, XS, MT, DT)                                            \
+        divcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sqr (D = sqrt S) */
+
+#define sqros_rr(XD, XS)                                                    \
+        sqrcs_rr(W(XD), W(XS))
+
+#define sqros_ld(XD, MS, DS)                                                \
+        sqrcs_ld(W(XD), W(MS), W(DS))
+
+/* cbr (D = cbrt S) */
+
+#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbrcs_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbecs_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbscs_rr(W(XG), W(X1), W(X2), W(XS))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpos_rr(XD, XS) /* destroys XS */                                  \
+        rcpcs_rr(W(XD), W(XS))
+
+#define rceos_rr(XD, XS)                                                    \
+        rcecs_rr(W(XD), W(XS))
+
+#define rcsos_rr(XG, XS) /* destroys XS */                                  \
+        rcscs_rr(W(XG), W(XS))
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqos_rr(XD, XS) /* destroys XS */                                  \
+        rsqcs_rr(W(XD), W(XS))
+
+#define rseos_rr(XD, XS)                                                    \
+        rsecs_rr(W(XD), W(XS))
+
+#define rssos_rr(XG, XS) /* destroys XS */                                  \
+        rsscs_rr(W(XG), W(XS))
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmaos_rr(XG, XS, XT)                                                \
+        fmacs_rr(W(XG), W(XS), W(XT))
+
+#define fmaos_ld(XG, XS, MT, DT)                                            \
+        fmacs_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#define fmsos_rr(XG, XS, XT)                                                \
+        fmscs_rr(W(XG), W(XS), W(XT))
+
+#define fmsos_ld(XG, XS, MT, DT)                                            \
+        fmscs_ld(W(XG), W(XS), W(MT), W(DT))
+
+/*************   packed single-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minos_rr(XG, XS)                                                    \
+        mincs_rr(W(XG), W(XS))
+
+#define minos_ld(XG, MS, DS)                                                \
+        mincs_ld(W(XG), W(MS), W(DS))
+
+#define minos3rr(XD, XS, XT)                                                \
+        mincs3rr(W(XD), W(XS), W(XT))
+
+#define minos3ld(XD, XS, MT, DT)                                            \
+        mincs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxos_rr(XG, XS)                                                    \
+        maxcs_rr(W(XG), W(XS))
+
+#define maxos_ld(XG, MS, DS)                                                \
+        maxcs_ld(W(XG), W(MS), W(DS))
+
+#define maxos3rr(XD, XS, XT)                                                \
+        maxcs3rr(W(XD), W(XS), W(XT))
+
+#define maxos3ld(XD, XS, MT, DT)                                            \
+        maxcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqos_rr(XG, XS)                                                    \
+        ceqcs_rr(W(XG), W(XS))
+
+#define ceqos_ld(XG, MS, DS)                                                \
+        ceqcs_ld(W(XG), W(MS), W(DS))
+
+#define ceqos3rr(XD, XS, XT)                                                \
+        ceqcs3rr(W(XD), W(XS), W(XT))
+
+#define ceqos3ld(XD, XS, MT, DT)                                            \
+        ceqcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneos_rr(XG, XS)                                                    \
+        cnecs_rr(W(XG), W(XS))
+
+#define cneos_ld(XG, MS, DS)                                                \
+        cnecs_ld(W(XG), W(MS), W(DS))
+
+#define cneos3rr(XD, XS, XT)                                                \
+        cnecs3rr(W(XD), W(XS), W(XT))
+
+#define cneos3ld(XD, XS, MT, DT)                                            \
+        cnecs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltos_rr(XG, XS)                                                    \
+        cltcs_rr(W(XG), W(XS))
+
+#define cltos_ld(XG, MS, DS)                                                \
+        cltcs_ld(W(XG), W(MS), W(DS))
+
+#define cltos3rr(XD, XS, XT)                                                \
+        cltcs3rr(W(XD), W(XS), W(XT))
+
+#define cltos3ld(XD, XS, MT, DT)                                            \
+        cltcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define cleos_rr(XG, XS)                                                    \
+        clecs_rr(W(XG), W(XS))
+
+#define cleos_ld(XG, MS, DS)                                                \
+        clecs_ld(W(XG), W(MS), W(DS))
+
+#define cleos3rr(XD, XS, XT)                                                \
+        clecs3rr(W(XD), W(XS), W(XT))
+
+#define cleos3ld(XD, XS, MT, DT)                                            \
+        clecs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtos_rr(XG, XS)                                                    \
+        cgtcs_rr(W(XG), W(XS))
+
+#define cgtos_ld(XG, MS, DS)                                                \
+        cgtcs_ld(W(XG), W(MS), W(DS))
+
+#define cgtos3rr(XD, XS, XT)                                                \
+        cgtcs3rr(W(XD), W(XS), W(XT))
+
+#define cgtos3ld(XD, XS, MT, DT)                                            \
+        cgtcs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgeos_rr(XG, XS)                                                    \
+        cgecs_rr(W(XG), W(XS))
+
+#define cgeos_ld(XG, MS, DS)                                                \
+        cgecs_ld(W(XG), W(MS), W(DS))
+
+#define cgeos3rr(XD, XS, XT)                                                \
+        cgecs3rr(W(XD), W(XS), W(XT))
+
+#define cgeos3ld(XD, XS, MT, DT)                                            \
+        cgecs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        mkjcx_rx(W(XS), mask, lb)
+
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#ifdef mkbcx_rr
+
+#define mkbox_rr(RD, XS)                                                    \
+        mkbcx_rr(W(RD), W(XS))
+
+#endif /* mkbcx_rr */
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#ifdef mkccx_rr
+
+#define mkcox_rr(RD, XS)                                                    \
+        mkccx_rr(W(RD), W(XS))
+
+#endif /* mkccx_rr */
+
+/*************   packed single-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnzos_rr(XD, XS)     /* round towards zero */                       \
+        rnzcs_rr(W(XD), W(XS))
+
+#define rnzos_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzcs_ld(W(XD), W(MS), W(DS))
+
+#define cvzos_rr(XD, XS)     /* round towards zero */                       \
+        cvzcs_rr(W(XD), W(XS))
+
+#define cvzos_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzcs_ld(W(XD), W(MS), W(DS))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnpos_rr(XD, XS)     /* round towards +inf */                       \
+        rnpcs_rr(W(XD), W(XS))
+
+#define rnpos_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpcs_ld(W(XD), W(MS), W(DS))
+
+#define cvpos_rr(XD, XS)     /* round towards +inf */                       \
+        cvpcs_rr(W(XD), W(XS))
+
+#define cvpos_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpcs_ld(W(XD), W(MS), W(DS))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnmos_rr(XD, XS)     /* round towards -inf */                       \
+        rnmcs_rr(W(XD), W(XS))
+
+#define rnmos_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmcs_ld(W(XD), W(MS), W(DS))
+
+#define cvmos_rr(XD, XS)     /* round towards -inf */                       \
+        cvmcs_rr(W(XD), W(XS))
+
+#define cvmos_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmcs_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnnos_rr(XD, XS)     /* round towards near */                       \
+        rnncs_rr(W(XD), W(XS))
+
+#define rnnos_ld(XD, MS, DS) /* round towards near */                       \
+        rnncs_ld(W(XD), W(MS), W(DS))
+
+#define cvnos_rr(XD, XS)     /* round towards near */                       \
+        cvncs_rr(W(XD), W(XS))
+
+#define cvnos_ld(XD, MS, DS) /* round towards near */                       \
+        cvncs_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnon_rr(XD, XS)     /* round towards near */                       \
+        cvncn_rr(W(XD), W(XS))
+
+#define cvnon_ld(XD, MS, DS) /* round towards near */                       \
+        cvncn_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rndos_rr(XD, XS)                                                    \
+        rndcs_rr(W(XD), W(XS))
+
+#define rndos_ld(XD, MS, DS)                                                \
+        rndcs_ld(W(XD), W(MS), W(DS))
+
+#define cvtos_rr(XD, XS)                                                    \
+        cvtcs_rr(W(XD), W(XS))
+
+#define cvtos_ld(XD, MS, DS)                                                \
+        cvtcs_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+
+#define cvton_rr(XD, XS)                                                    \
+        cvtcn_rr(W(XD), W(XS))
+
+#define cvton_ld(XD, MS, DS)                                                \
+        cvtcn_ld(W(XD), W(MS), W(DS))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnros_rr(XD, XS, mode)                                              \
+        rnrcs_rr(W(XD), W(XS), mode)
+
+#define cvros_rr(XD, XS, mode)                                              \
+        cvrcs_rr(W(XD), W(XS), mode)
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        cvscs_rr(W(XD), W(XS), W(XT))
+
+/* cvf (D = fp16-to-fp32 S), loads half-width memory, see var-len section */
+
+#ifdef cvfcs_ld
+
+#define cvfos_ld(XD, MS, DS)                                                \
+        cvfcs_ld(W(XD), W(MS), W(DS))
+
+#endif /* cvfcs_ld */
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory, see var-len section */
+
+#ifdef cvfcs_st
+
+#define cvfos_st(XS, MD, DD)                                                \
+        cvfcs_st(W(XS), W(MD), W(DD))
+
+#endif /* cvfcs_st */
+
+/************   packed single-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addox_rr(XG, XS)                                                    \
+        addcx_rr(W(XG), W(XS))
+
+#define addox_ld(XG, MS, DS)                                                \
+        addcx_ld(W(XG), W(MS), W(DS))
+
+#define addox3rr(XD, XS, XT)                                                \
+        addcx3rr(W(XD), W(XS), W(XT))
+
+#define addox3ld(XD, XS, MT, DT)                                            \
+        addcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subox_rr(XG, XS)                                                    \
+        subcx_rr(W(XG), W(XS))
+
+#define subox_ld(XG, MS, DS)                                                \
+        subcx_ld(W(XG), W(MS), W(DS))
+
+#define subox3rr(XD, XS, XT)                                                \
+        subcx3rr(W(XD), W(XS), W(XT))
+
+#define subox3ld(XD, XS, MT, DT)                                            \
+        subcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* abs (G = |G|), (D = |S|) - signed */
+
+#ifdef abscn_rr
+
+#define abson_rx(XG)                                                        \
+        abscn_rx(W(XG))
+
+#define abson_rr(XD, XS)                                                    \
+        abscn_rr(W(XD), W(XS))
+
+#endif /* abscn_rr */
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#ifdef mulcx_rr
+
+#define mulox_rr(XG, XS)                                                    \
+        mulcx_rr(W(XG), W(XS))
+
+#define mulox_ld(XG, MS, DS)                                                \
+        mulcx_ld(W(XG), W(MS), W(DS))
+
+#define mulox3rr(XD, XS, XT)                                                \
+        mulcx3rr(W(XD), W(XS), W(XT))
+
+#define mulox3ld(XD, XS, MT, DT)                                            \
+        mulcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* mulcx_rr */
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlox_ri(XG, IS)                                                    \
+        shlcx_ri(W(XG), W(IS))
+
+#define shlox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shlcx_ld(W(XG), W(MS), W(DS))
+
+#define shlox3ri(XD, XS, IT)                                                \
+        shlcx3ri(W(XD), W(XS), W(IT))
+
+#define shlox3ld(XD, XS, MT, DT)                                            \
+        shlcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrox_ri(XG, IS)                                                    \
+        shrcx_ri(W(XG), W(IS))
+
+#define shrox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrcx_ld(W(XG), W(MS), W(DS))
+
+#define shrox3ri(XD, XS, IT)                                                \
+        shrcx3ri(W(XD), W(XS), W(IT))
+
+#define shrox3ld(XD, XS, MT, DT)                                            \
+        shrcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shron_ri(XG, IS)                                                    \
+        shrcn_ri(W(XG), W(IS))
+
+#define shron_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrcn_ld(W(XG), W(MS), W(DS))
+
+#define shron3ri(XD, XS, IT)                                                \
+        shrcn3ri(W(XD), W(XS), W(IT))
+
+#define shron3ld(XD, XS, MT, DT)                                            \
+        shrcn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svlox_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svlcx_rr(W(XG), W(XS))
+
+#define svlox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svlcx_ld(W(XG), W(MS), W(DS))
+
+#define svlox3rr(XD, XS, XT)                                                \
+        svlcx3rr(W(XD), W(XS), W(XT))
+
+#define svlox3ld(XD, XS, MT, DT)                                            \
+        svlcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrox_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrcx_rr(W(XG), W(XS))
+
+#define svrox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrcx_ld(W(XG), W(MS), W(DS))
+
+#define svrox3rr(XD, XS, XT)                                                \
+        svrcx3rr(W(XD), W(XS), W(XT))
+
+#define svrox3ld(XD, XS, MT, DT)                                            \
+        svrcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svron_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrcn_rr(W(XG), W(XS))
+
+#define svron_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrcn_ld(W(XG), W(MS), W(DS))
+
+#define svron3rr(XD, XS, XT)                                                \
+        svrcn3rr(W(XD), W(XS), W(XT))
+
+#define svron3ld(XD, XS, MT, DT)                                            \
+        svrcn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/****************   packed single-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#ifdef mincx_rr
+
+#define minox_rr(XG, XS)                                                    \
+        mincx_rr(W(XG), W(XS))
+
+#define minox_ld(XG, MS, DS)                                                \
+        mincx_ld(W(XG), W(MS), W(DS))
+
+#define minox3rr(XD, XS, XT)                                                \
+        mincx3rr(W(XD), W(XS), W(XT))
+
+#define minox3ld(XD, XS, MT, DT)                                            \
+        mincx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* mincx_rr */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#ifdef mincn_rr
+
+#define minon_rr(XG, XS)                                                    \
+        mincn_rr(W(XG), W(XS))
+
+#define minon_ld(XG, MS, DS)                                                \
+        mincn_ld(W(XG), W(MS), W(DS))
+
+#define minon3rr(XD, XS, XT)                                                \
+        mincn3rr(W(XD), W(XS), W(XT))
+
+#define minon3ld(XD, XS, MT, DT)                                            \
+        mincn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* mincn_rr */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#ifdef maxcx_rr
+
+#define maxox_rr(XG, XS)                                                    \
+        maxcx_rr(W(XG), W(XS))
+
+#define maxox_ld(XG, MS, DS)                                                \
+        maxcx_ld(W(XG), W(MS), W(DS))
+
+#define maxox3rr(XD, XS, XT)                                                \
+        maxcx3rr(W(XD), W(XS), W(XT))
+
+#define maxox3ld(XD, XS, MT, DT)                                            \
+        maxcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* maxcx_rr */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#ifdef maxcn_rr
+
+#define maxon_rr(XG, XS)                                                    \
+        maxcn_rr(W(XG), W(XS))
+
+#define maxon_ld(XG, MS, DS)                                                \
+        maxcn_ld(W(XG), W(MS), W(DS))
+
+#define maxon3rr(XD, XS, XT)                                                \
+        maxcn3rr(W(XD), W(XS), W(XT))
+
+#define maxon3ld(XD, XS, MT, DT)                                            \
+        maxcn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* maxcn_rr */
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#ifdef ceqcx_rr
+
+#define ceqox_rr(XG, XS)                                                    \
+        ceqcx_rr(W(XG), W(XS))
+
+#define ceqox_ld(XG, MS, DS)                                                \
+        ceqcx_ld(W(XG), W(MS), W(DS))
+
+#define ceqox3rr(XD, XS, XT)                                                \
+        ceqcx3rr(W(XD), W(XS), W(XT))
+
+#define ceqox3ld(XD, XS, MT, DT)                                            \
+        ceqcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ceqcx_rr */
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#ifdef cnecx_rr
+
+#define cneox_rr(XG, XS)                                                    \
+        cnecx_rr(W(XG), W(XS))
+
+#define cneox_ld(XG, MS, DS)                                                \
+        cnecx_ld(W(XG), W(MS), W(DS))
+
+#define cneox3rr(XD, XS, XT)                                                \
+        cnecx3rr(W(XD), W(XS), W(XT))
+
+#define cneox3ld(XD, XS, MT, DT)                                            \
+        cnecx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cnecx_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cltcx_rr
+
+#define cltox_rr(XG, XS)                                                    \
+        cltcx_rr(W(XG), W(XS))
+
+#define cltox_ld(XG, MS, DS)                                                \
+        cltcx_ld(W(XG), W(MS), W(DS))
+
+#define cltox3rr(XD, XS, XT)                                                \
+        cltcx3rr(W(XD), W(XS), W(XT))
+
+#define cltox3ld(XD, XS, MT, DT)                                            \
+        cltcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cltcx_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cltcn_rr
+
+#define clton_rr(XG, XS)                                                    \
+        cltcn_rr(W(XG), W(XS))
+
+#define clton_ld(XG, MS, DS)                                                \
+        cltcn_ld(W(XG), W(MS), W(DS))
+
+#define clton3rr(XD, XS, XT)                                                \
+        cltcn3rr(W(XD), W(XS), W(XT))
+
+#define clton3ld(XD, XS, MT, DT)                                            \
+        cltcn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cltcn_rr */
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef clecx_rr
+
+#define cleox_rr(XG, XS)                                                    \
+        clecx_rr(W(XG), W(XS))
+
+#define cleox_ld(XG, MS, DS)                                                \
+        clecx_ld(W(XG), W(MS), W(DS))
+
+#define cleox3rr(XD, XS, XT)                                                \
+        clecx3rr(W(XD), W(XS), W(XT))
+
+#define cleox3ld(XD, XS, MT, DT)                                            \
+        clecx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* clecx_rr */
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef clecn_rr
+
+#define cleon_rr(XG, XS)                                                    \
+        clecn_rr(W(XG), W(XS))
+
+#define cleon_ld(XG, MS, DS)                                                \
+        clecn_ld(W(XG), W(MS), W(DS))
+
+#define cleon3rr(XD, XS, XT)                                                \
+        clecn3rr(W(XD), W(XS), W(XT))
+
+#define cleon3ld(XD, XS, MT, DT)                                            \
+        clecn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* clecn_rr */
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cgtcx_rr
+
+#define cgtox_rr(XG, XS)                                                    \
+        cgtcx_rr(W(XG), W(XS))
+
+#define cgtox_ld(XG, MS, DS)                                                \
+        cgtcx_ld(W(XG), W(MS), W(DS))
+
+#define cgtox3rr(XD, XS, XT)                                                \
+        cgtcx3rr(W(XD), W(XS), W(XT))
+
+#define cgtox3ld(XD, XS, MT, DT)                                            \
+        cgtcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgtcx_rr */
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cgtcn_rr
+
+#define cgton_rr(XG, XS)                                                    \
+        cgtcn_rr(W(XG), W(XS))
+
+#define cgton_ld(XG, MS, DS)                                                \
+        cgtcn_ld(W(XG), W(MS), W(DS))
+
+#define cgton3rr(XD, XS, XT)                                                \
+        cgtcn3rr(W(XD), W(XS), W(XT))
+
+#define cgton3ld(XD, XS, MT, DT)                                            \
+        cgtcn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgtcn_rr */
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cgecx_rr
+
+#define cgeox_rr(XG, XS)                                                    \
+        cgecx_rr(W(XG), W(XS))
+
+#define cgeox_ld(XG, MS, DS)                                                \
+        cgecx_ld(W(XG), W(MS), W(DS))
+
+#define cgeox3rr(XD, XS, XT)                                                \
+        cgecx3rr(W(XD), W(XS), W(XT))
+
+#define cgeox3ld(XD, XS, MT, DT)                                            \
+        cgecx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgecx_rr */
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cgecn_rr
+
+#define cgeon_rr(XG, XS)                                                    \
+        cgecn_rr(W(XG), W(XS))
+
+#define cgeon_ld(XG, MS, DS)                                                \
+        cgecn_ld(W(XG), W(MS), W(DS))
+
+#define cgeon3rr(XD, XS, XT)                                                \
+        cgecn3rr(W(XD), W(XS), W(XT))
+
+#define cgeon3ld(XD, XS, MT, DT)                                            \
+        cgecn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgecn_rr */
+
+/*
+ * common 256-bit floating-point SIMD instructions with 32-bit elements
+ */
+
+/* cbr (D = cbrt S) */
+
+/*
+ * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
+ * available at http://www.musicdsp.org/showone.php?id=206
+ * converted to S-way SIMD version by VectorChief.
+ */
+#define cbrcs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbecs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbscs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbscs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbscs_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbecs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        /* cube root estimate, the exponent is divided by three             \
+         * in such a way that remainder bits get shoved into                \
+         * the top of the normalized mantissa */                            \
+        movcx_ld(W(X2), Mebp, inf_GPC04_32)                                 \
+        movcx_rr(W(XD), W(XS))                                              \
+        andcx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
+        subcx_ld(W(XD), Mebp, inf_GPC05_32) /* convert to 2's complement */ \
+        shrcn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
+        movcx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
+        shlcx_ri(W(X1), IB(2))                                              \
+        addcx_rr(W(XD), W(X1))                                              \
+        shlcx_ri(W(X1), IB(2))                                              \
+        addcx_rr(W(XD), W(X1))                                              \
+        shlcx_ri(W(X1), IB(2))                                              \
+        addcx_rr(W(XD), W(X1))                                              \
+        shlcx_ri(W(X1), IB(2))                                              \
+        addcx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
+        addcx_ld(W(XD), Mebp, inf_GPC05_32) /* back to biased-127 */        \
+        andcx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
+        anncx_rr(W(X2), W(XS))   /* original sign */                        \
+        orrcx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+
+#define cbscs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movcx_rr(W(X1), W(XG))                                              \
+        mulcs_rr(W(X1), W(XG))                                              \
+        movcx_rr(W(X2), W(X1))                                              \
+        mulcs_ld(W(X1), Mebp, inf_GPC03_32)                                 \
+        rcecs_rr(W(X1), W(X1))                                              \
+        mulcs_rr(W(X2), W(XG))                                              \
+        subcs_rr(W(X2), W(XS))                                              \
+        mulcs_rr(W(X2), W(X1))                                              \
+        subcs_rr(W(XG), W(X2))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcpcs_rr(XD, XS) /* destroys XS */                                  \
+        rcecs_rr(W(XD), W(XS))                                              \
+        rcscs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcpcs_rr(XD, XS) /* destroys XS */                                  \
+        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divcs_rr(W(XD), W(XS))
+
+#define rcecs_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divcs_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcscs_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqcs_rr(XD, XS) /* destroys XS */                                  \
+        rsecs_rr(W(XD), W(XS))                                              \
+        rsscs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqcs_rr(XD, XS) /* destroys XS */                                  \
+        sqrcs_rr(W(XS), W(XS))                                              \
+        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divcs_rr(W(XD), W(XS))
+
+#define rsecs_rr(XD, XS)                                                    \
+        sqrcs_rr(W(XD), W(XS))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divcs_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rsscs_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmacs_rr(XG, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulcs_rr(W(XS), W(XT))                                              \
+        addcs_rr(W(XG), W(XS))                                              \
+        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmacs_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulcs_ld(W(XS), W(MT), W(DT))                                       \
+        addcs_rr(W(XG), W(XS))                                              \
+        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmscs_rr(XG, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulcs_rr(W(XS), W(XT))                                              \
+        subcs_rr(W(XG), W(XS))                                              \
+        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmscs_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulcs_ld(W(XS), W(MT), W(DT))                                       \
+        subcs_rr(W(XG), W(XS))                                              \
+        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-32-bit-element **** 128-bit ***/
+/******************************************************************************/
+
+#elif (RT_SIMD == 128)
+
+/***************   packed single-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movox_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))
+
+#define movox_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))
+
+#define movox_st(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
+#ifdef movix_nt
+
+#define movox_nt(XS, MD, DD)                                                \
+        movix_nt(W(XS), W(MD), W(DD))
+
+#endif /* movix_nt */
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+
+#define mmvox_ld(XG, MS, DS)                                                \
+        mmvix_ld(W(XG), W(MS), W(DS))
+
+#define mmvox_st(XS, MG, DG)                                                \
+        mmvix_st(W(XS), W(MG), W(DG))
+
+#ifdef mmzix_ld
+
+#define mmzox_ld(XD, MS, DS)                                                \
+        mmzix_ld(W(XD), W(MS), W(DS))
+
+#endif /* mmzix_ld */
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#ifdef selix_rr
+
+#define selox_rr(XG, XM, XS)                                                \
+        selix_rr(W(XG), W(XM), W(XS))
+
+#define selox_ld(XG, XM, MS, DS)                                            \
+        selix_ld(W(XG), W(XM), W(MS), W(DS))
+
+#define selox3rr(XD, XM, XS, XT)                                            \
+        selix3rr(W(XD), W(XM), W(XS), W(XT))
+
+#define selox3ld(XD, XM, XS, MT, DT)                                        \
+        selix3ld(W(XD), W(XM), W(XS), W(MT), W(DT))
+
+#endif /* selix_rr */
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#ifdef splix_rr
+
+#define splox_rr(XD, RS)                                                    \
+        splix_rr(W(XD), W(RS))
+
+#define splox_ld(XD, MS, DS)                                                \
+        splix_ld(W(XD), W(MS), W(DS))
+
+#endif /* splix_rr */
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#ifdef extix_rr
+
+#define extox_rr(RD, XS, IS)                                                \
+        extix_rr(W(RD), W(XS), W(IS))
+
+#endif /* extix_rr */
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#ifdef insix_rr
+
+#define insox_rr(XG, RS, IS)                                                \
+        insix_rr(W(XG), W(RS), W(IS))
+
+#endif /* insix_rr */
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#ifdef shfix3ri
+
+#define shfox_ri(XG, IS)                                                    \
+        shfix_ri(W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        shfix3ri(W(XD), W(XS), W(IT))
+
+#endif /* shfix3ri */
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#ifdef iloix3rr
+
+#define iloox_rr(XG, XS)                                                    \
+        iloix_rr(W(XG), W(XS))
+
+#define iloox_ld(XG, MS, DS)                                                \
+        iloix_ld(W(XG), W(MS), W(DS))
+
+#define iloox3rr(XD, XS, XT)                                                \
+        iloix3rr(W(XD), W(XS), W(XT))
+
+#define iloox3ld(XD, XS, MT, DT)                                            \
+        iloix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* iloix3rr */
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#ifdef ihiix3rr
+
+#define ihiox_rr(XG, XS)                                                    \
+        ihiix_rr(W(XG), W(XS))
+
+#define ihiox_ld(XG, MS, DS)                                                \
+        ihiix_ld(W(XG), W(MS), W(DS))
+
+#define ihiox3rr(XD, XS, XT)                                                \
+        ihiix3rr(W(XD), W(XS), W(XT))
+
+#define ihiox3ld(XD, XS, MT, DT)                                            \
+        ihiix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ihiix3rr */
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#ifdef revix_rr
+
+#define revox_rx(XG)                                                        \
+        revix_rx(W(XG))
+
+#define revox_rr(XD, XS)                                                    \
+        revix_rr(W(XD), W(XS))
+
+#endif /* revix_rr */
+
+/* adh, mnh, mxh (D = S[0] op S[1] op ... op S[n]) in lowest element of D */
+
+#ifdef adhis_rr
+
+#define adhos_rr(XD, XS)                                                    \
+        adhis_rr(W(XD), W(XS))
+
+#define adhos_ld(XD, MS, DS)                                                \
+        adhis_ld(W(XD), W(MS), W(DS))
+
+#define mnhos_rr(XD, XS)                                                    \
+        mnhis_rr(W(XD), W(XS))
+
+#define mnhos_ld(XD, MS, DS)                                                \
+        mnhis_ld(W(XD), W(MS), W(DS))
+
+#define mxhos_rr(XD, XS)                                                    \
+        mxhis_rr(W(XD), W(XS))
+
+#define mxhos_ld(XD, MS, DS)                                                \
+        mxhis_ld(W(XD), W(MS), W(DS))
+
+#endif /* adhis_rr */
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andox_rr(XG, XS)                                                    \
+        andix_rr(W(XG), W(XS))
+
+#define andox_ld(XG, MS, DS)                                                \
+        andix_ld(W(XG), W(MS), W(DS))
+
+#define andox3rr(XD, XS, XT)                                                \
+        andix3rr(W(XD), W(XS), W(XT))
+
+#define andox3ld(XD, XS, MT, DT)                                            \
+        andix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annox_rr(XG, XS)                                                    \
+        annix_rr(W(XG), W(XS))
+
+#define annox_ld(XG, MS, DS)                                                \
+        annix_ld(W(XG), W(MS), W(DS))
+
+#define annox3rr(XD, XS, XT)                                                \
+        annix3rr(W(XD), W(XS), W(XT))
+
+#define annox3ld(XD, XS, MT, DT)                                            \
+        annix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrox_rr(XG, XS)                                                    \
+        orrix_rr(W(XG), W(XS))
+
+#define orrox_ld(XG, MS, DS)                                                \
+        orrix_ld(W(XG), W(MS), W(DS))
+
+#define orrox3rr(XD, XS, XT)                                                \
+        orrix3rr(W(XD), W(XS), W(XT))
+
+#define orrox3ld(XD, XS, MT, DT)                                            \
+        orrix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornox_rr(XG, XS)                                                    \
+        ornix_rr(W(XG), W(XS))
+
+#define ornox_ld(XG, MS, DS)                                                \
+        ornix_ld(W(XG), W(MS), W(DS))
+
+#define ornox3rr(XD, XS, XT)                                                \
+        ornix3rr(W(XD), W(XS), W(XT))
+
+#define ornox3ld(XD, XS, MT, DT)                                            \
+        ornix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorox_rr(XG, XS)                                                    \
+        xorix_rr(W(XG), W(XS))
+
+#define xorox_ld(XG, MS, DS)                                                \
+        xorix_ld(W(XG), W(MS), W(DS))
+
+#define xorox3rr(XD, XS, XT)                                                \
+        xorix3rr(W(XD), W(XS), W(XT))
+
+#define xorox3ld(XD, XS, MT, DT)                                            \
+        xorix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* not (G = ~G), (D = ~S) */
+
+#define notox_rx(XG)                                                        \
+        notix_rx(W(XG))
+
+#define notox_rr(XD, XS)                                                    \
+        notix_rr(W(XD), W(XS))
+
+/************   packed single-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negos_rx(XG)                                                        \
+        negis_rx(W(XG))
+
+#define negos_rr(XD, XS)                                                    \
+        negis_rr(W(XD), W(XS))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addos_rr(XG, XS)                                                    \
+        addis_rr(W(XG), W(XS))
+
+#define addos_ld(XG, MS, DS)                                                \
+        addis_ld(W(XG), W(MS), W(DS))
+
+#define addos3rr(XD, XS, XT)                                                \
+        addis3rr(W(XD), W(XS), W(XT))
+
+#define addos3ld(XD, XS, MT, DT)                                            \
+        addis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subos_rr(XG, XS)                                                    \
+        subis_rr(W(XG), W(XS))
+
+#define subos_ld(XG, MS, DS)                                                \
+        subis_ld(W(XG), W(MS), W(DS))
+
+#define subos3rr(XD, XS, XT)                                                \
+        subis3rr(W(XD), W(XS), W(XT))
+
+#define subos3ld(XD, XS, MT, DT)                                            \
+        subis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulos_rr(XG, XS)                                                    \
+        mulis_rr(W(XG), W(XS))
+
+#define mulos_ld(XG, MS, DS)                                                \
+        mulis_ld(W(XG), W(MS), W(DS))
+
+#define mulos3rr(XD, XS, XT)                                                \
+        mulis3rr(W(XD), W(XS), W(XT))
+
+#define mulos3ld(XD, XS, MT, DT)                                            \
+        mulis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divos_rr(XG, XS)                                                    \
+        divis_rr(W(XG), W(XS))
+
+#define divos_ld(XG, MS, DS)                                                \
+        divis_ld(W(XG), W(MS), W(DS))
+
+#define divos3rr(XD, XS, XT)                                                \
+        divis3rr(W(XD), W(XS), W(XT))
+
+#define divos3ld(XD, XS, MT, DT)                                            \
+        divis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sqr (D = sqrt S) */
+
+#define sqros_rr(XD, XS)                                                    \
+        sqris_rr(W(XD), W(XS))
+
+#define sqros_ld(XD, MS, DS)                                                \
+        sqris_ld(W(XD), W(MS), W(DS))
+
+/* cbr (D = cbrt S) */
+
+#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbris_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbeis_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbsis_rr(W(XG), W(X1), W(X2), W(XS))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpos_rr(XD, XS) /* destroys XS */                                  \
+        rcpis_rr(W(XD), W(XS))
+
+#define rceos_rr(XD, XS)                                                    \
+        rceis_rr(W(XD), W(XS))
+
+#define rcsos_rr(XG, XS) /* destroys XS */                                  \
+        rcsis_rr(W(XG), W(XS))
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqos_rr(XD, XS) /* destroys XS */                                  \
+        rsqis_rr(W(XD), W(XS))
+
+#define rseos_rr(XD, XS)                                                    \
+        rseis_rr(W(XD), W(XS))
+
+#define rssos_rr(XG, XS) /* destroys XS */                                  \
+        rssis_rr(W(XG), W(XS))
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmaos_rr(XG, XS, XT)                                                \
+        fmais_rr(W(XG), W(XS), W(XT))
+
+#define fmaos_ld(XG, XS, MT, DT)                                            \
+        fmais_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#define fmsos_rr(XG, XS, XT)                                                \
+        fmsis_rr(W(XG), W(XS), W(XT))
+
+#define fmsos_ld(XG, XS, MT, DT)                                            \
+        fmsis_ld(W(XG), W(XS), W(MT), W(DT))
+
+/*************   packed single-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minos_rr(XG, XS)                                                    \
+        minis_rr(W(XG), W(XS))
+
+#define minos_ld(XG, MS, DS)                                                \
+        minis_ld(W(XG), W(MS), W(DS))
+
+#define minos3rr(XD, XS, XT)                                                \
+        minis3rr(W(XD), W(XS), W(XT))
+
+#define minos3ld(XD, XS, MT, DT)                                            \
+        minis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxos_rr(XG, XS)                                                    \
+        maxis_rr(W(XG), W(XS))
+
+#define maxos_ld(XG, MS, DS)                                                \
+        maxis_ld(W(XG), W(MS), W(DS))
+
+#define maxos3rr(XD, XS, XT)                                                \
+        maxis3rr(W(XD), W(XS), W(XT))
+
+#define maxos3ld(XD, XS, MT, DT)                                            \
+        maxis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqos_rr(XG, XS)                                                    \
+        ceqis_rr(W(XG), W(XS))
+
+#define ceqos_ld(XG, MS, DS)                                                \
+        ceqis_ld(W(XG), W(MS), W(DS))
+
+#define ceqos3rr(XD, XS, XT)                                                \
+        ceqis3rr(W(XD), W(XS), W(XT))
+
+#define ceqos3ld(XD, XS, MT, DT)                                            \
+        ceqis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneos_rr(XG, XS)                                                    \
+        cneis_rr(W(XG), W(XS))
+
+#define cneos_ld(XG, MS, DS)                                                \
+        cneis_ld(W(XG), W(MS), W(DS))
+
+#define cneos3rr(XD, XS, XT)                                                \
+        cneis3rr(W(XD), W(XS), W(XT))
+
+#define cneos3ld(XD, XS, MT, DT)                                            \
+        cneis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltos_rr(XG, XS)                                                    \
+        cltis_rr(W(XG), W(XS))
+
+#define cltos_ld(XG, MS, DS)                                                \
+        cltis_ld(W(XG), W(MS), W(DS))
+
+#define cltos3rr(XD, XS, XT)                                                \
+        cltis3rr(W(XD), W(XS), W(XT))
+
+#define cltos3ld(XD, XS, MT, DT)                                            \
+        cltis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define cleos_rr(XG, XS)                                                    \
+        cleis_rr(W(XG), W(XS))
+
+#define cleos_ld(XG, MS, DS)                                                \
+        cleis_ld(W(XG), W(MS), W(DS))
+
+#define cleos3rr(XD, XS, XT)                                                \
+        cleis3rr(W(XD), W(XS), W(XT))
+
+#define cleos3ld(XD, XS, MT, DT)                                            \
+        cleis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtos_rr(XG, XS)                                                    \
+        cgtis_rr(W(XG), W(XS))
+
+#define cgtos_ld(XG, MS, DS)                                                \
+        cgtis_ld(W(XG), W(MS), W(DS))
+
+#define cgtos3rr(XD, XS, XT)                                                \
+        cgtis3rr(W(XD), W(XS), W(XT))
+
+#define cgtos3ld(XD, XS, MT, DT)                                            \
+        cgtis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgeos_rr(XG, XS)                                                    \
+        cgeis_rr(W(XG), W(XS))
+
+#define cgeos_ld(XG, MS, DS)                                                \
+        cgeis_ld(W(XG), W(MS), W(DS))
+
+#define cgeos3rr(XD, XS, XT)                                                \
+        cgeis3rr(W(XD), W(XS), W(XT))
+
+#define cgeos3ld(XD, XS, MT, DT)                                            \
+        cgeis3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        mkjix_rx(W(XS), mask, lb)
+
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#ifdef mkbix_rr
+
+#define mkbox_rr(RD, XS)                                                    \
+        mkbix_rr(W(RD), W(XS))
+
+#endif /* mkbix_rr */
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#ifdef mkcix_rr
+
+#define mkcox_rr(RD, XS)                                                    \
+        mkcix_rr(W(RD), W(XS))
+
+#endif /* mkcix_rr */
+
+/*************   packed single-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnzos_rr(XD, XS)     /* round towards zero */                       \
+        rnzis_rr(W(XD), W(XS))
+
+#define rnzos_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzis_ld(W(XD), W(MS), W(DS))
+
+#define cvzos_rr(XD, XS)     /* round towards zero */                       \
+        cvzis_rr(W(XD), W(XS))
+
+#define cvzos_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzis_ld(W(XD), W(MS), W(DS))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnpos_rr(XD, XS)     /* round towards +inf */                       \
+        rnpis_rr(W(XD), W(XS))
+
+#define rnpos_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpis_ld(W(XD), W(MS), W(DS))
+
+#define cvpos_rr(XD, XS)     /* round towards +inf */                       \
+        cvpis_rr(W(XD), W(XS))
+
+#define cvpos_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpis_ld(W(XD), W(MS), W(DS))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnmos_rr(XD, XS)     /* round towards -inf */                       \
+        rnmis_rr(W(XD), W(XS))
+
+#define rnmos_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmis_ld(W(XD), W(MS), W(DS))
+
+#define cvmos_rr(XD, XS)     /* round towards -inf */                       \
+        cvmis_rr(W(XD), W(XS))
+
+#define cvmos_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmis_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnnos_rr(XD, XS)     /* round towards near */                       \
+        rnnis_rr(W(XD), W(XS))
+
+#define rnnos_ld(XD, MS, DS) /* round towards near */                       \
+        rnnis_ld(W(XD), W(MS), W(DS))
+
+#define cvnos_rr(XD, XS)     /* round towards near */                       \
+        cvnis_rr(W(XD), W(XS))
+
+#define cvnos_ld(XD, MS, DS) /* round towards near */                       \
+        cvnis_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnon_rr(XD, XS)     /* round towards near */                       \
+        cvnin_rr(W(XD), W(XS))
+
+#define cvnon_ld(XD, MS, DS) /* round towards near */                       \
+        cvnin_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rndos_rr(XD, XS)                                                    \
+        rndis_rr(W(XD), W(XS))
+
+#define rndos_ld(XD, MS, DS)                                                \
+        rndis_ld(W(XD), W(MS), W(DS))
+
+#define cvtos_rr(XD, XS)                                                    \
+        cvtis_rr(W(XD), W(XS))
+
+#define cvtos_ld(XD, MS, DS)                                                \
+        cvtis_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+
+#define cvton_rr(XD, XS)                                                    \
+        cvtin_rr(W(XD), W(XS))
+
+#define cvton_ld(XD, MS, DS)                                                \
+        cvtin_ld(W(XD), W(MS), W(DS))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnros_rr(XD, XS, mode)                                              \
+        rnris_rr(W(XD), W(XS), mode)
+
+#define cvros_rr(XD, XS, mode)                                              \
+        cvris_rr(W(XD), W(XS), mode)
+
+/* cvs (D = fp64-to-fp32 S, T)
+ * fp64 elements of S/T are narrowed to lower/upper half of fp32 elements,
+ * rounding mode comes from fp control register (set in FCTRL blocks) */
+
+#define cvsos_rr(XD, XS, XT)                                                \
+        cvsis_rr(W(XD), W(XS), W(XT))
+
+/* cvf (D = fp16-to-fp32 S), loads half-width memory, see var-len section */
+
+#ifdef cvfis_ld
+
+#define cvfos_ld(XD, MS, DS)                                                \
+        cvfis_ld(W(XD), W(MS), W(DS))
+
+#endif /* cvfis_ld */
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory, see var-len section */
+
+#ifdef cvfis_st
+
+#define cvfos_st(XS, MD, DD)                                                \
+        cvfis_st(W(XS), W(MD), W(DD))
+
+#endif /* cvfis_st */
+
+/************   packed single-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addox_rr(XG, XS)                                                    \
+        addix_rr(W(XG), W(XS))
+
+#define addox_ld(XG, MS, DS)                                                \
+        addix_ld(W(XG), W(MS), W(DS))
+
+#define addox3rr(XD, XS, XT)                                                \
+        addix3rr(W(XD), W(XS), W(XT))
+
+#define addox3ld(XD, XS, MT, DT)                                            \
+        addix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subox_rr(XG, XS)                                                    \
+        subix_rr(W(XG), W(XS))
+
+#define subox_ld(XG, MS, DS)                                                \
+        subix_ld(W(XG), W(MS), W(DS))
+
+#define subox3rr(XD, XS, XT)                                                \
+        subix3rr(W(XD), W(XS), W(XT))
+
+#define subox3ld(XD, XS, MT, DT)                                            \
+        subix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* abs (G = |G|), (D = |S|) - signed */
+
+#ifdef absin_rr
+
+#define abson_rx(XG)                                                        \
+        absin_rx(W(XG))
+
+#define abson_rr(XD, XS)                                                    \
+        absin_rr(W(XD), W(XS))
+
+#endif /* absin_rr */
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#ifdef mulix_rr
+
+#define mulox_rr(XG, XS)                                                    \
+        mulix_rr(W(XG), W(XS))
+
+#define mulox_ld(XG, MS, DS)                                                \
+        mulix_ld(W(XG), W(MS), W(DS))
+
+#define mulox3rr(XD, XS, XT)                                                \
+        mulix3rr(W(XD), W(XS), W(XT))
+
+#define mulox3ld(XD, XS, MT, DT)                                            \
+        mulix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* mulix_rr */
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlox_ri(XG, IS)                                                    \
+        shlix_ri(W(XG), W(IS))
+
+#define shlox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shlix_ld(W(XG), W(MS), W(DS))
+
+#define shlox3ri(XD, XS, IT)                                                \
+        shlix3ri(W(XD), W(XS), W(IT))
+
+#define shlox3ld(XD, XS, MT, DT)                                            \
+        shlix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrox_ri(XG, IS)                                                    \
+        shrix_ri(W(XG), W(IS))
+
+#define shrox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrix_ld(W(XG), W(MS), W(DS))
+
+#define shrox3ri(XD, XS, IT)                                                \
+        shrix3ri(W(XD), W(XS), W(IT))
+
+#define shrox3ld(XD, XS, MT, DT)                                            \
+        shrix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shron_ri(XG, IS)                                                    \
+        shrin_ri(W(XG), W(IS))
+
+#define shron_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrin_ld(W(XG), W(MS), W(DS))
+
+#define shron3ri(XD, XS, IT)                                                \
+        shrin3ri(W(XD), W(XS), W(IT))
+
+#define shron3ld(XD, XS, MT, DT)                                            \
+        shrin3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svlox_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svlix_rr(W(XG), W(XS))
+
+#define svlox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svlix_ld(W(XG), W(MS), W(DS))
+
+#define svlox3rr(XD, XS, XT)                                                \
+        svlix3rr(W(XD), W(XS), W(XT))
+
+#define svlox3ld(XD, XS, MT, DT)                                            \
+        svlix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrox_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrix_rr(W(XG), W(XS))
+
+#define svrox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrix_ld(W(XG), W(MS), W(DS))
+
+#define svrox3rr(XD, XS, XT)                                                \
+        svrix3rr(W(XD), W(XS), W(XT))
+
+#define svrox3ld(XD, XS, MT, DT)                                            \
+        svrix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svron_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrin_rr(W(XG), W(XS))
+
+#define svron_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrin_ld(W(XG), W(MS), W(DS))
+
+#define svron3rr(XD, XS, XT)                                                \
+        svrin3rr(W(XD), W(XS), W(XT))
+
+#define svron3ld(XD, XS, MT, DT)                                            \
+        svrin3ld(W(XD), W(XS), W(MT), W(DT))
+
+/****************   packed single-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#ifdef minix_rr
+
+#define minox_rr(XG, XS)                                                    \
+        minix_rr(W(XG), W(XS))
+
+#define minox_ld(XG, MS, DS)                                                \
+        minix_ld(W(XG), W(MS), W(DS))
+
+#define minox3rr(XD, XS, XT)                                                \
+        minix3rr(W(XD), W(XS), W(XT))
+
+#define minox3ld(XD, XS, MT, DT)                                            \
+        minix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* minix_rr */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#ifdef minin_rr
+
+#define minon_rr(XG, XS)                                                    \
+        minin_rr(W(XG), W(XS))
+
+#define minon_ld(XG, MS, DS)                                                \
+        minin_ld(W(XG), W(MS), W(DS))
+
+#define minon3rr(XD, XS, XT)                                                \
+        minin3rr(W(XD), W(XS), W(XT))
+
+#define minon3ld(XD, XS, MT, DT)                                            \
+        minin3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* minin_rr */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#ifdef maxix_rr
+
+#define maxox_rr(XG, XS)                                                    \
+        maxix_rr(W(XG), W(XS))
+
+#define maxox_ld(XG, MS, DS)                                                \
+        maxix_ld(W(XG), W(MS), W(DS))
+
+#define maxox3rr(XD, XS, XT)                                                \
+        maxix3rr(W(XD), W(XS), W(XT))
+
+#define maxox3ld(XD, XS, MT, DT)                                            \
+        maxix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* maxix_rr */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#ifdef maxin_rr
+
+#define maxon_rr(XG, XS)                                                    \
+        maxin_rr(W(XG), W(XS))
+
+#define maxon_ld(XG, MS, DS)                                                \
+        maxin_ld(W(XG), W(MS), W(DS))
+
+#define maxon3rr(XD, XS, XT)                                                \
+        maxin3rr(W(XD), W(XS), W(XT))
+
+#define maxon3ld(XD, XS, MT, DT)                                            \
+        maxin3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* maxin_rr */
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#ifdef ceqix_rr
+
+#define ceqox_rr(XG, XS)                                                    \
+        ceqix_rr(W(XG), W(XS))
+
+#define ceqox_ld(XG, MS, DS)                                                \
+        ceqix_ld(W(XG), W(MS), W(DS))
+
+#define ceqox3rr(XD, XS, XT)                                                \
+        ceqix3rr(W(XD), W(XS), W(XT))
+
+#define ceqox3ld(XD, XS, MT, DT)                                            \
+        ceqix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ceqix_rr */
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#ifdef cneix_rr
+
+#define cneox_rr(XG, XS)                                                    \
+        cneix_rr(W(XG), W(XS))
+
+#define cneox_ld(XG, MS, DS)                                                \
+        cneix_ld(W(XG), W(MS), W(DS))
+
+#define cneox3rr(XD, XS, XT)                                                \
+        cneix3rr(W(XD), W(XS), W(XT))
+
+#define cneox3ld(XD, XS, MT, DT)                                            \
+        cneix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cneix_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cltix_rr
+
+#define cltox_rr(XG, XS)                                                    \
+        cltix_rr(W(XG), W(XS))
+
+#define cltox_ld(XG, MS, DS)                                                \
+        cltix_ld(W(XG), W(MS), W(DS))
+
+#define cltox3rr(XD, XS, XT)                                                \
+        cltix3rr(W(XD), W(XS), W(XT))
+
+#define cltox3ld(XD, XS, MT, DT)                                            \
+        cltix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cltix_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cltin_rr
+
+#define clton_rr(XG, XS)                                                    \
+        cltin_rr(W(XG), W(XS))
+
+#define clton_ld(XG, MS, DS)                                                \
+        cltin_ld(W(XG), W(MS), W(DS))
+
+#define clton3rr(XD, XS, XT)                                                \
+        cltin3rr(W(XD), W(XS), W(XT))
+
+#define clton3ld(XD, XS, MT, DT)                                            \
+        cltin3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cltin_rr */
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cleix_rr
+
+#define cleox_rr(XG, XS)                                                    \
+        cleix_rr(W(XG), W(XS))
+
+#define cleox_ld(XG, MS, DS)                                                \
+        cleix_ld(W(XG), W(MS), W(DS))
+
+#define cleox3rr(XD, XS, XT)                                                \
+        cleix3rr(W(XD), W(XS), W(XT))
+
+#define cleox3ld(XD, XS, MT, DT)                                            \
+        cleix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cleix_rr */
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef clein_rr
+
+#define cleon_rr(XG, XS)                                                    \
+        clein_rr(W(XG), W(XS))
+
+#define cleon_ld(XG, MS, DS)                                                \
+        clein_ld(W(XG), W(MS), W(DS))
+
+#define cleon3rr(XD, XS, XT)                                                \
+        clein3rr(W(XD), W(XS), W(XT))
+
+#define cleon3ld(XD, XS, MT, DT)                                            \
+        clein3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* clein_rr */
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cgtix_rr
+
+#define cgtox_rr(XG, XS)                                                    \
+        cgtix_rr(W(XG), W(XS))
+
+#define cgtox_ld(XG, MS, DS)                                                \
+        cgtix_ld(W(XG), W(MS), W(DS))
+
+#define cgtox3rr(XD, XS, XT)                                                \
+        cgtix3rr(W(XD), W(XS), W(XT))
+
+#define cgtox3ld(XD, XS, MT, DT)                                            \
+        cgtix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgtix_rr */
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cgtin_rr
+
+#define cgton_rr(XG, XS)                                                    \
+        cgtin_rr(W(XG), W(XS))
+
+#define cgton_ld(XG, MS, DS)                                                \
+        cgtin_ld(W(XG), W(MS), W(DS))
+
+#define cgton3rr(XD, XS, XT)                                                \
+        cgtin3rr(W(XD), W(XS), W(XT))
+
+#define cgton3ld(XD, XS, MT, DT)                                            \
+        cgtin3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgtin_rr */
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cgeix_rr
+
+#define cgeox_rr(XG, XS)                                                    \
+        cgeix_rr(W(XG), W(XS))
+
+#define cgeox_ld(XG, MS, DS)                                                \
+        cgeix_ld(W(XG), W(MS), W(DS))
+
+#define cgeox3rr(XD, XS, XT)                                                \
+        cgeix3rr(W(XD), W(XS), W(XT))
+
+#define cgeox3ld(XD, XS, MT, DT)                                            \
+        cgeix3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgeix_rr */
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cgein_rr
+
+#define cgeon_rr(XG, XS)                                                    \
+        cgein_rr(W(XG), W(XS))
+
+#define cgeon_ld(XG, MS, DS)                                                \
+        cgein_ld(W(XG), W(MS), W(DS))
+
+#define cgeon3rr(XD, XS, XT)                                                \
+        cgein3rr(W(XD), W(XS), W(XT))
+
+#define cgeon3ld(XD, XS, MT, DT)                                            \
+        cgein3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgein_rr */
+
+/*
+ * common 128-bit floating-point SIMD instructions with 32-bit elements
+ */
+
+/* cbr (D = cbrt S) */
+
+/*
+ * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
+ * available at http://www.musicdsp.org/showone.php?id=206
+ * converted to S-way SIMD version by VectorChief.
+ */
+#define cbris_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbeis_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsis_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsis_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsis_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeis_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        /* cube root estimate, the exponent is divided by three             \
+         * in such a way that remainder bits get shoved into                \
+         * the top of the normalized mantissa */                            \
+        movix_ld(W(X2), Mebp, inf_GPC04_32)                                 \
+        movix_rr(W(XD), W(XS))                                              \
+        andix_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
+        subix_ld(W(XD), Mebp, inf_GPC05_32) /* convert to 2's complement */ \
+        shrin_ri(W(XD), IB(10))  /* XD / 1024 */                            \
+        movix_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
+        shlix_ri(W(X1), IB(2))                                              \
+        addix_rr(W(XD), W(X1))                                              \
+        shlix_ri(W(X1), IB(2))                                              \
+        addix_rr(W(XD), W(X1))                                              \
+        shlix_ri(W(X1), IB(2))                                              \
+        addix_rr(W(XD), W(X1))                                              \
+        shlix_ri(W(X1), IB(2))                                              \
+        addix_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
+        addix_ld(W(XD), Mebp, inf_GPC05_32) /* back to biased-127 */        \
+        andix_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
+        annix_rr(W(X2), W(XS))   /* original sign */                        \
+        orrix_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+
+#define cbsis_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movix_rr(W(X1), W(XG))                                              \
+        mulis_rr(W(X1), W(XG))                                              \
+        movix_rr(W(X2), W(X1))                                              \
+        mulis_ld(W(X1), Mebp, inf_GPC03_32)                                 \
+        rceis_rr(W(X1), W(X1))                                              \
+        mulis_rr(W(X2), W(XG))                                              \
+        subis_rr(W(X2), W(XS))                                              \
+        mulis_rr(W(X2), W(X1))                                              \
+        subis_rr(W(XG), W(X2))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcpis_rr(XD, XS) /* destroys XS */                                  \
+        rceis_rr(W(XD), W(XS))                                              \
+        rcsis_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcpis_rr(XD, XS) /* destroys XS */                                  \
+        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divis_rr(W(XD), W(XS))
+
+#define rceis_rr(XD, XS)                                                    \
+        movix_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divis_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcsis_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqis_rr(XD, XS) /* destroys XS */                                  \
+        rseis_rr(W(XD), W(XS))                                              \
+        rssis_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqis_rr(XD, XS) /* destroys XS */                                  \
+        sqris_rr(W(XS), W(XS))                                              \
+        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divis_rr(W(XD), W(XS))
+
+#define rseis_rr(XD, XS)                                                    \
+        sqris_rr(W(XD), W(XS))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divis_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rssis_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmais_rr(XG, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulis_rr(W(XS), W(XT))                                              \
+        addis_rr(W(XG), W(XS))                                              \
+        movix_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmais_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulis_ld(W(XS), W(MT), W(DT))                                       \
+        addis_rr(W(XG), W(XS))                                              \
+        movix_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmsis_rr(XG, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulis_rr(W(XS), W(XT))                                              \
+        subis_rr(W(XG), W(XS))                                              \
+        movix_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsis_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulis_ld(W(XS), W(MT), W(DT))                                       \
+        subis_rr(W(XG), W(XS))                                              \
+        movix_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+#endif /* RT_SIMD: 512, 256, 128 */
+
+/******************************************************************************/
+/**** scalar ***** SIMD instructions with fixed-32-bit-element ****************/
+/******************************************************************************/
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcprs_rr(XD, XS) /* destroys XS */                                  \
+        rcers_rr(W(XD), W(XS))                                              \
+        rcsrs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcprs_rr(XD, XS) /* destroys XS */                                  \
+        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divrs_rr(W(XD), W(XS))
+
+#define rcers_rr(XD, XS)                                                    \
+        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divrs_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcsrs_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqrs_rr(XD, XS) /* destroys XS */                                  \
+        rsers_rr(W(XD), W(XS))                                              \
+        rssrs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqrs_rr(XD, XS) /* destroys XS */                                  \
+        sqrrs_rr(W(XS), W(XS))                                              \
+        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divrs_rr(W(XD), W(XS))
+
+#define rsers_rr(XD, XS)                                                    \
+        sqrrs_rr(W(XD), W(XS))                                              \
+        movrs_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divrs_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rssrs_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmars_rr(XG, XS, XT)                                                \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_rr(W(XS), W(XT))                                              \
+        addrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmars_ld(XG, XS, MT, DT)                                            \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_ld(W(XS), W(MT), W(DT))                                       \
+        addrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmsrs_rr(XG, XS, XT)                                                \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_rr(W(XS), W(XT))                                              \
+        subrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsrs_ld(XG, XS, MT, DT)                                            \
+        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulrs_ld(W(XS), W(MT), W(DT))                                       \
+        subrs_rr(W(XG), W(XS))                                              \
+        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-64-bit-element **** 512-bit ***/
+/******************************************************************************/
+
+#if   (RT_SIMD >= 512)
+
+/*
+ * main block of var-len SIMD instructions is defined in 512/1K4/2K8-bit headers
+ */
+
+/* cbr (D = cbrt S) */
+
+/*
+ * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
+ * available at http://www.musicdsp.org/showone.php?id=206
+ * converted to S-way SIMD version by VectorChief.
+ */
+#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbeqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        /* cube root estimate, the exponent is divided by three             \
+         * in such a way that remainder bits get shoved into                \
+         * the top of the normalized mantissa */                            \
+        movqx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
+        movqx_rr(W(XD), W(XS))                                              \
+        andqx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
+        subqx_ld(W(XD), Mebp, inf_GPC05_64) /* convert to 2's complement */ \
+        shrqn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
+        movqx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
+        shlqx_ri(W(X1), IB(2))                                              \
+        addqx_rr(W(XD), W(X1))                                              \
+        shlqx_ri(W(X1), IB(2))                                              \
+        addqx_rr(W(XD), W(X1))                                              \
+        shlqx_ri(W(X1), IB(2))                                              \
+        addqx_rr(W(XD), W(X1))                                              \
+        shlqx_ri(W(X1), IB(2))                                              \
+        addqx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
+        addqx_ld(W(XD), Mebp, inf_GPC05_64) /* back to biased-127 */        \
+        andqx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
+        annqx_rr(W(X2), W(XS))   /* original sign */                        \
+        orrqx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+
+#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movqx_rr(W(X1), W(XG))                                              \
+        mulqs_rr(W(X1), W(XG))                                              \
+        movqx_rr(W(X2), W(X1))                                              \
+        mulqs_ld(W(X1), Mebp, inf_GPC03_64)                                 \
+        rceqs_rr(W(X1), W(X1))                                              \
+        mulqs_rr(W(X2), W(XG))                                              \
+        subqs_rr(W(X2), W(XS))                                              \
+        mulqs_rr(W(X2), W(X1))                                              \
+        subqs_rr(W(XG), W(X2))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
+        rceqs_rr(W(XD), W(XS))                                              \
+        rcsqs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
+        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divqs_rr(W(XD), W(XS))
+
+#define rceqs_rr(XD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divqs_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcsqs_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
+        rseqs_rr(W(XD), W(XS))                                              \
+        rssqs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
+        sqrqs_rr(W(XS), W(XS))                                              \
+        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divqs_rr(W(XD), W(XS))
+
+#define rseqs_rr(XD, XS)                                                    \
+        sqrqs_rr(W(XD), W(XS))                                              \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divqs_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rssqs_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmaqs_rr(XG, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulqs_rr(W(XS), W(XT))                                              \
+        addqs_rr(W(XG), W(XS))                                              \
+        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmaqs_ld(XG, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulqs_ld(W(XS), W(MT), W(DT))                                       \
+        addqs_rr(W(XG), W(XS))                                              \
+        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmsqs_rr(XG, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulqs_rr(W(XS), W(XT))                                              \
+        subqs_rr(W(XG), W(XS))                                              \
+        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsqs_ld(XG, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulqs_ld(W(XS), W(MT), W(DT))                                       \
+        subqs_rr(W(XG), W(XS))                                              \
+        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-64-bit-element **** 256-bit ***/
+/******************************************************************************/
+
+#elif (RT_SIMD == 256)
+
+/***************   packed double-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movqx_rr(XD, XS)                                                    \
+        movdx_rr(W(XD), W(XS))
+
+#define movqx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))
+
+#define movqx_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+
+#define mmvqx_ld(XG, MS, DS)                                                \
+        mmvdx_ld(W(XG), W(MS), W(DS))
+
+#define mmvqx_st(XS, MG, DG)                                                \
+        mmvdx_st(W(XS), W(MG), W(DG))
+
+#ifdef mmzdx_ld
+
+#define mmzqx_ld(XD, MS, DS)                                                \
+        mmzdx_ld(W(XD), W(MS), W(DS))
+
+#endif /* mmzdx_ld */
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#ifdef seldx_rr
+
+#define selqx_rr(XG, XM, XS)                                                \
+        seldx_rr(W(XG), W(XM), W(XS))
+
+#define selqx_ld(XG, XM, MS, DS)                                            \
+        seldx_ld(W(XG), W(XM), W(MS), W(DS))
+
+#define selqx3rr(XD, XM, XS, XT)                                            \
+        seldx3rr(W(XD), W(XM), W(XS), W(XT))
+
+#define selqx3ld(XD, XM, XS, MT, DT)                                        \
+        seldx3ld(W(XD), W(XM), W(XS), W(MT), W(DT))
+
+#endif /* seldx_rr */
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#ifdef spldx_rr
+
+#define splqx_rr(XD, RS)                                                    \
+        spldx_rr(W(XD), W(RS))
+
+#define splqx_ld(XD, MS, DS)                                                \
+        spldx_ld(W(XD), W(MS), W(DS))
+
+#endif /* spldx_rr */
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#ifdef extdx_rr
+
+#define extqx_rr(RD, XS, IS)                                                \
+        extdx_rr(W(RD), W(XS), W(IS))
+
+#endif /* extdx_rr */
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#ifdef insdx_rr
+
+#define insqx_rr(XG, RS, IS)                                                \
+        insdx_rr(W(XG), W(RS), W(IS))
+
+#endif /* insdx_rr */
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#ifdef shfdx3ri
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfdx_ri(W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        shfdx3ri(W(XD), W(XS), W(IT))
+
+#endif /* shfdx3ri */
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#ifdef ilodx3rr
+
+#define iloqx_rr(XG, XS)                                                    \
+        ilodx_rr(W(XG), W(XS))
+
+#define iloqx_ld(XG, MS, DS)                                                \
+        ilodx_ld(W(XG), W(MS), W(DS))
+
+#define iloqx3rr(XD, XS, XT)                                                \
+        ilodx3rr(W(XD), W(XS), W(XT))
+
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+        ilodx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ilodx3rr */
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#ifdef ihidx3rr
+
+#define ihiqx_rr(XG, XS)                                                    \
+        ihidx_rr(W(XG), W(XS))
+
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihidx_ld(W(XG), W(MS), W(DS))
+
+#define ihiqx3rr(XD, XS, XT)                                                \
+        ihidx3rr(W(XD), W(XS), W(XT))
+
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+        ihidx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ihidx3rr */
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#ifdef revdx_rr
+
+#define revqx_rx(XG)                                                        \
+        revdx_rx(W(XG))
+
+#define revqx_rr(XD, XS)                                                    \
+        revdx_rr(W(XD), W(XS))
+
+#endif /* revdx_rr */
+
+/* adh, mnh, mxh (D = S[0] op S[1] op ... op S[n]) in lowest element of D */
+
+#ifdef adhds_rr
+
+#define adhqs_rr(XD, XS)                                                    \
+        adhds_rr(W(XD), W(XS))
+
+#define adhqs_ld(XD, MS, DS)                                                \
+        adhds_ld(W(XD), W(MS), W(DS))
+
+#define mnhqs_rr(XD, XS)                                                    \
+        mnhds_rr(W(XD), W(XS))
+
+#define mnhqs_ld(XD, MS, DS)                                                \
+        mnhds_ld(W(XD), W(MS), W(DS))
+
+#define mxhqs_rr(XD, XS)                                                    \
+        mxhds_rr(W(XD), W(XS))
+
+#define mxhqs_ld(XD, MS, DS)                                                \
+        mxhds_ld(W(XD), W(MS), W(DS))
+
+#endif /* adhds_rr */
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andqx_rr(XG, XS)                                                    \
+        anddx_rr(W(XG), W(XS))
+
+#define andqx_ld(XG, MS, DS)                                                \
+        anddx_ld(W(XG), W(MS), W(DS))
+
+#define andqx3rr(XD, XS, XT)                                                \
+        anddx3rr(W(XD), W(XS), W(XT))
+
+#define andqx3ld(XD, XS, MT, DT)                                            \
+        anddx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annqx_rr(XG, XS)                                                    \
+        anndx_rr(W(XG), W(XS))
+
+#define annqx_ld(XG, MS, DS)                                                \
+        anndx_ld(W(XG), W(MS), W(DS))
+
+#define annqx3rr(XD, XS, XT)                                                \
+        anndx3rr(W(XD), W(XS), W(XT))
+
+#define annqx3ld(XD, XS, MT, DT)                                            \
+        anndx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrqx_rr(XG, XS)                                                    \
+        orrdx_rr(W(XG), W(XS))
+
+#define orrqx_ld(XG, MS, DS)                                                \
+        orrdx_ld(W(XG), W(MS), W(DS))
+
+#define orrqx3rr(XD, XS, XT)                                                \
+        orrdx3rr(W(XD), W(XS), W(XT))
+
+#define orrqx3ld(XD, XS, MT, DT)                                            \
+        orrdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornqx_rr(XG, XS)                                                    \
+        orndx_rr(W(XG), W(XS))
+
+#define ornqx_ld(XG, MS, DS)                                                \
+        orndx_ld(W(XG), W(MS), W(DS))
+
+#define ornqx3rr(XD, XS, XT)                                                \
+        orndx3rr(W(XD), W(XS), W(XT))
+
+#define ornqx3ld(XD, XS, MT, DT)                                            \
+        orndx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorqx_rr(XG, XS)                                                    \
+        xordx_rr(W(XG), W(XS))
+
+#define xorqx_ld(XG, MS, DS)                                                \
+        xordx_ld(W(XG), W(MS), W(DS))
+
+#define xorqx3rr(XD, XS, XT)                                                \
+        xordx3rr(W(XD), W(XS), W(XT))
+
+#define xorqx3ld(XD, XS, MT, DT)                                            \
+        xordx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* not (G = ~G), (D = ~S) */
+
+#define notqx_rx(XG)                                                        \
+        notdx_rx(W(XG))
+
+#define notqx_rr(XD, XS)                                                    \
+        notdx_rr(W(XD), W(XS))
+
+/************   packed double-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negqs_rx(XG)                                                        \
+        negds_rx(W(XG))
+
+#define negqs_rr(XD, XS)                                                    \
+        negds_rr(W(XD), W(XS))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addqs_rr(XG, XS)                                                    \
+        addds_rr(W(XG), W(XS))
+
+#define addqs_ld(XG, MS, DS)                                                \
+        addds_ld(W(XG), W(MS), W(DS))
+
+#define addqs3rr(XD, XS, XT)                                                \
+        addds3rr(W(XD), W(XS), W(XT))
+
+#define addqs3ld(XD, XS, MT, DT)                                            \
+        addds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subqs_rr(XG, XS)                                                    \
+        subds_rr(W(XG), W(XS))
+
+#define subqs_ld(XG, MS, DS)                                                \
+        subds_ld(W(XG), W(MS), W(DS))
+
+#define subqs3rr(XD, XS, XT)                                                \
+        subds3rr(W(XD), W(XS), W(XT))
+
+#define subqs3ld(XD, XS, MT, DT)                                            \
+        subds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulqs_rr(XG, XS)                                                    \
+        mulds_rr(W(XG), W(XS))
+
+#define mulqs_ld(XG, MS, DS)                                                \
+        mulds_ld(W(XG), W(MS), W(DS))
+
+#define mulqs3rr(XD, XS, XT)                                                \
+        mulds3rr(W(XD), W(XS), W(XT))
+
+#define mulqs3ld(XD, XS, MT, DT)                                            \
+        mulds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divqs_rr(XG, XS)                                                    \
+        divds_rr(W(XG), W(XS))
+
+#define divqs_ld(XG, MS, DS)                                                \
+        divds_ld(W(XG), W(MS), W(DS))
+
+#define divqs3rr(XD, XS, XT)                                                \
+        divds3rr(W(XD), W(XS), W(XT))
+
+#define divqs3ld(XD, XS, MT, DT)                                            \
+        divds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sqr (D = sqrt S) */
+
+#define sqrqs_rr(XD, XS)                                                    \
+        sqrds_rr(W(XD), W(XS))
+
+#define sqrqs_ld(XD, MS, DS)                                                \
+        sqrds_ld(W(XD), W(MS), W(DS))
+
+/* cbr (D = cbrt S) */
+
+#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbrds_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbeds_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbsds_rr(W(XG), W(X1), W(X2), W(XS))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
+        rcpds_rr(W(XD), W(XS))
+
+#define rceqs_rr(XD, XS)                                                    \
+        rceds_rr(W(XD), W(XS))
+
+#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
+        rcsds_rr(W(XG), W(XS))
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
+        rsqds_rr(W(XD), W(XS))
+
+#define rseqs_rr(XD, XS)                                                    \
+        rseds_rr(W(XD), W(XS))
+
+#define rssqs_rr(XG, XS) /* destroys XS */                                  \
+        rssds_rr(W(XG), W(XS))
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmaqs_rr(XG, XS, XT)                                                \
+        fmads_rr(W(XG), W(XS), W(XT))
+
+#define fmaqs_ld(XG, XS, MT, DT)                                            \
+        fmads_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#define fmsqs_rr(XG, XS, XT)                                                \
+        fmsds_rr(W(XG), W(XS), W(XT))
+
+#define fmsqs_ld(XG, XS, MT, DT)                                            \
+        fmsds_ld(W(XG), W(XS), W(MT), W(DT))
+
+/*************   packed double-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minqs_rr(XG, XS)                                                    \
+        minds_rr(W(XG), W(XS))
+
+#define minqs_ld(XG, MS, DS)                                                \
+        minds_ld(W(XG), W(MS), W(DS))
+
+#define minqs3rr(XD, XS, XT)                                                \
+        minds3rr(W(XD), W(XS), W(XT))
+
+#define minqs3ld(XD, XS, MT, DT)                                            \
+        minds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxqs_rr(XG, XS)                                                    \
+        maxds_rr(W(XG), W(XS))
+
+#define maxqs_ld(XG, MS, DS)                                                \
+        maxds_ld(W(XG), W(MS), W(DS))
+
+#define maxqs3rr(XD, XS, XT)                                                \
+        maxds3rr(W(XD), W(XS), W(XT))
+
+#define maxqs3ld(XD, XS, MT, DT)                                            \
+        maxds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqqs_rr(XG, XS)                                                    \
+        ceqds_rr(W(XG), W(XS))
+
+#define ceqqs_ld(XG, MS, DS)                                                \
+        ceqds_ld(W(XG), W(MS), W(DS))
+
+#define ceqqs3rr(XD, XS, XT)                                                \
+        ceqds3rr(W(XD), W(XS), W(XT))
+
+#define ceqqs3ld(XD, XS, MT, DT)                                            \
+        ceqds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneqs_rr(XG, XS)                                                    \
+        cneds_rr(W(XG), W(XS))
+
+#define cneqs_ld(XG, MS, DS)                                                \
+        cneds_ld(W(XG), W(MS), W(DS))
+
+#define cneqs3rr(XD, XS, XT)                                                \
+        cneds3rr(W(XD), W(XS), W(XT))
+
+#define cneqs3ld(XD, XS, MT, DT)                                            \
+        cneds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltqs_rr(XG, XS)                                                    \
+        cltds_rr(W(XG), W(XS))
+
+#define cltqs_ld(XG, MS, DS)                                                \
+        cltds_ld(W(XG), W(MS), W(DS))
+
+#define cltqs3rr(XD, XS, XT)                                                \
+        cltds3rr(W(XD), W(XS), W(XT))
+
+#define cltqs3ld(XD, XS, MT, DT)                                            \
+        cltds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define cleqs_rr(XG, XS)                                                    \
+        cleds_rr(W(XG), W(XS))
+
+#define cleqs_ld(XG, MS, DS)                                                \
+        cleds_ld(W(XG), W(MS), W(DS))
+
+#define cleqs3rr(XD, XS, XT)                                                \
+        cleds3rr(W(XD), W(XS), W(XT))
+
+#define cleqs3ld(XD, XS, MT, DT)                                            \
+        cleds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtqs_rr(XG, XS)                                                    \
+        cgtds_rr(W(XG), W(XS))
+
+#define cgtqs_ld(XG, MS, DS)                                                \
+        cgtds_ld(W(XG), W(MS), W(DS))
+
+#define cgtqs3rr(XD, XS, XT)                                                \
+        cgtds3rr(W(XD), W(XS), W(XT))
+
+#define cgtqs3ld(XD, XS, MT, DT)                                            \
+        cgtds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgeqs_rr(XG, XS)                                                    \
+        cgeds_rr(W(XG), W(XS))
+
+#define cgeqs_ld(XG, MS, DS)                                                \
+        cgeds_ld(W(XG), W(MS), W(DS))
+
+#define cgeqs3rr(XD, XS, XT)                                                \
+        cgeds3rr(W(XD), W(XS), W(XT))
+
+#define cgeqs3ld(XD, XS, MT, DT)                                            \
+        cgeds3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        mkjdx_rx(W(XS), mask, lb)
+
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#ifdef mkbdx_rr
+
+#define mkbqx_rr(RD, XS)                                                    \
+        mkbdx_rr(W(RD), W(XS))
+
+#endif /* mkbdx_rr */
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#ifdef mkcdx_rr
+
+#define mkcqx_rr(RD, XS)                                                    \
+        mkcdx_rr(W(RD), W(XS))
+
+#endif /* mkcdx_rr */
+
+/*************   packed double-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnzqs_rr(XD, XS)     /* round towards zero */                       \
+        rnzds_rr(W(XD), W(XS))
+
+#define rnzqs_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzds_ld(W(XD), W(MS), W(DS))
+
+#define cvzqs_rr(XD, XS)     /* round towards zero */                       \
+        cvzds_rr(W(XD), W(XS))
+
+#define cvzqs_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzds_ld(W(XD), W(MS), W(DS))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnpqs_rr(XD, XS)     /* round towards +inf */                       \
+        rnpds_rr(W(XD), W(XS))
+
+#define rnpqs_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpds_ld(W(XD), W(MS), W(DS))
+
+#define cvpqs_rr(XD, XS)     /* round towards +inf */                       \
+        cvpds_rr(W(XD), W(XS))
+
+#define cvpqs_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpds_ld(W(XD), W(MS), W(DS))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnmqs_rr(XD, XS)     /* round towards -inf */                       \
+        rnmds_rr(W(XD), W(XS))
+
+#define rnmqs_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmds_ld(W(XD), W(MS), W(DS))
+
+#define cvmqs_rr(XD, XS)     /* round towards -inf */                       \
+        cvmds_rr(W(XD), W(XS))
+
+#define cvmqs_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmds_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnnqs_rr(XD, XS)     /* round towards near */                       \
+        rnnds_rr(W(XD), W(XS))
+
+#define rnnqs_ld(XD, MS, DS) /* round towards near */                       \
+        rnnds_ld(W(XD), W(MS), W(DS))
+
+#define cvnqs_rr(XD, XS)     /* round towards near */                       \
+        cvnds_rr(W(XD), W(XS))
+
+#define cvnqs_ld(XD, MS, DS) /* round towards near */                       \
+        cvnds_ld(W(XD), W(MS), W(DS))
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnqn_rr(XD, XS)     /* round towards near */                       \
+        cvndn_rr(W(XD), W(XS))
+
+#define cvnqn_ld(XD, MS, DS) /* round towards near */                       \
+        cvndn_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rndqs_rr(XD, XS)                                                    \
+        rndds_rr(W(XD), W(XS))
+
+#define rndqs_ld(XD, MS, DS)                                                \
+        rndds_ld(W(XD), W(MS), W(DS))
+
+#define cvtqs_rr(XD, XS)                                                    \
+        cvtds_rr(W(XD), W(XS))
+
+#define cvtqs_ld(XD, MS, DS)                                                \
+        cvtds_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+
+#define cvtqn_rr(XD, XS)                                                    \
+        cvtdn_rr(W(XD), W(XS))
+
+#define cvtqn_ld(XD, MS, DS)                                                \
+        cvtdn_ld(W(XD), W(MS), W(DS))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnrqs_rr(XD, XS, mode)                                              \
+        rnrds_rr(W(XD), W(XS), mode)
+
+#define cvrqs_rr(XD, XS, mode)                                              \
+        cvrds_rr(W(XD), W(XS), mode)
+
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        cvlds_rr(W(XD), W(XS))
+
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
+
+#define cvhqs_rr(XD, XS)                                                    \
+        cvhds_rr(W(XD), W(XS))
+
+/************   packed double-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addqx_rr(XG, XS)                                                    \
+        adddx_rr(W(XG), W(XS))
+
+#define addqx_ld(XG, MS, DS)                                                \
+        adddx_ld(W(XG), W(MS), W(DS))
+
+#define addqx3rr(XD, XS, XT)                                                \
+        adddx3rr(W(XD), W(XS), W(XT))
+
+#define addqx3ld(XD, XS, MT, DT)                                            \
+        adddx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subqx_rr(XG, XS)                                                    \
+        subdx_rr(W(XG), W(XS))
+
+#define subqx_ld(XG, MS, DS)                                                \
+        subdx_ld(W(XG), W(MS), W(DS))
+
+#define subqx3rr(XD, XS, XT)                                                \
+        subdx3rr(W(XD), W(XS), W(XT))
+
+#define subqx3ld(XD, XS, MT, DT)                                            \
+        subdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* abs (G = |G|), (D = |S|) - signed */
+
+#ifdef absdn_rr
+
+#define absqn_rx(XG)                                                        \
+        absdn_rx(W(XG))
+
+#define absqn_rr(XD, XS)                                                    \
+        absdn_rr(W(XD), W(XS))
+
+#endif /* absdn_rr */
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
+
+#ifdef muldx_rr
+
+#define mulqx_rr(XG, XS)                                                    \
+        muldx_rr(W(XG), W(XS))
+
+#define mulqx_ld(XG, MS, DS)                                                \
+        muldx_ld(W(XG), W(MS), W(DS))
+
+#define mulqx3rr(XD, XS, XT)                                                \
+        muldx3rr(W(XD), W(XS), W(XT))
+
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+        muldx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* muldx_rr */
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlqx_ri(XG, IS)                                                    \
+        shldx_ri(W(XG), W(IS))
+
+#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shldx_ld(W(XG), W(MS), W(DS))
+
+#define shlqx3ri(XD, XS, IT)                                                \
+        shldx3ri(W(XD), W(XS), W(IT))
+
+#define shlqx3ld(XD, XS, MT, DT)                                            \
+        shldx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrqx_ri(XG, IS)                                                    \
+        shrdx_ri(W(XG), W(IS))
+
+#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrdx_ld(W(XG), W(MS), W(DS))
+
+#define shrqx3ri(XD, XS, IT)                                                \
+        shrdx3ri(W(XD), W(XS), W(IT))
+
+#define shrqx3ld(XD, XS, MT, DT)                                            \
+        shrdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrqn_ri(XG, IS)                                                    \
+        shrdn_ri(W(XG), W(IS))
+
+#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrdn_ld(W(XG), W(MS), W(DS))
+
+#define shrqn3ri(XD, XS, IT)                                                \
+        shrdn3ri(W(XD), W(XS), W(IT))
+
+#define shrqn3ld(XD, XS, MT, DT)                                            \
+        shrdn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svldx_rr(W(XG), W(XS))
+
+#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svldx_ld(W(XG), W(MS), W(DS))
+
+#define svlqx3rr(XD, XS, XT)                                                \
+        svldx3rr(W(XD), W(XS), W(XT))
+
+#define svlqx3ld(XD, XS, MT, DT)                                            \
+        svldx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrdx_rr(W(XG), W(XS))
+
+#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrdx_ld(W(XG), W(MS), W(DS))
+
+#define svrqx3rr(XD, XS, XT)                                                \
+        svrdx3rr(W(XD), W(XS), W(XT))
+
+#define svrqx3ld(XD, XS, MT, DT)                                            \
+        svrdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrdn_rr(W(XG), W(XS))
+
+#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrdn_ld(W(XG), W(MS), W(DS))
+
+#define svrqn3rr(XD, XS, XT)                                                \
+        svrdn3rr(W(XD), W(XS), W(XT))
+
+#define svrqn3ld(XD, XS, MT, DT)                                            \
+        svrdn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/****************   packed double-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
+
+#ifdef mindx_rr
+
+#define minqx_rr(XG, XS)                                                    \
+        mindx_rr(W(XG), W(XS))
+
+#define minqx_ld(XG, MS, DS)                                                \
+        mindx_ld(W(XG), W(MS), W(DS))
+
+#define minqx3rr(XD, XS, XT)                                                \
+        mindx3rr(W(XD), W(XS), W(XT))
+
+#define minqx3ld(XD, XS, MT, DT)                                            \
+        mindx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* mindx_rr */
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
+
+#ifdef mindn_rr
+
+#define minqn_rr(XG, XS)                                                    \
+        mindn_rr(W(XG), W(XS))
+
+#define minqn_ld(XG, MS, DS)                                                \
+        mindn_ld(W(XG), W(MS), W(DS))
+
+#define minqn3rr(XD, XS, XT)                                                \
+        mindn3rr(W(XD), W(XS), W(XT))
+
+#define minqn3ld(XD, XS, MT, DT)                                            \
+        mindn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* mindn_rr */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
+
+#ifdef maxdx_rr
+
+#define maxqx_rr(XG, XS)                                                    \
+        maxdx_rr(W(XG), W(XS))
+
+#define maxqx_ld(XG, MS, DS)                                                \
+        maxdx_ld(W(XG), W(MS), W(DS))
+
+#define maxqx3rr(XD, XS, XT)                                                \
+        maxdx3rr(W(XD), W(XS), W(XT))
+
+#define maxqx3ld(XD, XS, MT, DT)                                            \
+        maxdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* maxdx_rr */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
+
+#ifdef maxdn_rr
+
+#define maxqn_rr(XG, XS)                                                    \
+        maxdn_rr(W(XG), W(XS))
+
+#define maxqn_ld(XG, MS, DS)                                                \
+        maxdn_ld(W(XG), W(MS), W(DS))
+
+#define maxqn3rr(XD, XS, XT)                                                \
+        maxdn3rr(W(XD), W(XS), W(XT))
+
+#define maxqn3ld(XD, XS, MT, DT)                                            \
+        maxdn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* maxdn_rr */
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#ifdef ceqdx_rr
+
+#define ceqqx_rr(XG, XS)                                                    \
+        ceqdx_rr(W(XG), W(XS))
+
+#define ceqqx_ld(XG, MS, DS)                                                \
+        ceqdx_ld(W(XG), W(MS), W(DS))
+
+#define ceqqx3rr(XD, XS, XT)                                                \
+        ceqdx3rr(W(XD), W(XS), W(XT))
+
+#define ceqqx3ld(XD, XS, MT, DT)                                            \
+        ceqdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ceqdx_rr */
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#ifdef cnedx_rr
+
+#define cneqx_rr(XG, XS)                                                    \
+        cnedx_rr(W(XG), W(XS))
+
+#define cneqx_ld(XG, MS, DS)                                                \
+        cnedx_ld(W(XG), W(MS), W(DS))
+
+#define cneqx3rr(XD, XS, XT)                                                \
+        cnedx3rr(W(XD), W(XS), W(XT))
+
+#define cneqx3ld(XD, XS, MT, DT)                                            \
+        cnedx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cnedx_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cltdx_rr
+
+#define cltqx_rr(XG, XS)                                                    \
+        cltdx_rr(W(XG), W(XS))
+
+#define cltqx_ld(XG, MS, DS)                                                \
+        cltdx_ld(W(XG), W(MS), W(DS))
+
+#define cltqx3rr(XD, XS, XT)                                                \
+        cltdx3rr(W(XD), W(XS), W(XT))
+
+#define cltqx3ld(XD, XS, MT, DT)                                            \
+        cltdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cltdx_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cltdn_rr
+
+#define cltqn_rr(XG, XS)                                                    \
+        cltdn_rr(W(XG), W(XS))
+
+#define cltqn_ld(XG, MS, DS)                                                \
+        cltdn_ld(W(XG), W(MS), W(DS))
+
+#define cltqn3rr(XD, XS, XT)                                                \
+        cltdn3rr(W(XD), W(XS), W(XT))
+
+#define cltqn3ld(XD, XS, MT, DT)                                            \
+        cltdn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cltdn_rr */
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cledx_rr
+
+#define cleqx_rr(XG, XS)                                                    \
+        cledx_rr(W(XG), W(XS))
+
+#define cleqx_ld(XG, MS, DS)                                                \
+        cledx_ld(W(XG), W(MS), W(DS))
+
+#define cleqx3rr(XD, XS, XT)                                                \
+        cledx3rr(W(XD), W(XS), W(XT))
+
+#define cleqx3ld(XD, XS, MT, DT)                                            \
+        cledx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cledx_rr */
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cledn_rr
+
+#define cleqn_rr(XG, XS)                                                    \
+        cledn_rr(W(XG), W(XS))
+
+#define cleqn_ld(XG, MS, DS)                                                \
+        cledn_ld(W(XG), W(MS), W(DS))
+
+#define cleqn3rr(XD, XS, XT)                                                \
+        cledn3rr(W(XD), W(XS), W(XT))
+
+#define cleqn3ld(XD, XS, MT, DT)                                            \
+        cledn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cledn_rr */
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cgtdx_rr
+
+#define cgtqx_rr(XG, XS)                                                    \
+        cgtdx_rr(W(XG), W(XS))
+
+#define cgtqx_ld(XG, MS, DS)                                                \
+        cgtdx_ld(W(XG), W(MS), W(DS))
+
+#define cgtqx3rr(XD, XS, XT)                                                \
+        cgtdx3rr(W(XD), W(XS), W(XT))
+
+#define cgtqx3ld(XD, XS, MT, DT)                                            \
+        cgtdx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgtdx_rr */
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cgtdn_rr
+
+#define cgtqn_rr(XG, XS)                                                    \
+        cgtdn_rr(W(XG), W(XS))
+
+#define cgtqn_ld(XG, MS, DS)                                                \
+        cgtdn_ld(W(XG), W(MS), W(DS))
+
+#define cgtqn3rr(XD, XS, XT)                                                \
+        cgtdn3rr(W(XD), W(XS), W(XT))
+
+#define cgtqn3ld(XD, XS, MT, DT)                                            \
+        cgtdn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgtdn_rr */
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
+
+#ifdef cgedx_rr
+
+#define cgeqx_rr(XG, XS)                                                    \
+        cgedx_rr(W(XG), W(XS))
+
+#define cgeqx_ld(XG, MS, DS)                                                \
+        cgedx_ld(W(XG), W(MS), W(DS))
+
+#define cgeqx3rr(XD, XS, XT)                                                \
+        cgedx3rr(W(XD), W(XS), W(XT))
+
+#define cgeqx3ld(XD, XS, MT, DT)                                            \
+        cgedx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgedx_rr */
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
+
+#ifdef cgedn_rr
+
+#define cgeqn_rr(XG, XS)                                                    \
+        cgedn_rr(W(XG), W(XS))
+
+#define cgeqn_ld(XG, MS, DS)                                                \
+        cgedn_ld(W(XG), W(MS), W(DS))
+
+#define cgeqn3rr(XD, XS, XT)                                                \
+        cgedn3rr(W(XD), W(XS), W(XT))
+
+#define cgeqn3ld(XD, XS, MT, DT)                                            \
+        cgedn3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* cgedn_rr */
+
+/*
+ * common 256-bit floating-point SIMD instructions with 64-bit elements
+ */
+
+/* cbr (D = cbrt S) */
+
+/*
+ * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
+ * available at http://www.musicdsp.org/showone.php?id=206
+ * converted to S-way SIMD version by VectorChief.
+ */
+#define cbrds_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbeds_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsds_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsds_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsds_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define cbeds_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        /* cube root estimate, the exponent is divided by three             \
+         * in such a way that remainder bits get shoved into                \
+         * the top of the normalized mantissa */                            \
+        movdx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
+        movdx_rr(W(XD), W(XS))                                              \
+        anddx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
+        subdx_ld(W(XD), Mebp, inf_GPC05_64) /* convert to 2's complement */ \
+        shrdn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
+        movdx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
+        shldx_ri(W(X1), IB(2))                                              \
+        adddx_rr(W(XD), W(X1))                                              \
+        shldx_ri(W(X1), IB(2))                                              \
+        adddx_rr(W(XD), W(X1))                                              \
+        shldx_ri(W(X1), IB(2))                                              \
+        adddx_rr(W(XD), W(X1))                                              \
+        shldx_ri(W(X1), IB(2))                                              \
+        adddx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
+        adddx_ld(W(XD), Mebp, inf_GPC05_64) /* back to biased-127 */        \
+        anddx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
+        anndx_rr(W(X2), W(XS))   /* original sign */                        \
+        orrdx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+
+#define cbsds_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movdx_rr(W(X1), W(XG))                                              \
+        mulds_rr(W(X1), W(XG))                                              \
+        movdx_rr(W(X2), W(X1))                                              \
+        mulds_ld(W(X1), Mebp, inf_GPC03_64)                                 \
+        rceds_rr(W(X1), W(X1))                                              \
+        mulds_rr(W(X2), W(XG))                                              \
+        subds_rr(W(X2), W(XS))                                              \
+        mulds_rr(W(X2), W(X1))                                              \
+        subds_rr(W(XG), W(X2))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcpds_rr(XD, XS) /* destroys XS */                                  \
+        rceds_rr(W(XD), W(XS))                                              \
+        rcsds_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcpds_rr(XD, XS) /* destroys XS */                                  \
+        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divds_rr(W(XD), W(XS))
+
+#define rceds_rr(XD, XS)                                                    \
+        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divds_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcsds_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqds_rr(XD, XS) /* destroys XS */                                  \
+        rseds_rr(W(XD), W(XS))                                              \
+        rssds_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqds_rr(XD, XS) /* destroys XS */                                  \
+        sqrds_rr(W(XS), W(XS))                                              \
+        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divds_rr(W(XD), W(XS))
+
+#define rseds_rr(XD, XS)                                                    \
+        sqrds_rr(W(XD), W(XS))                                              \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divds_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rssds_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmads_rr(XG, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulds_rr(W(XS), W(XT))                                              \
+        addds_rr(W(XG), W(XS))                                              \
+        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmads_ld(XG, XS, MT, DT)                                            \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulds_ld(W(XS), W(MT), W(DT))                                       \
+        addds_rr(W(XG), W(XS))                                              \
+        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmsds_rr(XG, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulds_rr(W(XS), W(XT))                                              \
+        subds_rr(W(XG), W(XS))                                              \
+        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsds_ld(XG, XS, MT, DT)                                            \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mulds_ld(W(XS), W(MT), W(DT))                                       \
+        subds_rr(W(XG), W(XS))                                              \
+        movdx_ld(W(XS), Mebp, inf_SCR01(0))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#endif /* RT_SIMD_COMPAT_FMS */
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-64-bit-element **** 128-bit ***/
+/******************************************************************************/
 
-#define rcpos_rr(XD, XS) /* destroys XS */                                  \
-        rceos_rr(W(XD), W(XS))                                              \
-        rcsos_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#elif (RT_SIMD == 128)
 
-#elif RT_SIMD_COMPAT_RCP == 1
+/***************   packed double-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movqx_rr(XD, XS)                                                    \
+        movjx_rr(W(XD), W(XS))
+
+#define movqx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))
+
+#define movqx_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+
+#define mmvqx_ld(XG, MS, DS)                                                \
+        mmvjx_ld(W(XG), W(MS), W(DS))
+
+#define mmvqx_st(XS, MG, DG)                                                \
+        mmvjx_st(W(XS), W(MG), W(DG))
+
+#ifdef mmzjx_ld
+
+#define mmzqx_ld(XD, MS, DS)                                                \
+        mmzjx_ld(W(XD), W(MS), W(DS))
+
+#endif /* mmzjx_ld */
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#ifdef seljx_rr
+
+#define selqx_rr(XG, XM, XS)                                                \
+        seljx_rr(W(XG), W(XM), W(XS))
+
+#define selqx_ld(XG, XM, MS, DS)                                            \
+        seljx_ld(W(XG), W(XM), W(MS), W(DS))
+
+#define selqx3rr(XD, XM, XS, XT)                                            \
+        seljx3rr(W(XD), W(XM), W(XS), W(XT))
+
+#define selqx3ld(XD, XM, XS, MT, DT)                                        \
+        seljx3ld(W(XD), W(XM), W(XS), W(MT), W(DT))
+
+#endif /* seljx_rr */
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#ifdef spljx_rr
+
+#define splqx_rr(XD, RS)                                                    \
+        spljx_rr(W(XD), W(RS))
+
+#define splqx_ld(XD, MS, DS)                                                \
+        spljx_ld(W(XD), W(MS), W(DS))
+
+#endif /* spljx_rr */
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#ifdef extjx_rr
+
+#define extqx_rr(RD, XS, IS)                                                \
+        extjx_rr(W(RD), W(XS), W(IS))
+
+#endif /* extjx_rr */
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#ifdef insjx_rr
+
+#define insqx_rr(XG, RS, IS)                                                \
+        insjx_rr(W(XG), W(RS), W(IS))
+
+#endif /* insjx_rr */
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#ifdef shfjx3ri
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfjx_ri(W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        shfjx3ri(W(XD), W(XS), W(IT))
+
+#endif /* shfjx3ri */
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#ifdef ilojx3rr
+
+#define iloqx_rr(XG, XS)                                                    \
+        ilojx_rr(W(XG), W(XS))
+
+#define iloqx_ld(XG, MS, DS)                                                \
+        ilojx_ld(W(XG), W(MS), W(DS))
+
+#define iloqx3rr(XD, XS, XT)                                                \
+        ilojx3rr(W(XD), W(XS), W(XT))
+
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+        ilojx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ilojx3rr */
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#ifdef ihijx3rr
+
+#define ihiqx_rr(XG, XS)                                                    \
+        ihijx_rr(W(XG), W(XS))
+
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihijx_ld(W(XG), W(MS), W(DS))
+
+#define ihiqx3rr(XD, XS, XT)                                                \
+        ihijx3rr(W(XD), W(XS), W(XT))
+
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+        ihijx3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* ihijx3rr */
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#ifdef revjx_rr
+
+#define revqx_rx(XG)                                                        \
+        revjx_rx(W(XG))
+
+#define revqx_rr(XD, XS)                                                    \
+        revjx_rr(W(XD), W(XS))
+
+#endif /* revjx_rr */
+
+/* adh, mnh, mxh (D = S[0] op S[1] op ... op S[n]) in lowest element of D */
+
+#ifdef adhjs_rr
+
+#define adhqs_rr(XD, XS)                                                    \
+        adhjs_rr(W(XD), W(XS))
+
+#define adhqs_ld(XD, MS, DS)                                                \
+        adhjs_ld(W(XD), W(MS), W(DS))
+
+#define mnhqs_rr(XD, XS)                                                    \
+        mnhjs_rr(W(XD), W(XS))
+
+#define mnhqs_ld(XD, MS, DS)                                                \
+        mnhjs_ld(W(XD), W(MS), W(DS))
+
+#define mxhqs_rr(XD, XS)                                                    \
+        mxhjs_rr(W(XD), W(XS))
+
+#define mxhqs_ld(XD, MS, DS)                                                \
+        mxhjs_ld(W(XD), W(MS), W(DS))
+
+#endif /* adhjs_rr */
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andqx_rr(XG, XS)                                                    \
+        andjx_rr(W(XG), W(XS))
+
+#define andqx_ld(XG, MS, DS)                                                \
+        andjx_ld(W(XG), W(MS), W(DS))
+
+#define andqx3rr(XD, XS, XT)                                                \
+        andjx3rr(W(XD), W(XS), W(XT))
+
+#define andqx3ld(XD, XS, MT, DT)                                            \
+        andjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annqx_rr(XG, XS)                                                    \
+        annjx_rr(W(XG), W(XS))
+
+#define annqx_ld(XG, MS, DS)                                                \
+        annjx_ld(W(XG), W(MS), W(DS))
+
+#define annqx3rr(XD, XS, XT)                                                \
+        annjx3rr(W(XD), W(XS), W(XT))
+
+#define annqx3ld(XD, XS, MT, DT)                                            \
+        annjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrqx_rr(XG, XS)                                                    \
+        orrjx_rr(W(XG), W(XS))
+
+#define orrqx_ld(XG, MS, DS)                                                \
+        orrjx_ld(W(XG), W(MS), W(DS))
+
+#define orrqx3rr(XD, XS, XT)                                                \
+        orrjx3rr(W(XD), W(XS), W(XT))
+
+#define orrqx3ld(XD, XS, MT, DT)                                            \
+        orrjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornqx_rr(XG, XS)                                                    \
+        ornjx_rr(W(XG), W(XS))
+
+#define ornqx_ld(XG, MS, DS)                                                \
+        ornjx_ld(W(XG), W(MS), W(DS))
+
+#define ornqx3rr(XD, XS, XT)                                                \
+        ornjx3rr(W(XD), W(XS), W(XT))
+
+#define ornqx3ld(XD, XS, MT, DT)                                            \
+        ornjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorqx_rr(XG, XS)                                                    \
+        xorjx_rr(W(XG), W(XS))
+
+#define xorqx_ld(XG, MS, DS)                                                \
+        xorjx_ld(W(XG), W(MS), W(DS))
+
+#define xorqx3rr(XD, XS, XT)                                                \
+        xorjx3rr(W(XD), W(XS), W(XT))
+
+#define xorqx3ld(XD, XS, MT, DT)                                            \
+        xorjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* not (G = ~G), (D = ~S) */
+
+#define notqx_rx(XG)                                                        \
+        notjx_rx(W(XG))
+
+#define notqx_rr(XD, XS)                                                    \
+        notjx_rr(W(XD), W(XS))
+
+/************   packed double-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negqs_rx(XG)                                                        \
+        negjs_rx(W(XG))
+
+#define negqs_rr(XD, XS)                                                    \
+        negjs_rr(W(XD), W(XS))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addqs_rr(XG, XS)                                                    \
+        addjs_rr(W(XG), W(XS))
+
+#define addqs_ld(XG, MS, DS)                                                \
+        addjs_ld(W(XG), W(MS), W(DS))
+
+#define addqs3rr(XD, XS, XT)                                                \
+        addjs3rr(W(XD), W(XS), W(XT))
+
+#define addqs3ld(XD, XS, MT, DT)                                            \
+        addjs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subqs_rr(XG, XS)                                                    \
+        subjs_rr(W(XG), W(XS))
+
+#define subqs_ld(XG, MS, DS)                                                \
+        subjs_ld(W(XG), W(MS), W(DS))
+
+#define subqs3rr(XD, XS, XT)                                                \
+        subjs3rr(W(XD), W(XS), W(XT))
+
+#define subqs3ld(XD, XS, MT, DT)                                            \
+        subjs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulqs_rr(XG, XS)                                                    \
+        muljs_rr(W(XG), W(XS))
+
+#define mulqs_ld(XG, MS, DS)                                                \
+        muljs_ld(W(XG), W(MS), W(DS))
+
+#define mulqs3rr(XD, XS, XT)                                                \
+        muljs3rr(W(XD), W(XS), W(XT))
+
+#define mulqs3ld(XD, XS, MT, DT)                                            \
+        muljs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divqs_rr(XG, XS)                                                    \
+        divjs_rr(W(XG), W(XS))
+
+#define divqs_ld(XG, MS, DS)                                                \
+        divjs_ld(W(XG), W(MS), W(DS))
+
+#define divqs3rr(XD, XS, XT)                                                \
+        divjs3rr(W(XD), W(XS), W(XT))
+
+#define divqs3ld(XD, XS, MT, DT)                                            \
+        divjs3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sqr (D = sqrt S) */
+
+#define sqrqs_rr(XD, XS)                                                    \
+        sqrjs_rr(W(XD), W(XS))
+
+#define sqrqs_ld(XD, MS, DS)                                                \
+        sqrjs_ld(W(XD), W(MS), W(DS))
 
-#define rcpos_rr(XD, XS) /* destroys XS */                                  \
-        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divos_rr(W(XD), W(XS))
+/* cbr (D = cbrt S) */
 
-#define rceos_rr(XD, XS)                                                    \
-        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divos_ld(W(XD), Mebp, inf_SCR02(0))
+#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbrjs_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define rcsos_rr(XG, XS) /* destroys XS */
+#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbejs_rr(W(XD), W(X1), W(X2), W(XS))
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbsjs_rr(W(XG), W(X1), W(X2), W(XS))
 
-/* rsq (D = 1.0 / sqrt S)
+/* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
+        rcpjs_rr(W(XD), W(XS))
 
-#define rsqos_rr(XD, XS) /* destroys XS */                                  \
-        rseos_rr(W(XD), W(XS))                                              \
-        rssos_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define rceqs_rr(XD, XS)                                                    \
+        rcejs_rr(W(XD), W(XS))
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
+        rcsjs_rr(W(XG), W(XS))
 
-#define rsqos_rr(XD, XS) /* destroys XS */                                  \
-        sqros_rr(W(XS), W(XS))                                              \
-        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divos_rr(W(XD), W(XS))
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
 
-#define rseos_rr(XD, XS)                                                    \
-        sqros_rr(W(XD), W(XS))                                              \
-        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divos_ld(W(XD), Mebp, inf_SCR02(0))
+#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
+        rsqjs_rr(W(XD), W(XS))
 
-#define rssos_rr(XG, XS) /* destroys XS */
+#define rseqs_rr(XD, XS)                                                    \
+        rsejs_rr(W(XD), W(XS))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#define rssqs_rr(XG, XS) /* destroys XS */                                  \
+        rssjs_rr(W(XG), W(XS))
 
 /* fma (G = G + S * T) if (#G != #S && #G != #T)
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA == 2
-
-#define fmaos_rr(XG, XS, XT)                                                \
-        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulos_rr(W(XS), W(XT))                                              \
-        addos_rr(W(XG), W(XS))                                              \
-        movox_ld(W(XS), Mebp, inf_SCR01(0))
-
-#define fmaos_ld(XG, XS, MT, DT)                                            \
-        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulos_ld(W(XS), W(MT), W(DT))                                       \
-        addos_rr(W(XG), W(XS))                                              \
-        movox_ld(W(XS), Mebp, inf_SCR01(0))
+#define fmaqs_rr(XG, XS, XT)                                                \
+        fmajs_rr(W(XG), W(XS), W(XT))
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define fmaqs_ld(XG, XS, MT, DT)                                            \
+        fmajs_ld(W(XG), W(XS), W(MT), W(DT))
 
 /* fms (G = G - S * T) if (#G != #S && #G != #T)
  * NOTE: due to final negation being outside of rounding on all Power systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS == 2
-
-#define fmsos_rr(XG, XS, XT)                                                \
-        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulos_rr(W(XS), W(XT))                                              \
-        subos_rr(W(XG), W(XS))                                              \
-        movox_ld(W(XS), Mebp, inf_SCR01(0))
-
-#define fmsos_ld(XG, XS, MT, DT)                                            \
-        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulos_ld(W(XS), W(MT), W(DT))                                       \
-        subos_rr(W(XG), W(XS))                                              \
-        movox_ld(W(XS), Mebp, inf_SCR01(0))
-
-#endif /* RT_SIMD_COMPAT_FMS */
-
-/******************************************************************************/
-/**** var-len **** SIMD instructions with fixed-32-bit-element **** 256-bit ***/
-/******************************************************************************/
+#define fmsqs_rr(XG, XS, XT)                                                \
+        fmsjs_rr(W(XG), W(XS), W(XT))
 
-#elif (RT_SIMD == 256)
+#define fmsqs_ld(XG, XS, MT, DT)                                            \
+        fmsjs_ld(W(XG), W(XS), W(MT), W(DT))
 
-/***************   packed single-precision generic move/logic   ***************/
+/*************   packed double-precision floating-point compare   *************/
 
-/* mov (D = S) */
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
 
-#define movox_rr(XD, XS)                                                    \
-        movcx_rr(W(XD), W(XS))
+#define minqs_rr(XG, XS)                                                    \
+        minjs_rr(W(XG), W(XS))
 
-#define movox_ld(XD, MS, DS)                                                \
-        movcx_ld(W(XD), W(MS), W(DS))
+#define minqs_ld(XG, MS, DS)                                                \
+        minjs_ld(W(XG), W(MS), W(DS))
 
-#define movox_st(XS, MD, DD)                                                \
-        movcx_st(W(XS), W(MD), W(DD))
+#define minqs3rr(XD, XS, XT)                                                \
+        minjs3rr(W(XD), W(XS), W(XT))
 
-/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
- * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+#define minqs3ld(XD, XS, MT, DT)                                            \
+        minjs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define mmvox_ld(XG, MS, DS)                                                \
-        mmvcx_ld(W(XG), W(MS), W(DS))
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
-#define mmvox_st(XS, MG, DG)                                                \
-        mmvcx_st(W(XS), W(MG), W(DG))
+#define maxqs_rr(XG, XS)                                                    \
+        maxjs_rr(W(XG), W(XS))
 
-/* and (G = G & S), (D = S & T) if (#D != #S) */
+#define maxqs_ld(XG, MS, DS)                                                \
+        maxjs_ld(W(XG), W(MS), W(DS))
 
-#define andox_rr(XG, XS)                                                    \
-        andcx_rr(W(XG), W(XS))
+#define maxqs3rr(XD, XS, XT)                                                \
+        maxjs3rr(W(XD), W(XS), W(XT))
 
-#define andox_ld(XG, MS, DS)                                                \
-        andcx_ld(W(XG), W(MS), W(DS))
+#define maxqs3ld(XD, XS, MT, DT)                                            \
+        maxjs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define andox3rr(XD, XS, XT)                                                \
-        andcx3rr(W(XD), W(XS), W(XT))
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
-#define andox3ld(XD, XS, MT, DT)                                            \
-        andcx3ld(W(XD), W(XS), W(MT), W(DT))
+#define ceqqs_rr(XG, XS)                                                    \
+        ceqjs_rr(W(XG), W(XS))
 
-/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+#define ceqqs_ld(XG, MS, DS)                                                \
+        ceqjs_ld(W(XG), W(MS), W(DS))
 
-#define annox_rr(XG, XS)                                                    \
-        anncx_rr(W(XG), W(XS))
+#define ceqqs3rr(XD, XS, XT)                                                \
+        ceqjs3rr(W(XD), W(XS), W(XT))
 
-#define annox_ld(XG, MS, DS)                                                \
-        anncx_ld(W(XG), W(MS), W(DS))
+#define ceqqs3ld(XD, XS, MT, DT)                                            \
+        ceqjs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define annox3rr(XD, XS, XT)                                                \
-        anncx3rr(W(XD), W(XS), W(XT))
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
 
-#define annox3ld(XD, XS, MT, DT)                                            \
-        anncx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cneqs_rr(XG, XS)                                                    \
+        cnejs_rr(W(XG), W(XS))
 
-/* orr (G = G | S), (D = S | T) if (#D != #S) */
+#define cneqs_ld(XG, MS, DS)                                                \
+        cnejs_ld(W(XG), W(MS), W(DS))
 
-#define orrox_rr(XG, XS)                                                    \
-        orrcx_rr(W(XG), W(XS))
+#define cneqs3rr(XD, XS, XT)                                                \
+        cnejs3rr(W(XD), W(XS), W(XT))
 
-#define orrox_ld(XG, MS, DS)                                                \
-        orrcx_ld(W(XG), W(MS), W(DS))
+#define cneqs3ld(XD, XS, MT, DT)                                            \
+        cnejs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define orrox3rr(XD, XS, XT)                                                \
-        orrcx3rr(W(XD), W(XS), W(XT))
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
 
-#define orrox3ld(XD, XS, MT, DT)                                            \
-        orrcx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cltqs_rr(XG, XS)                                                    \
+        cltjs_rr(W(XG), W(XS))
 
-/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+#define cltqs_ld(XG, MS, DS)                                                \
+        cltjs_ld(W(XG), W(MS), W(DS))
 
-#define ornox_rr(XG, XS)                                                    \
-        orncx_rr(W(XG), W(XS))
+#define cltqs3rr(XD, XS, XT)                                                \
+        cltjs3rr(W(XD), W(XS), W(XT))
 
-#define ornox_ld(XG, MS, DS)                                                \
-        orncx_ld(W(XG), W(MS), W(DS))
+#define cltqs3ld(XD, XS, MT, DT)                                            \
+        cltjs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define ornox3rr(XD, XS, XT)                                                \
-        orncx3rr(W(XD), W(XS), W(XT))
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
 
-#define ornox3ld(XD, XS, MT, DT)                                            \
-        orncx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cleqs_rr(XG, XS)                                                    \
+        clejs_rr(W(XG), W(XS))
 
-/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+#define cleqs_ld(XG, MS, DS)                                                \
+        clejs_ld(W(XG), W(MS), W(DS))
 
-#define xorox_rr(XG, XS)                                                    \
-        xorcx_rr(W(XG), W(XS))
+#define cleqs3rr(XD, XS, XT)                                                \
+        clejs3rr(W(XD), W(XS), W(XT))
 
-#define xorox_ld(XG, MS, DS)                                                \
-        xorcx_ld(W(XG), W(MS), W(DS))
+#define cleqs3ld(XD, XS, MT, DT)                                            \
+        clejs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define xorox3rr(XD, XS, XT)                                                \
-        xorcx3rr(W(XD), W(XS), W(XT))
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
 
-#define xorox3ld(XD, XS, MT, DT)                                            \
-        xorcx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cgtqs_rr(XG, XS)                                                    \
+        cgtjs_rr(W(XG), W(XS))
 
-/* not (G = ~G), (D = ~S) */
+#define cgtqs_ld(XG, MS, DS)                                                \
+        cgtjs_ld(W(XG), W(MS), W(DS))
 
-#define notox_rx(XG)                                                        \
-        notcx_rx(W(XG))
+#define cgtqs3rr(XD, XS, XT)                                                \
+        cgtjs3rr(W(XD), W(XS), W(XT))
 
-#define notox_rr(XD, XS)                                                    \
-        notcx_rr(W(XD), W(XS))
+#define cgtqs3ld(XD, XS, MT, DT)                                            \
+        cgtjs3ld(W(XD), W(XS), W(MT), W(DT))
 
-/************   packed single-precision floating-point arithmetic   ***********/
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
 
-/* neg (G = -G), (D = -S) */
+#define cgeqs_rr(XG, XS)                                                    \
+        cgejs_rr(W(XG), W(XS))
 
-#define negos_rx(XG)                                                        \
-        negcs_rx(W(XG))
+#define cgeqs_ld(XG, MS, DS)                                                \
+        cgejs_ld(W(XG), W(MS), W(DS))
 
-#define negos_rr(XD, XS)                                                    \
-        negcs_rr(W(XD), W(XS))
+#define cgeqs3rr(XD, XS, XT)                                                \
+        cgejs3rr(W(XD), W(XS), W(XT))
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#define cgeqs3ld(XD, XS, MT, DT)                                            \
+        cgejs3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define addos_rr(XG, XS)                                                    \
-        addcs_rr(W(XG), W(XS))
+/* mkj (jump to lb) if (S satisfies mask condition) */
 
-#define addos_ld(XG, MS, DS)                                                \
-        addcs_ld(W(XG), W(MS), W(DS))
+#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        mkjjx_rx(W(XS), mask, lb)
 
-#define addos3rr(XD, XS, XT)                                                \
-        addcs3rr(W(XD), W(XS), W(XT))
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
 
-#define addos3ld(XD, XS, MT, DT)                                            \
-        addcs3ld(W(XD), W(XS), W(MT), W(DT))
+#ifdef mkbjx_rr
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+#define mkbqx_rr(RD, XS)                                                    \
+        mkbjx_rr(W(RD), W(XS))
 
-#define subos_rr(XG, XS)                                                    \
-        subcs_rr(W(XG), W(XS))
+#endif /* mkbjx_rr */
 
-#define subos_ld(XG, MS, DS)                                                \
-        subcs_ld(W(XG), W(MS), W(DS))
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
 
-#define subos3rr(XD, XS, XT)                                                \
-        subcs3rr(W(XD), W(XS), W(XT))
+#ifdef mkcjx_rr
 
-#define subos3ld(XD, XS, MT, DT)                                            \
-        subcs3ld(W(XD), W(XS), W(MT), W(DT))
+#define mkcqx_rr(RD, XS)                                                    \
+        mkcjx_rr(W(RD), W(XS))
 
-/* mul (G = G * S), (D = S * T) if (#D != #S) */
+#endif /* mkcjx_rr */
 
-#define mulos_rr(XG, XS)                                                    \
-        mulcs_rr(W(XG), W(XS))
+/*************   packed double-precision floating-point convert   *************/
 
-#define mulos_ld(XG, MS, DS)                                                \
-        mulcs_ld(W(XG), W(MS), W(DS))
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
 
-#define mulos3rr(XD, XS, XT)                                                \
-        mulcs3rr(W(XD), W(XS), W(XT))
+#define rnzqs_rr(XD, XS)     /* round towards zero */                       \
+        rnzjs_rr(W(XD), W(XS))
 
-#define mulos3ld(XD, XS, MT, DT)                                            \
-        mulcs3ld(W(XD), W(XS), W(MT), W(DT))
+#define rnzqs_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzjs_ld(W(XD), W(MS), W(DS))
 
-/* div (G = G / S), (D = S / T) if (#D != #S) */
+#define cvzqs_rr(XD, XS)     /* round towards zero */                       \
+        cvzjs_rr(W(XD), W(XS))
 
-#define divos_rr(XG, XS)                                                    \
-        divcs_rr(W(XG), W(XS))
+#define cvzqs_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzjs_ld(W(XD), W(MS), W(DS))
 
-#define divos_ld(XG, MS, DS)                                                \
-        divcs_ld(W(XG), W(MS), W(DS))
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
 
-#define divos3rr(XD, XS, XT)                                                \
-        divcs3rr(W(XD), W(XS), W(XT))
+#define rnpqs_rr(XD, XS)     /* round towards +inf */                       \
+        rnpjs_rr(W(XD), W(XS))
 
-#define divos3ld(XD, XS, MT, DT)                                            \
-        divcs3ld(W(XD), W(XS), W(MT), W(DT))
+#define rnpqs_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpjs_ld(W(XD), W(MS), W(DS))
 
-/* sqr (D = sqrt S) */
+#define cvpqs_rr(XD, XS)     /* round towards +inf */                       \
+        cvpjs_rr(W(XD), W(XS))
 
-#define sqros_rr(XD, XS)                                                    \
-        sqrcs_rr(W(XD), W(XS))
+#define cvpqs_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpjs_ld(W(XD), W(MS), W(DS))
 
-#define sqros_ld(XD, MS, DS)                                                \
-        sqrcs_ld(W(XD), W(MS), W(DS))
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
 
-/* cbr (D = cbrt S) */
+#define rnmqs_rr(XD, XS)     /* round towards -inf */                       \
+        rnmjs_rr(W(XD), W(XS))
 
-#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbrcs_rr(W(XD), W(X1), W(X2), W(XS))
+#define rnmqs_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmjs_ld(W(XD), W(MS), W(DS))
 
-#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbecs_rr(W(XD), W(X1), W(X2), W(XS))
+#define cvmqs_rr(XD, XS)     /* round towards -inf */                       \
+        cvmjs_rr(W(XD), W(XS))
 
-#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbscs_rr(W(XG), W(X1), W(X2), W(XS))
+#define cvmqs_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmjs_ld(W(XD), W(MS), W(DS))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
 
-#define rcpos_rr(XD, XS) /* destroys XS */                                  \
-        rcpcs_rr(W(XD), W(XS))
+#define rnnqs_rr(XD, XS)     /* round towards near */                       \
+        rnnjs_rr(W(XD), W(XS))
 
-#define rceos_rr(XD, XS)                                                    \
-        rcecs_rr(W(XD), W(XS))
+#define rnnqs_ld(XD, MS, DS) /* round towards near */                       \
+        rnnjs_ld(W(XD), W(MS), W(DS))
 
-#define rcsos_rr(XG, XS) /* destroys XS */                                  \
-        rcscs_rr(W(XG), W(XS))
+#define cvnqs_rr(XD, XS)     /* round towards near */                       \
+        cvnjs_rr(W(XD), W(XS))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cvnqs_ld(XD, MS, DS) /* round towards near */                       \
+        cvnjs_ld(W(XD), W(MS), W(DS))
 
-#define rsqos_rr(XD, XS) /* destroys XS */                                  \
-        rsqcs_rr(W(XD), W(XS))
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
 
-#define rseos_rr(XD, XS)                                                    \
-        rsecs_rr(W(XD), W(XS))
+#define cvnqn_rr(XD, XS)     /* round towards near */                       \
+        cvnjn_rr(W(XD), W(XS))
 
-#define rssos_rr(XG, XS) /* destroys XS */                                  \
-        rsscs_rr(W(XG), W(XS))
+#define cvnqn_ld(XD, MS, DS) /* round towards near */                       \
+        cvnjn_ld(W(XD), W(MS), W(DS))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
 
-#define fmaos_rr(XG, XS, XT)                                                \
-        fmacs_rr(W(XG), W(XS), W(XT))
+#define rndqs_rr(XD, XS)                                                    \
+        rndjs_rr(W(XD), W(XS))
 
-#define fmaos_ld(XG, XS, MT, DT)                                            \
-        fmacs_ld(W(XG), W(XS), W(MT), W(DT))
+#define rndqs_ld(XD, MS, DS)                                                \
+        rndjs_ld(W(XD), W(MS), W(DS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define cvtqs_rr(XD, XS)                                                    \
+        cvtjs_rr(W(XD), W(XS))
 
-#define fmsos_rr(XG, XS, XT)                                                \
-        fmscs_rr(W(XG), W(XS), W(XT))
+#define cvtqs_ld(XD, MS, DS)                                                \
+        cvtjs_ld(W(XD), W(MS), W(DS))
 
-#define fmsos_ld(XG, XS, MT, DT)                                            \
-        fmscs_ld(W(XG), W(XS), W(MT), W(DT))
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
 
-/*************   packed single-precision floating-point compare   *************/
+#define cvtqn_rr(XD, XS)                                                    \
+        cvtjn_rr(W(XD), W(XS))
 
-/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+#define cvtqn_ld(XD, MS, DS)                                                \
+        cvtjn_ld(W(XD), W(MS), W(DS))
 
-#define minos_rr(XG, XS)                                                    \
-        mincs_rr(W(XG), W(XS))
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
 
-#define minos_ld(XG, MS, DS)                                                \
-        mincs_ld(W(XG), W(MS), W(DS))
+#define rnrqs_rr(XD, XS, mode)                                              \
+        rnrjs_rr(W(XD), W(XS), mode)
 
-#define minos3rr(XD, XS, XT)                                                \
-        mincs3rr(W(XD), W(XS), W(XT))
+#define cvrqs_rr(XD, XS, mode)                                              \
+        cvrjs_rr(W(XD), W(XS), mode)
 
-#define minos3ld(XD, XS, MT, DT)                                            \
-        mincs3ld(W(XD), W(XS), W(MT), W(DT))
+/* cvl (D = fp32-to-fp64 lower half of S)
+ * lower half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
 
-/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+#define cvlqs_rr(XD, XS)                                                    \
+        cvljs_rr(W(XD), W(XS))
 
-#define maxos_rr(XG, XS)                                                    \
-        maxcs_rr(W(XG), W(XS))
+/* cvh (D = fp32-to-fp64 upper half of S)
+ * upper half of fp32 elements of S is widened to fp64 elements of D,
+ * conversion is exact and doesn't depend on rounding mode */
 
-#define maxos_ld(XG, MS, DS)                                                \
-        maxcs_ld(W(XG), W(MS), W(DS))
+#define cvhqs_rr(XD, XS)                                                    \
+        cvhjs_rr(W(XD), W(XS))
 
-#define maxos3rr(XD, XS, XT)                                                \
-        maxcs3rr(W(XD), W(XS), W(XT))
+/************   packed double-precision integer arithmetic/shifts   ***********/
 
-#define maxos3ld(XD, XS, MT, DT)                                            \
-        maxcs3ld(W(XD), W(XS), W(MT), W(DT))
+/* add (G = G + S), (D = S + T) if (#D != #S) */
 
-/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+#define addqx_rr(XG, XS)                                                    \
+        addjx_rr(W(XG), W(XS))
 
-#define ceqos_rr(XG, XS)                                                    \
-        ceqcs_rr(W(XG), W(XS))
+#define addqx_ld(XG, MS, DS)                                                \
+        addjx_ld(W(XG), W(MS), W(DS))
 
-#define ceqos_ld(XG, MS, DS)                                                \
-        ceqcs_ld(W(XG), W(MS), W(DS))
+#define addqx3rr(XD, XS, XT)                                                \
+        addjx3rr(W(XD), W(XS), W(XT))
 
-#define ceqos3rr(XD, XS, XT)                                                \
-        ceqcs3rr(W(XD), W(XS), W(XT))
+#define addqx3ld(XD, XS, MT, DT)                                            \
+        addjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define ceqos3ld(XD, XS, MT, DT)                                            \
-        ceqcs3ld(W(XD), W(XS), W(MT), W(DT))
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
 
-/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+#define subqx_rr(XG, XS)                                                    \
+        subjx_rr(W(XG), W(XS))
 
-#define cneos_rr(XG, XS)                                                    \
-        cnecs_rr(W(XG), W(XS))
+#define subqx_ld(XG, MS, DS)                                                \
+        subjx_ld(W(XG), W(MS), W(DS))
 
-#define cneos_ld(XG, MS, DS)                                                \
-        cnecs_ld(W(XG), W(MS), W(DS))
+#define subqx3rr(XD, XS, XT)                                                \
+        subjx3rr(W(XD), W(XS), W(XT))
 
-#define cneos3rr(XD, XS, XT)                                                \
-        cnecs3rr(W(XD), W(XS), W(XT))
+#define subqx3ld(XD, XS, MT, DT)                                            \
+        subjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cneos3ld(XD, XS, MT, DT)                                            \
-        cnecs3ld(W(XD), W(XS), W(MT), W(DT))
+/* abs (G = |G|), (D = |S|) - signed */
 
-/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+#ifdef absjn_rr
 
-#define cltos_rr(XG, XS)                                                    \
-        cltcs_rr(W(XG), W(XS))
+#define absqn_rx(XG)                                                        \
+        absjn_rx(W(XG))
 
-#define cltos_ld(XG, MS, DS)                                                \
-        cltcs_ld(W(XG), W(MS), W(DS))
+#define absqn_rr(XD, XS)                                                    \
+        absjn_rr(W(XD), W(XS))
 
-#define cltos3rr(XD, XS, XT)                                                \
-        cltcs3rr(W(XD), W(XS), W(XT))
+#endif /* absjn_rr */
 
-#define cltos3ld(XD, XS, MT, DT)                                            \
-        cltcs3ld(W(XD), W(XS), W(MT), W(DT))
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product */
 
-/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+#ifdef muljx_rr
 
-#define cleos_rr(XG, XS)                                                    \
-        clecs_rr(W(XG), W(XS))
+#define mulqx_rr(XG, XS)                                                    \
+        muljx_rr(W(XG), W(XS))
 
-#define cleos_ld(XG, MS, DS)                                                \
-        clecs_ld(W(XG), W(MS), W(DS))
+#define mulqx_ld(XG, MS, DS)                                                \
+        muljx_ld(W(XG), W(MS), W(DS))
 
-#define cleos3rr(XD, XS, XT)                                                \
-        clecs3rr(W(XD), W(XS), W(XT))
+#define mulqx3rr(XD, XS, XT)                                                \
+        muljx3rr(W(XD), W(XS), W(XT))
 
-#define cleos3ld(XD, XS, MT, DT)                                            \
-        clecs3ld(W(XD), W(XS), W(MT), W(DT))
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+        muljx3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+#endif /* muljx_rr */
 
-#define cgtos_rr(XG, XS)                                                    \
-        cgtcs_rr(W(XG), W(XS))
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-#define cgtos_ld(XG, MS, DS)                                                \
-        cgtcs_ld(W(XG), W(MS), W(DS))
+#define shlqx_ri(XG, IS)                                                    \
+        shljx_ri(W(XG), W(IS))
 
-#define cgtos3rr(XD, XS, XT)                                                \
-        cgtcs3rr(W(XD), W(XS), W(XT))
+#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shljx_ld(W(XG), W(MS), W(DS))
 
-#define cgtos3ld(XD, XS, MT, DT)                                            \
-        cgtcs3ld(W(XD), W(XS), W(MT), W(DT))
+#define shlqx3ri(XD, XS, IT)                                                \
+        shljx3ri(W(XD), W(XS), W(IT))
 
-/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+#define shlqx3ld(XD, XS, MT, DT)                                            \
+        shljx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cgeos_rr(XG, XS)                                                    \
-        cgecs_rr(W(XG), W(XS))
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-#define cgeos_ld(XG, MS, DS)                                                \
-        cgecs_ld(W(XG), W(MS), W(DS))
+#define shrqx_ri(XG, IS)                                                    \
+        shrjx_ri(W(XG), W(IS))
 
-#define cgeos3rr(XD, XS, XT)                                                \
-        cgecs3rr(W(XD), W(XS), W(XT))
+#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrjx_ld(W(XG), W(MS), W(DS))
 
-#define cgeos3ld(XD, XS, MT, DT)                                            \
-        cgecs3ld(W(XD), W(XS), W(MT), W(DT))
+#define shrqx3ri(XD, XS, IT)                                                \
+        shrjx3ri(W(XD), W(XS), W(IT))
 
-/* mkj (jump to lb) if (S satisfies mask condition) */
+#define shrqx3ld(XD, XS, MT, DT)                                            \
+        shrjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        mkjcx_rx(W(XS), mask, lb)
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-/*************   packed single-precision floating-point convert   *************/
+#define shrqn_ri(XG, IS)                                                    \
+        shrjn_ri(W(XG), W(IS))
 
-/* cvz (D = fp-to-signed-int S)
- * rounding mode is encoded directly (can be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
+        shrjn_ld(W(XG), W(MS), W(DS))
 
-#define rnzos_rr(XD, XS)     /* round towards zero */                       \
-        rnzcs_rr(W(XD), W(XS))
+#define shrqn3ri(XD, XS, IT)                                                \
+        shrjn3ri(W(XD), W(XS), W(IT))
 
-#define rnzos_ld(XD, MS, DS) /* round towards zero */                       \
-        rnzcs_ld(W(XD), W(MS), W(DS))
+#define shrqn3ld(XD, XS, MT, DT)                                            \
+        shrjn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cvzos_rr(XD, XS)     /* round towards zero */                       \
-        cvzcs_rr(W(XD), W(XS))
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-#define cvzos_ld(XD, MS, DS) /* round towards zero */                       \
-        cvzcs_ld(W(XD), W(MS), W(DS))
+#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svljx_rr(W(XG), W(XS))
 
-/* cvp (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svljx_ld(W(XG), W(MS), W(DS))
 
-#define rnpos_rr(XD, XS)     /* round towards +inf */                       \
-        rnpcs_rr(W(XD), W(XS))
+#define svlqx3rr(XD, XS, XT)                                                \
+        svljx3rr(W(XD), W(XS), W(XT))
 
-#define rnpos_ld(XD, MS, DS) /* round towards +inf */                       \
-        rnpcs_ld(W(XD), W(MS), W(DS))
+#define svlqx3ld(XD, XS, MT, DT)                                            \
+        svljx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cvpos_rr(XD, XS)     /* round towards +inf */                       \
-        cvpcs_rr(W(XD), W(XS))
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-#define cvpos_ld(XD, MS, DS) /* round towards +inf */                       \
-        cvpcs_ld(W(XD), W(MS), W(DS))
+#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrjx_rr(W(XG), W(XS))
 
-/* cvm (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrjx_ld(W(XG), W(MS), W(DS))
 
-#define rnmos_rr(XD, XS)     /* round towards -inf */                       \
-        rnmcs_rr(W(XD), W(XS))
+#define svrqx3rr(XD, XS, XT)                                                \
+        svrjx3rr(W(XD), W(XS), W(XT))
 
-#define rnmos_ld(XD, MS, DS) /* round towards -inf */                       \
-        rnmcs_ld(W(XD), W(MS), W(DS))
+#define svrqx3ld(XD, XS, MT, DT)                                            \
+        svrjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cvmos_rr(XD, XS)     /* round towards -inf */                       \
-        cvmcs_rr(W(XD), W(XS))
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-#define cvmos_ld(XD, MS, DS) /* round towards -inf */                       \
-        cvmcs_ld(W(XD), W(MS), W(DS))
+#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrjn_rr(W(XG), W(XS))
 
-/* cvn (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrjn_ld(W(XG), W(MS), W(DS))
 
-#define rnnos_rr(XD, XS)     /* round towards near */                       \
-        rnncs_rr(W(XD), W(XS))
+#define svrqn3rr(XD, XS, XT)                                                \
+        svrjn3rr(W(XD), W(XS), W(XT))
 
-#define rnnos_ld(XD, MS, DS) /* round towards near */                       \
-        rnncs_ld(W(XD), W(MS), W(DS))
+#define svrqn3ld(XD, XS, MT, DT)                                            \
+        svrjn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cvnos_rr(XD, XS)     /* round towards near */                       \
-        cvncs_rr(W(XD), W(XS))
+/****************   packed double-precision integer compare   *****************/
 
-#define cvnos_ld(XD, MS, DS) /* round towards near */                       \
-        cvncs_ld(W(XD), W(MS), W(DS))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned */
 
-/* cvn (D = signed-int-to-fp S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+#ifdef minjx_rr
 
-#define cvnon_rr(XD, XS)     /* round towards near */                       \
-        cvncn_rr(W(XD), W(XS))
+#define minqx_rr(XG, XS)                                                    \
+        minjx_rr(W(XG), W(XS))
 
-#define cvnon_ld(XD, MS, DS) /* round towards near */                       \
-        cvncn_ld(W(XD), W(MS), W(DS))
+#define minqx_ld(XG, MS, DS)                                                \
+        minjx_ld(W(XG), W(MS), W(DS))
 
-/* cvt (D = fp-to-signed-int S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define minqx3rr(XD, XS, XT)                                                \
+        minjx3rr(W(XD), W(XS), W(XT))
 
-#define rndos_rr(XD, XS)                                                    \
-        rndcs_rr(W(XD), W(XS))
+#define minqx3ld(XD, XS, MT, DT)                                            \
+        minjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rndos_ld(XD, MS, DS)                                                \
-        rndcs_ld(W(XD), W(MS), W(DS))
+#endif /* minjx_rr */
 
-#define cvtos_rr(XD, XS)                                                    \
-        cvtcs_rr(W(XD), W(XS))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
 
-#define cvtos_ld(XD, MS, DS)                                                \
-        cvtcs_ld(W(XD), W(MS), W(DS))
+#ifdef minjn_rr
 
-/* cvt (D = signed-int-to-fp S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+#define minqn_rr(XG, XS)                                                    \
+        minjn_rr(W(XG), W(XS))
 
-#define cvton_rr(XD, XS)                                                    \
-        cvtcn_rr(W(XD), W(XS))
+#define minqn_ld(XG, MS, DS)                                                \
+        minjn_ld(W(XG), W(MS), W(DS))
 
-#define cvton_ld(XD, MS, DS)                                                \
-        cvtcn_ld(W(XD), W(MS), W(DS))
+#define minqn3rr(XD, XS, XT)                                                \
+        minjn3rr(W(XD), W(XS), W(XT))
 
-/* cvr (D = fp-to-signed-int S)
- * rounding mode is encoded directly (cannot be used in FCTRL blocks)
- * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
- * isn't always taken into account when used within full-IEEE ASM block
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define minqn3ld(XD, XS, MT, DT)                                            \
+        minjn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rnros_rr(XD, XS, mode)                                              \
-        rnrcs_rr(W(XD), W(XS), mode)
+#endif /* minjn_rr */
 
-#define cvros_rr(XD, XS, mode)                                              \
-        cvrcs_rr(W(XD), W(XS), mode)
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned */
 
-/************   packed single-precision integer arithmetic/shifts   ***********/
+#ifdef maxjx_rr
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#define maxqx_rr(XG, XS)                                                    \
+        maxjx_rr(W(XG), W(XS))
 
-#define addox_rr(XG, XS)                                                    \
-        addcx_rr(W(XG), W(XS))
+#define maxqx_ld(XG, MS, DS)                                                \
+        maxjx_ld(W(XG), W(MS), W(DS))
 
-#define addox_ld(XG, MS, DS)                                                \
-        addcx_ld(W(XG), W(MS), W(DS))
+#define maxqx3rr(XD, XS, XT)                                                \
+        maxjx3rr(W(XD), W(XS), W(XT))
 
-#define addox3rr(XD, XS, XT)                                                \
-        addcx3rr(W(XD), W(XS), W(XT))
+#define maxqx3ld(XD, XS, MT, DT)                                            \
+        maxjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define addox3ld(XD, XS, MT, DT)                                            \
-        addcx3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* maxjx_rr */
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
 
-#define subox_rr(XG, XS)                                                    \
-        subcx_rr(W(XG), W(XS))
+#ifdef maxjn_rr
 
-#define subox_ld(XG, MS, DS)                                                \
-        subcx_ld(W(XG), W(MS), W(DS))
+#define maxqn_rr(XG, XS)                                                    \
+        maxjn_rr(W(XG), W(XS))
 
-#define subox3rr(XD, XS, XT)                                                \
-        subcx3rr(W(XD), W(XS), W(XT))
+#define maxqn_ld(XG, MS, DS)                                                \
+        maxjn_ld(W(XG), W(MS), W(DS))
 
-#define subox3ld(XD, XS, MT, DT)                                            \
-        subcx3ld(W(XD), W(XS), W(MT), W(DT))
+#define maxqn3rr(XD, XS, XT)                                                \
+        maxjn3rr(W(XD), W(XS), W(XT))
 
-/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define maxqn3ld(XD, XS, MT, DT)                                            \
+        maxjn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define shlox_ri(XG, IS)                                                    \
-        shlcx_ri(W(XG), W(IS))
+#endif /* maxjn_rr */
 
-#define shlox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shlcx_ld(W(XG), W(MS), W(DS))
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
-#define shlox3ri(XD, XS, IT)                                                \
-        shlcx3ri(W(XD), W(XS), W(IT))
+#ifdef ceqjx_rr
 
-#define shlox3ld(XD, XS, MT, DT)                                            \
-        shlcx3ld(W(XD), W(XS), W(MT), W(DT))
+#define ceqqx_rr(XG, XS)                                                    \
+        ceqjx_rr(W(XG), W(XS))
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define ceqqx_ld(XG, MS, DS)                                                \
+        ceqjx_ld(W(XG), W(MS), W(DS))
 
-#define shrox_ri(XG, IS)                                                    \
-        shrcx_ri(W(XG), W(IS))
+#define ceqqx3rr(XD, XS, XT)                                                \
+        ceqjx3rr(W(XD), W(XS), W(XT))
 
-#define shrox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrcx_ld(W(XG), W(MS), W(DS))
+#define ceqqx3ld(XD, XS, MT, DT)                                            \
+        ceqjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define shrox3ri(XD, XS, IT)                                                \
-        shrcx3ri(W(XD), W(XS), W(IT))
+#endif /* ceqjx_rr */
 
-#define shrox3ld(XD, XS, MT, DT)                                            \
-        shrcx3ld(W(XD), W(XS), W(MT), W(DT))
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#ifdef cnejx_rr
 
-#define shron_ri(XG, IS)                                                    \
-        shrcn_ri(W(XG), W(IS))
+#define cneqx_rr(XG, XS)                                                    \
+        cnejx_rr(W(XG), W(XS))
 
-#define shron_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrcn_ld(W(XG), W(MS), W(DS))
+#define cneqx_ld(XG, MS, DS)                                                \
+        cnejx_ld(W(XG), W(MS), W(DS))
 
-#define shron3ri(XD, XS, IT)                                                \
-        shrcn3ri(W(XD), W(XS), W(IT))
+#define cneqx3rr(XD, XS, XT)                                                \
+        cnejx3rr(W(XD), W(XS), W(XT))
 
-#define shron3ld(XD, XS, MT, DT)                                            \
-        shrcn3ld(W(XD), W(XS), W(MT), W(DT))
+#define cneqx3ld(XD, XS, MT, DT)                                            \
+        cnejx3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#endif /* cnejx_rr */
 
-#define svlox_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svlcx_rr(W(XG), W(XS))
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned */
 
-#define svlox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svlcx_ld(W(XG), W(MS), W(DS))
+#ifdef cltjx_rr
 
-#define svlox3rr(XD, XS, XT)                                                \
-        svlcx3rr(W(XD), W(XS), W(XT))
+#define cltqx_rr(XG, XS)                                                    \
+        cltjx_rr(W(XG), W(XS))
 
-#define svlox3ld(XD, XS, MT, DT)                                            \
-        svlcx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cltqx_ld(XG, MS, DS)                                                \
+        cltjx_ld(W(XG), W(MS), W(DS))
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define cltqx3rr(XD, XS, XT)                                                \
+        cltjx3rr(W(XD), W(XS), W(XT))
 
-#define svrox_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrcx_rr(W(XG), W(XS))
+#define cltqx3ld(XD, XS, MT, DT)                                            \
+        cltjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define svrox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrcx_ld(W(XG), W(MS), W(DS))
+#endif /* cltjx_rr */
 
-#define svrox3rr(XD, XS, XT)                                                \
-        svrcx3rr(W(XD), W(XS), W(XT))
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed */
 
-#define svrox3ld(XD, XS, MT, DT)                                            \
-        svrcx3ld(W(XD), W(XS), W(MT), W(DT))
+#ifdef cltjn_rr
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define cltqn_rr(XG, XS)                                                    \
+        cltjn_rr(W(XG), W(XS))
 
-#define svron_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrcn_rr(W(XG), W(XS))
+#define cltqn_ld(XG, MS, DS)                                                \
+        cltjn_ld(W(XG), W(MS), W(DS))
 
-#define svron_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrcn_ld(W(XG), W(MS), W(DS))
+#define cltqn3rr(XD, XS, XT)                                                \
+        cltjn3rr(W(XD), W(XS), W(XT))
 
-#define svron3rr(XD, XS, XT)                                                \
-        svrcn3rr(W(XD), W(XS), W(XT))
+#define cltqn3ld(XD, XS, MT, DT)                                            \
+        cltjn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define svron3ld(XD, XS, MT, DT)                                            \
-        svrcn3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* cltjn_rr */
 
-/*
- * common 256-bit floating-point SIMD instructions with 32-bit elements
- */
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned */
 
-/* cbr (D = cbrt S) */
+#ifdef clejx_rr
 
-/*
- * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
- * available at http://www.musicdsp.org/showone.php?id=206
- * converted to S-way SIMD version by VectorChief.
- */
-#define cbrcs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbecs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbscs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbscs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbscs_rr(W(XD), W(X1), W(X2), W(XS))
+#define cleqx_rr(XG, XS)                                                    \
+        clejx_rr(W(XG), W(XS))
 
-#define cbecs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        /* cube root estimate, the exponent is divided by three             \
-         * in such a way that remainder bits get shoved into                \
-         * the top of the normalized mantissa */                            \
-        movcx_ld(W(X2), Mebp, inf_GPC04_32)                                 \
-        movcx_rr(W(XD), W(XS))                                              \
-        andcx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
-        subcx_ld(W(XD), Mebp, inf_GPC05_32) /* convert to 2's complement */ \
-        shrcn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
-        movcx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
-        shlcx_ri(W(X1), IB(2))                                              \
-        addcx_rr(W(XD), W(X1))                                              \
-        shlcx_ri(W(X1), IB(2))                                              \
-        addcx_rr(W(XD), W(X1))                                              \
-        shlcx_ri(W(X1), IB(2))                                              \
-        addcx_rr(W(XD), W(X1))                                              \
-        shlcx_ri(W(X1), IB(2))                                              \
-        addcx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
-        addcx_ld(W(XD), Mebp, inf_GPC05_32) /* back to biased-127 */        \
-        andcx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
-        anncx_rr(W(X2), W(XS))   /* original sign */                        \
-        orrcx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+#define cleqx_ld(XG, MS, DS)                                                \
+        clejx_ld(W(XG), W(MS), W(DS))
 
-#define cbscs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        movcx_rr(W(X1), W(XG))                                              \
-        mulcs_rr(W(X1), W(XG))                                              \
-        movcx_rr(W(X2), W(X1))                                              \
-        mulcs_ld(W(X1), Mebp, inf_GPC03_32)                                 \
-        rcecs_rr(W(X1), W(X1))                                              \
-        mulcs_rr(W(X2), W(XG))                                              \
-        subcs_rr(W(X2), W(XS))                                              \
-        mulcs_rr(W(X2), W(X1))                                              \
-        subcs_rr(W(XG), W(X2))
+#define cleqx3rr(XD, XS, XT)                                                \
+        clejx3rr(W(XD), W(XS), W(XT))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cleqx3ld(XD, XS, MT, DT)                                            \
+        clejx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#endif /* clejx_rr */
 
-#define rcpcs_rr(XD, XS) /* destroys XS */                                  \
-        rcecs_rr(W(XD), W(XS))                                              \
-        rcscs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed */
 
-#elif RT_SIMD_COMPAT_RCP == 1
+#ifdef clejn_rr
 
-#define rcpcs_rr(XD, XS) /* destroys XS */                                  \
-        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divcs_rr(W(XD), W(XS))
+#define cleqn_rr(XG, XS)                                                    \
+        clejn_rr(W(XG), W(XS))
 
-#define rcecs_rr(XD, XS)                                                    \
-        movcx_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divcs_ld(W(XD), Mebp, inf_SCR02(0))
+#define cleqn_ld(XG, MS, DS)                                                \
+        clejn_ld(W(XG), W(MS), W(DS))
 
-#define rcscs_rr(XG, XS) /* destroys XS */
+#define cleqn3rr(XD, XS, XT)                                                \
+        clejn3rr(W(XD), W(XS), W(XT))
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define cleqn3ld(XD, XS, MT, DT)                                            \
+        clejn3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#endif /* clejn_rr */
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned */
 
-#define rsqcs_rr(XD, XS) /* destroys XS */                                  \
-        rsecs_rr(W(XD), W(XS))                                              \
-        rsscs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#ifdef cgtjx_rr
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define cgtqx_rr(XG, XS)                                                    \
+        cgtjx_rr(W(XG), W(XS))
 
-#define rsqcs_rr(XD, XS) /* destroys XS */                                  \
-        sqrcs_rr(W(XS), W(XS))                                              \
-        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divcs_rr(W(XD), W(XS))
+#define cgtqx_ld(XG, MS, DS)                                                \
+        cgtjx_ld(W(XG), W(MS), W(DS))
 
-#define rsecs_rr(XD, XS)                                                    \
-        sqrcs_rr(W(XD), W(XS))                                              \
-        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movcx_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divcs_ld(W(XD), Mebp, inf_SCR02(0))
+#define cgtqx3rr(XD, XS, XT)                                                \
+        cgtjx3rr(W(XD), W(XS), W(XT))
 
-#define rsscs_rr(XG, XS) /* destroys XS */
+#define cgtqx3ld(XD, XS, MT, DT)                                            \
+        cgtjx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#endif /* cgtjx_rr */
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed */
 
-#if RT_SIMD_COMPAT_FMA == 2
+#ifdef cgtjn_rr
 
-#define fmacs_rr(XG, XS, XT)                                                \
-        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulcs_rr(W(XS), W(XT))                                              \
-        addcs_rr(W(XG), W(XS))                                              \
-        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+#define cgtqn_rr(XG, XS)                                                    \
+        cgtjn_rr(W(XG), W(XS))
 
-#define fmacs_ld(XG, XS, MT, DT)                                            \
-        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulcs_ld(W(XS), W(MT), W(DT))                                       \
-        addcs_rr(W(XG), W(XS))                                              \
-        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+#define cgtqn_ld(XG, MS, DS)                                                \
+        cgtjn_ld(W(XG), W(MS), W(DS))
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define cgtqn3rr(XD, XS, XT)                                                \
+        cgtjn3rr(W(XD), W(XS), W(XT))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define cgtqn3ld(XD, XS, MT, DT)                                            \
+        cgtjn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#endif /* cgtjn_rr */
 
-#define fmscs_rr(XG, XS, XT)                                                \
-        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulcs_rr(W(XS), W(XT))                                              \
-        subcs_rr(W(XG), W(XS))                                              \
-        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned */
 
-#define fmscs_ld(XG, XS, MT, DT)                                            \
-        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulcs_ld(W(XS), W(MT), W(DT))                                       \
-        subcs_rr(W(XG), W(XS))                                              \
-        movcx_ld(W(XS), Mebp, inf_SCR01(0))
+#ifdef cgejx_rr
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#define cgeqx_rr(XG, XS)                                                    \
+        cgejx_rr(W(XG), W(XS))
 
-/******************************************************************************/
-/**** var-len **** SIMD instructions with fixed-32-bit-element **** 128-bit ***/
-/******************************************************************************/
+#define cgeqx_ld(XG, MS, DS)                                                \
+        cgejx_ld(W(XG), W(MS), W(DS))
 
-#elif (RT_SIMD == 128)
+#define cgeqx3rr(XD, XS, XT)                                                \
+        cgejx3rr(W(XD), W(XS), W(XT))
 
-/***************   packed single-precision generic move/logic   ***************/
+#define cgeqx3ld(XD, XS, MT, DT)                                            \
+        cgejx3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* mov (D = S) */
+#endif /* cgejx_rr */
 
-#define movox_rr(XD, XS)                                                    \
-        movix_rr(W(XD), W(XS))
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed */
 
-#define movox_ld(XD, MS, DS)                                                \
-        movix_ld(W(XD), W(MS), W(DS))
+#ifdef cgejn_rr
 
-#define movox_st(XS, MD, DD)                                                \
-        movix_st(W(XS), W(MD), W(DD))
+#define cgeqn_rr(XG, XS)                                                    \
+        cgejn_rr(W(XG), W(XS))
 
-/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
- * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+#define cgeqn_ld(XG, MS, DS)                                                \
+        cgejn_ld(W(XG), W(MS), W(DS))
 
-#define mmvox_ld(XG, MS, DS)                                                \
-        mmvix_ld(W(XG), W(MS), W(DS))
+#define cgeqn3rr(XD, XS, XT)                                                \
+        cgejn3rr(W(XD), W(XS), W(XT))
 
-#define mmvox_st(XS, MG, DG)                                                \
-        mmvix_st(W(XS), W(MG), W(DG))
+#define cgeqn3ld(XD, XS, MT, DT)                                            \
+        cgejn3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* and (G = G & S), (D = S & T) if (#D != #S) */
+#endif /* cgejn_rr */
 
-#define andox_rr(XG, XS)                                                    \
-        andix_rr(W(XG), W(XS))
+/*
+ * common 128-bit floating-point SIMD instructions with 64-bit elements
+ */
 
-#define andox_ld(XG, MS, DS)                                                \
-        andix_ld(W(XG), W(MS), W(DS))
+/* cbr (D = cbrt S) */
 
-#define andox3rr(XD, XS, XT)                                                \
-        andix3rr(W(XD), W(XS), W(XT))
+/*
+ * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
+ * available at http://www.musicdsp.org/showone.php?id=206
+ * converted to S-way SIMD version by VectorChief.
+ */
+#define cbrjs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cbejs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsjs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsjs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        cbsjs_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define andox3ld(XD, XS, MT, DT)                                            \
-        andix3ld(W(XD), W(XS), W(MT), W(DT))
+#define cbejs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        /* cube root estimate, the exponent is divided by three             \
+         * in such a way that remainder bits get shoved into                \
+         * the top of the normalized mantissa */                            \
+        movjx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
+        movjx_rr(W(XD), W(XS))                                              \
+        andjx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
+        subjx_ld(W(XD), Mebp, inf_GPC05_64) /* convert to 2's complement */ \
+        shrjn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
+        movjx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
+        shljx_ri(W(X1), IB(2))                                              \
+        addjx_rr(W(XD), W(X1))                                              \
+        shljx_ri(W(X1), IB(2))                                              \
+        addjx_rr(W(XD), W(X1))                                              \
+        shljx_ri(W(X1), IB(2))                                              \
+        addjx_rr(W(XD), W(X1))                                              \
+        shljx_ri(W(X1), IB(2))                                              \
+        addjx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
+        addjx_ld(W(XD), Mebp, inf_GPC05_64) /* back to biased-127 */        \
+        andjx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
+        annjx_rr(W(X2), W(XS))   /* original sign */                        \
+        orrjx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
 
-/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+#define cbsjs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movjx_rr(W(X1), W(XG))                                              \
+        muljs_rr(W(X1), W(XG))                                              \
+        movjx_rr(W(X2), W(X1))                                              \
+        muljs_ld(W(X1), Mebp, inf_GPC03_64)                                 \
+        rcejs_rr(W(X1), W(X1))                                              \
+        muljs_rr(W(X2), W(XG))                                              \
+        subjs_rr(W(X2), W(XS))                                              \
+        muljs_rr(W(X2), W(X1))                                              \
+        subjs_rr(W(XG), W(X2))
 
-#define annox_rr(XG, XS)                                                    \
-        annix_rr(W(XG), W(XS))
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
 
-#define annox_ld(XG, MS, DS)                                                \
-        annix_ld(W(XG), W(MS), W(DS))
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
 
-#define annox3rr(XD, XS, XT)                                                \
-        annix3rr(W(XD), W(XS), W(XT))
+#define rcpjs_rr(XD, XS) /* destroys XS */                                  \
+        rcejs_rr(W(XD), W(XS))                                              \
+        rcsjs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
 
-#define annox3ld(XD, XS, MT, DT)                                            \
-        annix3ld(W(XD), W(XS), W(MT), W(DT))
+#elif RT_SIMD_COMPAT_RCP == 1
 
-/* orr (G = G | S), (D = S | T) if (#D != #S) */
+#define rcpjs_rr(XD, XS) /* destroys XS */                                  \
+        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divjs_rr(W(XD), W(XS))
 
-#define orrox_rr(XG, XS)                                                    \
-        orrix_rr(W(XG), W(XS))
+#define rcejs_rr(XD, XS)                                                    \
+        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divjs_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define orrox_ld(XG, MS, DS)                                                \
-        orrix_ld(W(XG), W(MS), W(DS))
+#define rcsjs_rr(XG, XS) /* destroys XS */
 
-#define orrox3rr(XD, XS, XT)                                                \
-        orrix3rr(W(XD), W(XS), W(XT))
+#endif /* RT_SIMD_COMPAT_RCP */
 
-#define orrox3ld(XD, XS, MT, DT)                                            \
-        orrix3ld(W(XD), W(XS), W(MT), W(DT))
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
 
-/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
 
-#define ornox_rr(XG, XS)                                                    \
-        ornix_rr(W(XG), W(XS))
+#define rsqjs_rr(XD, XS) /* destroys XS */                                  \
+        rsejs_rr(W(XD), W(XS))                                              \
+        rssjs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
 
-#define ornox_ld(XG, MS, DS)                                                \
-        ornix_ld(W(XG), W(MS), W(DS))
+#elif RT_SIMD_COMPAT_RSQ == 1
 
-#define ornox3rr(XD, XS, XT)                                                \
-        ornix3rr(W(XD), W(XS), W(XT))
+#define rsqjs_rr(XD, XS) /* destroys XS */                                  \
+        sqrjs_rr(W(XS), W(XS))                                              \
+        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divjs_rr(W(XD), W(XS))
 
-#define ornox3ld(XD, XS, MT, DT)                                            \
-        ornix3ld(W(XD), W(XS), W(MT), W(DT))
+#define rsejs_rr(XD, XS)                                                    \
+        sqrjs_rr(W(XD), W(XS))                                              \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divjs_ld(W(XD), Mebp, inf_SCR02(0))
 
-/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+#define rssjs_rr(XG, XS) /* destroys XS */
 
-#define xorox_rr(XG, XS)                                                    \
-        xorix_rr(W(XG), W(XS))
+#endif /* RT_SIMD_COMPAT_RSQ */
 
-#define xorox_ld(XG, MS, DS)                                                \
-        xorix_ld(W(XG), W(MS), W(DS))
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#define xorox3rr(XD, XS, XT)                                                \
-        xorix3rr(W(XD), W(XS), W(XT))
+#if RT_SIMD_COMPAT_FMA == 2
 
-#define xorox3ld(XD, XS, MT, DT)                                            \
-        xorix3ld(W(XD), W(XS), W(MT), W(DT))
+#define fmajs_rr(XG, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        muljs_rr(W(XS), W(XT))                                              \
+        addjs_rr(W(XG), W(XS))                                              \
+        movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-/* not (G = ~G), (D = ~S) */
+#define fmajs_ld(XG, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        muljs_ld(W(XS), W(MT), W(DT))                                       \
+        addjs_rr(W(XG), W(XS))                                              \
+        movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#define notox_rx(XG)                                                        \
-        notix_rx(W(XG))
+#endif /* RT_SIMD_COMPAT_FMA */
 
-#define notox_rr(XD, XS)                                                    \
-        notix_rr(W(XD), W(XS))
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-/************   packed single-precision floating-point arithmetic   ***********/
+#if RT_SIMD_COMPAT_FMS == 2
 
-/* neg (G = -G), (D = -S) */
+#define fmsjs_rr(XG, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        muljs_rr(W(XS), W(XT))                                              \
+        subjs_rr(W(XG), W(XS))                                              \
+        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsjs_ld(XG, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        muljs_ld(W(XS), W(MT), W(DT))                                       \
+        subjs_rr(W(XG), W(XS))                                              \
+        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+#endif /* RT_SIMD: 512, 256, 128 */
+
+/******************************************************************************/
+/**** scalar ***** SIMD instructions with fixed-64-bit-element ****************/
+/******************************************************************************/
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
 
-#define negos_rx(XG)                                                        \
-        negis_rx(W(XG))
+#define rcpts_rr(XD, XS) /* destroys XS */                                  \
+        rcets_rr(W(XD), W(XS))                                              \
+        rcsts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
 
-#define negos_rr(XD, XS)                                                    \
-        negis_rr(W(XD), W(XS))
+#elif RT_SIMD_COMPAT_RCP == 1
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#define rcpts_rr(XD, XS) /* destroys XS */                                  \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_rr(W(XD), W(XS))
 
-#define addos_rr(XG, XS)                                                    \
-        addis_rr(W(XG), W(XS))
+#define rcets_rr(XD, XS)                                                    \
+        movts_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define addos_ld(XG, MS, DS)                                                \
-        addis_ld(W(XG), W(MS), W(DS))
+#define rcsts_rr(XG, XS) /* destroys XS */
 
-#define addos3rr(XD, XS, XT)                                                \
-        addis3rr(W(XD), W(XS), W(XT))
+#endif /* RT_SIMD_COMPAT_RCP */
 
-#define addos3ld(XD, XS, MT, DT)                                            \
-        addis3ld(W(XD), W(XS), W(MT), W(DT))
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
 
-#define subos_rr(XG, XS)                                                    \
-        subis_rr(W(XG), W(XS))
+#define rsqts_rr(XD, XS) /* destroys XS */                                  \
+        rsets_rr(W(XD), W(XS))                                              \
+        rssts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
 
-#define subos_ld(XG, MS, DS)                                                \
-        subis_ld(W(XG), W(MS), W(DS))
+#elif RT_SIMD_COMPAT_RSQ == 1
 
-#define subos3rr(XD, XS, XT)                                                \
-        subis3rr(W(XD), W(XS), W(XT))
+#define rsqts_rr(XD, XS) /* destroys XS */                                  \
+        sqrts_rr(W(XS), W(XS))                                              \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_rr(W(XD), W(XS))
 
-#define subos3ld(XD, XS, MT, DT)                                            \
-        subis3ld(W(XD), W(XS), W(MT), W(DT))
+#define rsets_rr(XD, XS)                                                    \
+        sqrts_rr(W(XD), W(XS))                                              \
+        movts_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_ld(W(XD), Mebp, inf_SCR02(0))
 
-/* mul (G = G * S), (D = S * T) if (#D != #S) */
+#define rssts_rr(XG, XS) /* destroys XS */
 
-#define mulos_rr(XG, XS)                                                    \
-        mulis_rr(W(XG), W(XS))
+#endif /* RT_SIMD_COMPAT_RSQ */
 
-#define mulos_ld(XG, MS, DS)                                                \
-        mulis_ld(W(XG), W(MS), W(DS))
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#define mulos3rr(XD, XS, XT)                                                \
-        mulis3rr(W(XD), W(XS), W(XT))
+#if RT_SIMD_COMPAT_FMA == 2
 
-#define mulos3ld(XD, XS, MT, DT)                                            \
-        mulis3ld(W(XD), W(XS), W(MT), W(DT))
+#define fmats_rr(XG, XS, XT)                                                \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_rr(W(XS), W(XT))                                              \
+        addts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-/* div (G = G / S), (D = S / T) if (#D != #S) */
+#define fmats_ld(XG, XS, MT, DT)                                            \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_ld(W(XS), W(MT), W(DT))                                       \
+        addts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-#define divos_rr(XG, XS)                                                    \
-        divis_rr(W(XG), W(XS))
+#endif /* RT_SIMD_COMPAT_FMA */
 
-#define divos_ld(XG, MS, DS)                                                \
-        divis_ld(W(XG), W(MS), W(DS))
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all Power systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#define divos3rr(XD, XS, XT)                                                \
-        divis3rr(W(XD), W(XS), W(XT))
+#if RT_SIMD_COMPAT_FMS == 2
 
-#define divos3ld(XD, XS, MT, DT)                                            \
-        divis3ld(W(XD), W(XS), W(MT), W(DT))
+#define fmsts_rr(XG, XS, XT)                                                \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_rr(W(XS), W(XT))                                              \
+        subts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-/* sqr (D = sqrt S) */
+#define fmsts_ld(XG, XS, MT, DT)                                            \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_ld(W(XS), W(MT), W(DT))                                       \
+        subts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-#define sqros_rr(XD, XS)                                                    \
-        sqris_rr(W(XD), W(XS))
+#endif /* RT_SIMD_COMPAT_FMS */
 
-#define sqros_ld(XD, MS, DS)                                                \
-        sqris_ld(W(XD), W(MS), W(DS))
+/******************************************************************************/
+/**** var-len **** SIMD chunk iterators for generic fallbacks ****************/
+/******************************************************************************/
 
-/* cbr (D = cbrt S) */
+/*
+ * Generic element-wise fallbacks store SIMD registers to scratch areas
+ * inf_SCR01/inf_SCR02 and process them one 128-bit chunk at a time.
+ * Chunk iterators below are the only part of them depending on RT_SIMD:
+ * chnxx_up runs chunks from the lowest, chnxx_dn from the highest one,
+ * calling fx(cx, XA, XB, dp) with byte offset dp of each chunk, where
+ * adapters chnxx_a1, chnxx_r1, chnxx_r2 pass either a plain arg or one/two
+ * W() tuples (registers, immediates) from XA, XB to the per-chunk helper cx.
+ * Horizontal reductions fold halves of the full width via rdhxx_xx instead.
+ */
 
-#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbris_rr(W(XD), W(X1), W(X2), W(XS))
+/* internal helpers (not for direct use in code) */
 
-#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbeis_rr(W(XD), W(X1), W(X2), W(XS))
+#define chnxx_a1(cx, a1, a2, a3, b1, b2, b3, dp)                            \
+        cx(a1, dp)
 
-#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbsis_rr(W(XG), W(X1), W(X2), W(XS))
+#define chnxx_r1(cx, a1, a2, a3, b1, b2, b3, dp)                            \
+        cx(W(a1, a2, a3), dp)
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define chnxx_r2(cx, a1, a2, a3, b1, b2, b3, dp)                            \
+        cx(W(a1, a2, a3), W(b1, b2, b3), dp)
 
-#define rcpos_rr(XD, XS) /* destroys XS */                                  \
-        rcpis_rr(W(XD), W(XS))
+#define chnup_01(fx, cx, XA, XB, dp)                                        \
+        fx(cx, XA, XB, dp)
 
-#define rceos_rr(XD, XS)                                                    \
-        rceis_rr(W(XD), W(XS))
+#define chnup_02(fx, cx, XA, XB, dp)                                        \
+        chnup_01(fx, cx, W(XA), W(XB), dp)                                  \
+        chnup_01(fx, cx, W(XA), W(XB), dp+0x010)
 
-#define rcsos_rr(XG, XS) /* destroys XS */                                  \
-        rcsis_rr(W(XG), W(XS))
+#define chnup_04(fx, cx, XA, XB, dp)                                        \
+        chnup_02(fx, cx, W(XA), W(XB), dp)                                  \
+        chnup_02(fx, cx, W(XA), W(XB), dp+0x020)
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define chnup_08(fx, cx, XA, XB, dp)                                        \
+        chnup_04(fx, cx, W(XA), W(XB), dp)                                  \
+        chnup_04(fx, cx, W(XA), W(XB), dp+0x040)
 
-#define rsqos_rr(XD, XS) /* destroys XS */                                  \
-        rsqis_rr(W(XD), W(XS))
+#define chnup_16(fx, cx, XA, XB, dp)                                        \
+        chnup_08(fx, cx, W(XA), W(XB), dp)                                  \
+        chnup_08(fx, cx, W(XA), W(XB), dp+0x080)
 
-#define rseos_rr(XD, XS)                                                    \
-        rseis_rr(W(XD), W(XS))
+#define chndn_01(fx, cx, XA, XB, dp)                                        \
+        fx(cx, XA, XB, dp)
 
-#define rssos_rr(XG, XS) /* destroys XS */                                  \
-        rssis_rr(W(XG), W(XS))
+#define chndn_02(fx, cx, XA, XB, dp)                                        \
+        chndn_01(fx, cx, W(XA), W(XB), dp+0x010)                            \
+        chndn_01(fx, cx, W(XA), W(XB), dp)
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#define chndn_04(fx, cx, XA, XB, dp)                                        \
+        chndn_02(fx, cx, W(XA), W(XB), dp+0x020)                            \
+        chndn_02(fx, cx, W(XA), W(XB), dp)
 
-#define fmaos_rr(XG, XS, XT)                                                \
-        fmais_rr(W(XG), W(XS), W(XT))
+#define chndn_08(fx, cx, XA, XB, dp)                                        \
+        chndn_04(fx, cx, W(XA), W(XB), dp+0x040)                            \
+        chndn_04(fx, cx, W(XA), W(XB), dp)
 
-#define fmaos_ld(XG, XS, MT, DT)                                            \
-        fmais_ld(W(XG), W(XS), W(MT), W(DT))
+#define chndn_16(fx, cx, XA, XB, dp)                                        \
+        chndn_08(fx, cx, W(XA), W(XB), dp+0x080)                            \
+        chndn_08(fx, cx, W(XA), W(XB), dp)
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#if   (RT_SIMD == 2048)
 
-#define fmsos_rr(XG, XS, XT)                                                \
-        fmsis_rr(W(XG), W(XS), W(XT))
+#define chnxx_up(fx, cx, XA, XB)                                            \
+        chnup_16(fx, cx, W(XA), W(XB), 0x000)
 
-#define fmsos_ld(XG, XS, MT, DT)                                            \
-        fmsis_ld(W(XG), W(XS), W(MT), W(DT))
+#define chnxx_dn(fx, cx, XA, XB)                                            \
+        chndn_16(fx, cx, W(XA), W(XB), 0x000)
 
-/*************   packed single-precision floating-point compare   *************/
+#define rdhxx_xx(op, XD)                                                    \
+        rdhxx_80(op, W(XD))
 
-/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+#elif (RT_SIMD == 1024)
 
-#define minos_rr(XG, XS)                                                    \
-        minis_rr(W(XG), W(XS))
+#define chnxx_up(fx, cx, XA, XB)                                            \
+        chnup_08(fx, cx, W(XA), W(XB), 0x000)
 
-#define minos_ld(XG, MS, DS)                                                \
-        minis_ld(W(XG), W(MS), W(DS))
+#define chnxx_dn(fx, cx, XA, XB)                                            \
+        chndn_08(fx, cx, W(XA), W(XB), 0x000)
 
-#define minos3rr(XD, XS, XT)                                                \
-        minis3rr(W(XD), W(XS), W(XT))
+#define rdhxx_xx(op, XD)                                                    \
+        rdhxx_40(op, W(XD))
 
-#define minos3ld(XD, XS, MT, DT)                                            \
-        minis3ld(W(XD), W(XS), W(MT), W(DT))
+#elif (RT_SIMD == 512)
 
-/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+#define chnxx_up(fx, cx, XA, XB)                                            \
+        chnup_04(fx, cx, W(XA), W(XB), 0x000)
 
-#define maxos_rr(XG, XS)                                                    \
-        maxis_rr(W(XG), W(XS))
+#define chnxx_dn(fx, cx, XA, XB)                                            \
+        chndn_04(fx, cx, W(XA), W(XB), 0x000)
 
-#define maxos_ld(XG, MS, DS)                                                \
-        maxis_ld(W(XG), W(MS), W(DS))
+#define rdhxx_xx(op, XD)                                                    \
+        rdhxx_20(op, W(XD))
 
-#define maxos3rr(XD, XS, XT)                                                \
-        maxis3rr(W(XD), W(XS), W(XT))
+#elif (RT_SIMD == 256)
 
-#define maxos3ld(XD, XS, MT, DT)                                            \
-        maxis3ld(W(XD), W(XS), W(MT), W(DT))
+#define chnxx_up(fx, cx, XA, XB)                                            \
+        chnup_02(fx, cx, W(XA), W(XB), 0x000)
 
-/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+#define chnxx_dn(fx, cx, XA, XB)                                            \
+        chndn_02(fx, cx, W(XA), W(XB), 0x000)
 
-#define ceqos_rr(XG, XS)                                                    \
-        ceqis_rr(W(XG), W(XS))
+#define rdhxx_xx(op, XD)                                                    \
+        rdhxx_10(op, W(XD))
 
-#define ceqos_ld(XG, MS, DS)                                                \
-        ceqis_ld(W(XG), W(MS), W(DS))
+#elif (RT_SIMD == 128)
 
-#define ceqos3rr(XD, XS, XT)                                                \
-        ceqis3rr(W(XD), W(XS), W(XT))
+#define chnxx_up(fx, cx, XA, XB)                                            \
+        chnup_01(fx, cx, W(XA), W(XB), 0x000)
 
-#define ceqos3ld(XD, XS, MT, DT)                                            \
-        ceqis3ld(W(XD), W(XS), W(MT), W(DT))
+#define chnxx_dn(fx, cx, XA, XB)                                            \
+        chndn_01(fx, cx, W(XA), W(XB), 0x000)
 
-/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+#define rdhxx_xx(op, XD)
 
-#define cneos_rr(XG, XS)                                                    \
-        cneis_rr(W(XG), W(XS))
+#endif /* RT_SIMD */
 
-#define cneos_ld(XG, MS, DS)                                                \
-        cneis_ld(W(XG), W(MS), W(DS))
+/******************************************************************************/
+/**** var-len **** SIMD horizontal reductions across all elements ************/
+/******************************************************************************/
 
-#define cneos3rr(XD, XS, XT)                                                \
-        cneis3rr(W(XD), W(XS), W(XT))
+/*
+ * Horizontal reductions (sum, min, max) of all elements of a SIMD register
+ * return a scalar result in the lowest element of the destination register,
+ * other elements of the destination are undefined upon completion.
+ * Backends may provide native forms (pairwise adds, across-vector min/max),
+ * otherwise targets with native in-chunk shuffles (shf*x3ri) fold the register
+ * in log2 steps: upper half of the active width is brought down to its lower
+ * half (fldox_rx if provided by the backend, offset load from inf_SCR01
+ * otherwise), then shuffles finish the fold within the lowest 128-bit chunk.
+ * As x86 has no spare SIMD register, the copy of D combined at each step
+ * is kept in scratch area inf_SCR01 and consumed via op*s_ld.
+ * Remaining targets fold across chunks the same way, then finish the lowest
+ * chunk with scalar instructions (cmdr*_**, cmdt*_**) over its elements
+ * stored in inf_SCR01.
+ * Order of evaluation of fp sums is thus target-dependent,
+ * results may differ in the last bits across targets.
+ */
 
-#define cneos3ld(XD, XS, MT, DT)                                            \
-        cneis3ld(W(XD), W(XS), W(MT), W(DT))
+/* internal helpers (not for direct use in code) */
 
-/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+#ifdef fldox_rx
 
-#define cltos_rr(XG, XS)                                                    \
-        cltis_rr(W(XG), W(XS))
+#define rdhxx_fx(op, XD, n)                                                 \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        fldox_rx(W(XD), n)                                                  \
+        op##_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cltos_ld(XG, MS, DS)                                                \
-        cltis_ld(W(XG), W(MS), W(DS))
+#else /* fldox_rx */
 
-#define cltos3rr(XD, XS, XT)                                                \
-        cltis3rr(W(XD), W(XS), W(XT))
+#define rdhxx_fx(op, XD, n)                                                 \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        op##_ld(W(XD), Mebp, inf_SCR01(0x##n))
 
-#define cltos3ld(XD, XS, MT, DT)                                            \
-        cltis3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* fldox_rx */
 
-/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+#define rdhxx_10(op, XD)                                                    \
+        rdhxx_fx(op, W(XD), 10)
 
-#define cleos_rr(XG, XS)                                                    \
-        cleis_rr(W(XG), W(XS))
+#define rdhxx_20(op, XD)                                                    \
+        rdhxx_fx(op, W(XD), 20)                                             \
+        rdhxx_10(op, W(XD))
 
-#define cleos_ld(XG, MS, DS)                                                \
-        cleis_ld(W(XG), W(MS), W(DS))
+#define rdhxx_40(op, XD)                                                    \
+        rdhxx_fx(op, W(XD), 40)                                             \
+        rdhxx_20(op, W(XD))
 
-#define cleos3rr(XD, XS, XT)                                                \
-        cleis3rr(W(XD), W(XS), W(XT))
+#define rdhxx_80(op, XD)                                                    \
+        rdhxx_fx(op, W(XD), 80)                                             \
+        rdhxx_40(op, W(XD))
 
-#define cleos3ld(XD, XS, MT, DT)                                            \
-        cleis3ld(W(XD), W(XS), W(MT), W(DT))
+/*************   packed single-precision horizontal reductions   **************/
 
-/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+#ifndef adhos_rr
 
-#define cgtos_rr(XG, XS)                                                    \
-        cgtis_rr(W(XG), W(XS))
+#ifdef shfox3ri
 
-#define cgtos_ld(XG, MS, DS)                                                \
-        cgtis_ld(W(XG), W(MS), W(DS))
+#define rdhos_xx(op, XD)                                                    \
+        rdhxx_xx(op##os, W(XD))                                             \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfox_ri(W(XD), IB(0x4E))                                           \
+        op##os_ld(W(XD), Mebp, inf_SCR01(0))                                \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfox_ri(W(XD), IB(0xB1))                                           \
+        op##os_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cgtos3rr(XD, XS, XT)                                                \
-        cgtis3rr(W(XD), W(XS), W(XT))
+#else /* shfox3ri */
 
-#define cgtos3ld(XD, XS, MT, DT)                                            \
-        cgtis3ld(W(XD), W(XS), W(MT), W(DT))
+#define rdhos_xx(op, XD)                                                    \
+        rdhxx_xx(op##os, W(XD))                                             \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        op##rs_ld(W(XD), Mebp, inf_SCR01(0x04))                             \
+        op##rs_ld(W(XD), Mebp, inf_SCR01(0x08))                             \
+        op##rs_ld(W(XD), Mebp, inf_SCR01(0x0C))
 
-/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+#endif /* shfox3ri */
 
-#define cgeos_rr(XG, XS)                                                    \
-        cgeis_rr(W(XG), W(XS))
+/* adh (D = S[0] + S[1] + ... + S[n]), result in lowest element of D */
 
-#define cgeos_ld(XG, MS, DS)                                                \
-        cgeis_ld(W(XG), W(MS), W(DS))
+#define adhos_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        rdhos_xx(add, W(XD))
 
-#define cgeos3rr(XD, XS, XT)                                                \
-        cgeis3rr(W(XD), W(XS), W(XT))
+#define adhos_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        rdhos_xx(add, W(XD))
 
-#define cgeos3ld(XD, XS, MT, DT)                                            \
-        cgeis3ld(W(XD), W(XS), W(MT), W(DT))
+/* mnh (D = min(S[0], S[1], ..., S[n])), result in lowest element of D */
 
-/* mkj (jump to lb) if (S satisfies mask condition) */
+#define mnhos_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        rdhos_xx(min, W(XD))
 
-#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        mkjix_rx(W(XS), mask, lb)
+#define mnhos_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        rdhos_xx(min, W(XD))
 
-/*************   packed single-precision floating-point convert   *************/
+/* mxh (D = max(S[0], S[1], ..., S[n])), result in lowest element of D */
 
-/* cvz (D = fp-to-signed-int S)
- * rounding mode is encoded directly (can be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define mxhos_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        rdhos_xx(max, W(XD))
 
-#define rnzos_rr(XD, XS)     /* round towards zero */                       \
-        rnzis_rr(W(XD), W(XS))
+#define mxhos_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        rdhos_xx(max, W(XD))
 
-#define rnzos_ld(XD, MS, DS) /* round towards zero */                       \
-        rnzis_ld(W(XD), W(MS), W(DS))
+#endif /* adhos_rr */
 
-#define cvzos_rr(XD, XS)     /* round towards zero */                       \
-        cvzis_rr(W(XD), W(XS))
+/*************   packed double-precision horizontal reductions   **************/
 
-#define cvzos_ld(XD, MS, DS) /* round towards zero */                       \
-        cvzis_ld(W(XD), W(MS), W(DS))
+#ifndef adhqs_rr
 
-/* cvp (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#ifdef shfqx3ri
 
-#define rnpos_rr(XD, XS)     /* round towards +inf */                       \
-        rnpis_rr(W(XD), W(XS))
+#define rdhqs_xx(op, XD)                                                    \
+        rdhxx_xx(op##qs, W(XD))                                             \
+        movqx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfqx_ri(W(XD), IB(0x01))                                           \
+        op##qs_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rnpos_ld(XD, MS, DS) /* round towards +inf */                       \
-        rnpis_ld(W(XD), W(MS), W(DS))
+#else /* shfqx3ri */
 
-#define cvpos_rr(XD, XS)     /* round towards +inf */                       \
-        cvpis_rr(W(XD), W(XS))
+#define rdhqs_xx(op, XD)                                                    \
+        rdhxx_xx(op##qs, W(XD))                                             \
+        movqx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        op##ts_ld(W(XD), Mebp, inf_SCR01(0x08))
 
-#define cvpos_ld(XD, MS, DS) /* round towards +inf */                       \
-        cvpis_ld(W(XD), W(MS), W(DS))
+#endif /* shfqx3ri */
 
-/* cvm (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+/* adh (D = S[0] + S[1] + ... + S[n]), result in lowest element of D */
 
-#define rnmos_rr(XD, XS)     /* round towards -inf */                       \
-        rnmis_rr(W(XD), W(XS))
+#define adhqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        rdhqs_xx(add, W(XD))
 
-#define rnmos_ld(XD, MS, DS) /* round towards -inf */                       \
-        rnmis_ld(W(XD), W(MS), W(DS))
+#define adhqs_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        rdhqs_xx(add, W(XD))
 
-#define cvmos_rr(XD, XS)     /* round towards -inf */                       \
-        cvmis_rr(W(XD), W(XS))
+/* mnh (D = min(S[0], S[1], ..., S[n])), result in lowest element of D */
 
-#define cvmos_ld(XD, MS, DS) /* round towards -inf */                       \
-        cvmis_ld(W(XD), W(MS), W(DS))
+#define mnhqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        rdhqs_xx(min, W(XD))
 
-/* cvn (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define mnhqs_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        rdhqs_xx(min, W(XD))
 
-#define rnnos_rr(XD, XS)     /* round towards near */                       \
-        rnnis_rr(W(XD), W(XS))
+/* mxh (D = max(S[0], S[1], ..., S[n])), result in lowest element of D */
 
-#define rnnos_ld(XD, MS, DS) /* round towards near */                       \
-        rnnis_ld(W(XD), W(MS), W(DS))
+#define mxhqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        rdhqs_xx(max, W(XD))
 
-#define cvnos_rr(XD, XS)     /* round towards near */                       \
-        cvnis_rr(W(XD), W(XS))
+#define mxhqs_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        rdhqs_xx(max, W(XD))
 
-#define cvnos_ld(XD, MS, DS) /* round towards near */                       \
-        cvnis_ld(W(XD), W(MS), W(DS))
+#endif /* adhqs_rr */
 
-/* cvn (D = signed-int-to-fp S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+/******************************************************************************/
+/**** var-len **** SIMD gather/scatter with index vectors ********************/
+/******************************************************************************/
 
-#define cvnon_rr(XD, XS)     /* round towards near */                       \
-        cvnin_rr(W(XD), W(XS))
+/*
+ * Gather loads elements from non-contiguous addresses [RB + I[i] * elem-size]
+ * into D[i], scatter stores S[i] into [RB + I[i] * elem-size] in turn, where
+ * RB is a BASE register holding the address and XI is a SIMD register with
+ * element-sized indices, which are required to be in range [0, 2^31 - 1].
+ * Scatter to repeating indices leaves the highest element in memory.
+ * Generic element-wise versions below use scratch areas inf_SCR01/inf_SCR02
+ * and Reax, targets with native gather/scatter define their own: AVX2 gather
+ * uses Xmm0 as a mask register, AVX-512 uses mask register k1 instead.
+ * Portable code must assume both Xmm0 and Reax are destroyed,
+ * therefore XD, XS, XI cannot be Xmm0, RB cannot be Reax and (#D != #I).
+ */
 
-#define cvnon_ld(XD, MS, DS) /* round towards near */                       \
-        cvnin_ld(W(XD), W(MS), W(DS))
+/* internal helpers (not for direct use in code) */
+
+#define gatrx_cx(XD, RB, dp)                                                \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x00))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XD), Oeax, PLAIN)                                        \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x00))                           \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x04))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XD), Oeax, PLAIN)                                        \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x04))                           \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x08))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XD), Oeax, PLAIN)                                        \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x0C))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XD), Oeax, PLAIN)                                        \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x0C))
+
+#define sctrx_cx(XS, RB, dp)                                                \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x00))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XS), Mebp, inf_SCR01(dp+0x00))                           \
+        movrs_st(W(XS), Oeax, PLAIN)                                        \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x04))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XS), Mebp, inf_SCR01(dp+0x04))                           \
+        movrs_st(W(XS), Oeax, PLAIN)                                        \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x08))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XS), Mebp, inf_SCR01(dp+0x08))                           \
+        movrs_st(W(XS), Oeax, PLAIN)                                        \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x0C))                            \
+        shlxx_ri(Reax, IB(2))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movrs_ld(W(XS), Mebp, inf_SCR01(dp+0x0C))                           \
+        movrs_st(W(XS), Oeax, PLAIN)
+
+#define gattx_cx(XD, RB, dp)                                                \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x00+B))                          \
+        shlxx_ri(Reax, IB(3))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movts_ld(W(XD), Oeax, PLAIN)                                        \
+        movts_st(W(XD), Mebp, inf_SCR01(dp+0x00))                           \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x08+B))                          \
+        shlxx_ri(Reax, IB(3))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movts_ld(W(XD), Oeax, PLAIN)                                        \
+        movts_st(W(XD), Mebp, inf_SCR01(dp+0x08))
+
+#define scttx_cx(XS, RB, dp)                                                \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x00+B))                          \
+        shlxx_ri(Reax, IB(3))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movts_ld(W(XS), Mebp, inf_SCR01(dp+0x00))                           \
+        movts_st(W(XS), Oeax, PLAIN)                                        \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp+0x08+B))                          \
+        shlxx_ri(Reax, IB(3))                                               \
+        addxx_rr(Reax, W(RB))                                               \
+        movts_ld(W(XS), Mebp, inf_SCR01(dp+0x08))                           \
+        movts_st(W(XS), Oeax, PLAIN)
+
+/* gsc (run cx for each 128-bit chunk of the SCR01/SCR02 areas, lowest first) */
+
+#define gscxx_xx(cx, XR, RB)                                                \
+        chnxx_up(chnxx_r2, cx, W(XR), W(RB))
+
+/*****************   packed single-precision gather/scatter   *****************/
+
+/* gat (D[i] = [RB + I[i] * 4]) if (#D != #I)
+ * destroys Reax (scratch) */
+
+#ifndef gatox_ld
+
+#define gatox_ld(XD, RB, XI)                                                \
+        movox_st(W(XI), Mebp, inf_SCR02(0))                                 \
+        gscxx_xx(gatrx_cx, W(XD), W(RB))                                    \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#endif /* gatox_ld */
+
+/* sct ([RB + I[i] * 4] = S[i])
+ * destroys Reax (scratch) */
+
+#ifndef sctox_st
+
+#define sctox_st(XS, RB, XI)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XI), Mebp, inf_SCR02(0))                                 \
+        gscxx_xx(sctrx_cx, W(XS), W(RB))                                    \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))
 
-/* cvt (D = fp-to-signed-int S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#endif /* sctox_st */
 
-#define rndos_rr(XD, XS)                                                    \
-        rndis_rr(W(XD), W(XS))
+/*****************   packed double-precision gather/scatter   *****************/
 
-#define rndos_ld(XD, MS, DS)                                                \
-        rndis_ld(W(XD), W(MS), W(DS))
+/* gat (D[i] = [RB + I[i] * 8]) if (#D != #I)
+ * destroys Reax (scratch) */
 
-#define cvtos_rr(XD, XS)                                                    \
-        cvtis_rr(W(XD), W(XS))
+#ifndef gatqx_ld
 
-#define cvtos_ld(XD, MS, DS)                                                \
-        cvtis_ld(W(XD), W(MS), W(DS))
+#define gatqx_ld(XD, RB, XI)                                                \
+        movqx_st(W(XI), Mebp, inf_SCR02(0))                                 \
+        gscxx_xx(gattx_cx, W(XD), W(RB))                                    \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* cvt (D = signed-int-to-fp S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+#endif /* gatqx_ld */
 
-#define cvton_rr(XD, XS)                                                    \
-        cvtin_rr(W(XD), W(XS))
+/* sct ([RB + I[i] * 8] = S[i])
+ * destroys Reax (scratch) */
 
-#define cvton_ld(XD, MS, DS)                                                \
-        cvtin_ld(W(XD), W(MS), W(DS))
+#ifndef sctqx_st
 
-/* cvr (D = fp-to-signed-int S)
- * rounding mode is encoded directly (cannot be used in FCTRL blocks)
- * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
- * isn't always taken into account when used within full-IEEE ASM block
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define sctqx_st(XS, RB, XI)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XI), Mebp, inf_SCR02(0))                                 \
+        gscxx_xx(scttx_cx, W(XS), W(RB))                                    \
+        movqx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#define rnros_rr(XD, XS, mode)                                              \
-        rnris_rr(W(XD), W(XS), mode)
+#endif /* sctqx_st */
 
-#define cvros_rr(XD, XS, mode)                                              \
-        cvris_rr(W(XD), W(XS), mode)
+/******************************************************************************/
+/**** var-len **** SIMD integer multiply (low and high half of the product) ***/
+/******************************************************************************/
 
-/************   packed single-precision integer arithmetic/shifts   ***********/
+/*
+ * Integer multiply keeps either the low half (mul) or the high half (mhi)
+ * of the double-width product in each element, the low half is the same for
+ * signed and unsigned args, the high half is computed as unsigned (x) or
+ * signed (n). Targets with native low-half multiply (SSE4, AVX/AVX2, AVX-512,
+ * NEON, MSA, VSX2) define their own, elsewhere (as well as for the high half)
+ * generic element-wise versions below use inf_SCR01/inf_SCR02 and Reax/Redx
+ * with Redx preserved on the stack. 64-bit elements use 64-bit BASE multiply
+ * available on 64-bit hosts (x64, a64, m64, p64 including 32-bit ABIs).
+ */
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+/* internal helpers (not for direct use in code) */
+
+#define mulrx_cx(op, dp)                                                    \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        op##_ld(Reax, Mebp, inf_SCR02(dp+0x00))                             \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        op##_ld(Reax, Mebp, inf_SCR02(dp+0x04))                             \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        op##_ld(Reax, Mebp, inf_SCR02(dp+0x08))                             \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x0C))                            \
+        op##_ld(Reax, Mebp, inf_SCR02(dp+0x0C))                             \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x0C))
+
+#define mhirx_cx(op, dp)                                                    \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        op##_xm(Mebp, inf_SCR02(dp+0x00))                                   \
+        movwx_st(Redx, Mebp, inf_SCR01(dp+0x00))                            \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        op##_xm(Mebp, inf_SCR02(dp+0x04))                                   \
+        movwx_st(Redx, Mebp, inf_SCR01(dp+0x04))                            \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        op##_xm(Mebp, inf_SCR02(dp+0x08))                                   \
+        movwx_st(Redx, Mebp, inf_SCR01(dp+0x08))                            \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x0C))                            \
+        op##_xm(Mebp, inf_SCR02(dp+0x0C))                                   \
+        movwx_st(Redx, Mebp, inf_SCR01(dp+0x0C))
+
+#define multx_cx(op, dp)                                                    \
+        movzx_ld(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        op##_ld(Reax, Mebp, inf_SCR02(dp+0x00))                             \
+        movzx_st(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        movzx_ld(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        op##_ld(Reax, Mebp, inf_SCR02(dp+0x08))                             \
+        movzx_st(Reax, Mebp, inf_SCR01(dp+0x08))
+
+#define mhitx_cx(op, dp)                                                    \
+        movzx_ld(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        op##_xm(Mebp, inf_SCR02(dp+0x00))                                   \
+        movzx_st(Redx, Mebp, inf_SCR01(dp+0x00))                            \
+        movzx_ld(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        op##_xm(Mebp, inf_SCR02(dp+0x08))                                   \
+        movzx_st(Redx, Mebp, inf_SCR01(dp+0x08))
+
+/* elm (run cx for each 128-bit chunk of the SCR01/SCR02 areas, lowest first) */
+
+#define elmxx_xx(cx, op)                                                    \
+        chnxx_up(chnxx_a1, cx, W(op, EMPTY, EMPTY), W(EMPTY, EMPTY, EMPTY))
+
+/***************   packed 32-bit integer multiply (low/high)   ****************/
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product
+ * destroys Reax (scratch) */
+
+#ifndef mulox_rr
+
+#define mulox_rr(XG, XS)                                                    \
+        mulox3rr(W(XG), W(XG), W(XS))
+
+#define mulox_ld(XG, MS, DS)                                                \
+        mulox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        elmxx_xx(mulrx_cx, mulwx)                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define addox_rr(XG, XS)                                                    \
-        addix_rr(W(XG), W(XS))
+#define mulox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        elmxx_xx(mulrx_cx, mulwx)                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define addox_ld(XG, MS, DS)                                                \
-        addix_ld(W(XG), W(MS), W(DS))
+#endif /* mulox_rr */
 
-#define addox3rr(XD, XS, XT)                                                \
-        addix3rr(W(XD), W(XS), W(XT))
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, unsigned
+ * destroys Reax (scratch) */
 
-#define addox3ld(XD, XS, MT, DT)                                            \
-        addix3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef mhiox_rr
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+#define mhiox_rr(XG, XS)                                                    \
+        mhiox3rr(W(XG), W(XG), W(XS))
 
-#define subox_rr(XG, XS)                                                    \
-        subix_rr(W(XG), W(XS))
+#define mhiox_ld(XG, MS, DS)                                                \
+        mhiox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define subox_ld(XG, MS, DS)                                                \
-        subix_ld(W(XG), W(MS), W(DS))
+#define mhiox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhirx_cx, mulwx)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define subox3rr(XD, XS, XT)                                                \
-        subix3rr(W(XD), W(XS), W(XT))
+#define mhiox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhirx_cx, mulwx)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define subox3ld(XD, XS, MT, DT)                                            \
-        subix3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* mhiox_rr */
 
-/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, signed
+ * destroys Reax (scratch) */
 
-#define shlox_ri(XG, IS)                                                    \
-        shlix_ri(W(XG), W(IS))
+#ifndef mhion_rr
 
-#define shlox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shlix_ld(W(XG), W(MS), W(DS))
+#define mhion_rr(XG, XS)                                                    \
+        mhion3rr(W(XG), W(XG), W(XS))
 
-#define shlox3ri(XD, XS, IT)                                                \
-        shlix3ri(W(XD), W(XS), W(IT))
+#define mhion_ld(XG, MS, DS)                                                \
+        mhion3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define shlox3ld(XD, XS, MT, DT)                                            \
-        shlix3ld(W(XD), W(XS), W(MT), W(DT))
+#define mhion3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhirx_cx, mulwn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define mhion3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhirx_cx, mulwn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define shrox_ri(XG, IS)                                                    \
-        shrix_ri(W(XG), W(IS))
+#endif /* mhion_rr */
 
-#define shrox_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrix_ld(W(XG), W(MS), W(DS))
+/***************   packed 64-bit integer multiply (low/high)   ****************/
 
-#define shrox3ri(XD, XS, IT)                                                \
-        shrix3ri(W(XD), W(XS), W(IT))
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product
+ * destroys Reax (scratch) */
 
-#define shrox3ld(XD, XS, MT, DT)                                            \
-        shrix3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef mulqx_rr
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define mulqx_rr(XG, XS)                                                    \
+        mulqx3rr(W(XG), W(XG), W(XS))
 
-#define shron_ri(XG, IS)                                                    \
-        shrin_ri(W(XG), W(IS))
+#define mulqx_ld(XG, MS, DS)                                                \
+        mulqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define shron_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrin_ld(W(XG), W(MS), W(DS))
+#define mulqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        elmxx_xx(multx_cx, mulzx)                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define shron3ri(XD, XS, IT)                                                \
-        shrin3ri(W(XD), W(XS), W(IT))
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        elmxx_xx(multx_cx, mulzx)                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define shron3ld(XD, XS, MT, DT)                                            \
-        shrin3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* mulqx_rr */
 
-/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, unsigned
+ * destroys Reax (scratch) */
 
-#define svlox_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svlix_rr(W(XG), W(XS))
+#ifndef mhiqx_rr
 
-#define svlox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svlix_ld(W(XG), W(MS), W(DS))
+#define mhiqx_rr(XG, XS)                                                    \
+        mhiqx3rr(W(XG), W(XG), W(XS))
 
-#define svlox3rr(XD, XS, XT)                                                \
-        svlix3rr(W(XD), W(XS), W(XT))
+#define mhiqx_ld(XG, MS, DS)                                                \
+        mhiqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define svlox3ld(XD, XS, MT, DT)                                            \
-        svlix3ld(W(XD), W(XS), W(MT), W(DT))
+#define mhiqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhitx_cx, mulzx)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define mhiqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhitx_cx, mulzx)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define svrox_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrix_rr(W(XG), W(XS))
+#endif /* mhiqx_rr */
 
-#define svrox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrix_ld(W(XG), W(MS), W(DS))
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, signed
+ * destroys Reax (scratch) */
 
-#define svrox3rr(XD, XS, XT)                                                \
-        svrix3rr(W(XD), W(XS), W(XT))
+#ifndef mhiqn_rr
 
-#define svrox3ld(XD, XS, MT, DT)                                            \
-        svrix3ld(W(XD), W(XS), W(MT), W(DT))
+#define mhiqn_rr(XG, XS)                                                    \
+        mhiqn3rr(W(XG), W(XG), W(XS))
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define mhiqn_ld(XG, MS, DS)                                                \
+        mhiqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define svron_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrin_rr(W(XG), W(XS))
+#define mhiqn3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhitx_cx, mulzn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define svron_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrin_ld(W(XG), W(MS), W(DS))
+#define mhiqn3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(mhitx_cx, mulzn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define svron3rr(XD, XS, XT)                                                \
-        svrin3rr(W(XD), W(XS), W(XT))
+#endif /* mhiqn_rr */
 
-#define svron3ld(XD, XS, MT, DT)                                            \
-        svrin3ld(W(XD), W(XS), W(MT), W(DT))
+/******************************************************************************/
+/**** var-len **** SIMD integer compare-to-mask, min/max and abs **************/
+/******************************************************************************/
 
 /*
- * common 128-bit floating-point SIMD instructions with 32-bit elements
+ * Integer compares set elements to all-ones (-1) where the condition holds
+ * and to zeros elsewhere, just like their fp counterparts. Ordered compares
+ * and min/max come in unsigned (x) and signed (n) versions, ceq/cne don't
+ * depend on signedness, abs is signed (minimum negative value is unchanged).
+ * Targets define the ones they have instructions for, the rest is derived
+ * below from ceq and signed cgt/min/max using inf_SCR01/inf_SCR02: clt swaps
+ * args of cgt, cne/cle/cge invert the result, unsigned compares flip the
+ * sign-bit of both args (as do unsigned min/max around signed ones). Where
+ * ceq, signed cgt/min/max or abs aren't available, generic element-wise
+ * versions operate in BASE, they destroy Reax (scratch) and keep Redx on
+ * the stack, same as integer multiply (abs always goes there, as its
+ * sign-mask sequence would have to keep the source in scratch across
+ * emulated shifts).
  */
 
-/* cbr (D = cbrt S) */
+/* internal helpers (not for direct use in code) */
+
+#define cmprx_cx(op, dp)                                                    \
+        op##_xx(dp+0x00)                                                    \
+        op##_xx(dp+0x04)                                                    \
+        op##_xx(dp+0x08)                                                    \
+        op##_xx(dp+0x0C)
+
+#define cmptx_cx(op, dp)                                                    \
+        op##_xx(dp+0x00)                                                    \
+        op##_xx(dp+0x08)
+
+#define ceqrx_xx(dp)                                                        \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        xorwx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        movwx_rr(Redx, Reax)                                                \
+        negwx_rx(Redx)                                                      \
+        orrwx_rr(Reax, Redx)                                                \
+        shrwn_ri(Reax, IB(31))                                              \
+        notwx_rx(Reax)                                                      \
+        movwx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define mskrn_xx(dp)                                                        \
+        movwx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        xorwx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        movwx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        subwx_ld(Redx, Mebp, inf_SCR01(dp))                                 \
+        xorwx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        andwx_rr(Reax, Redx)                                                \
+        xorwx_rr(Reax, Redx)                                                \
+        xorwx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        shrwn_ri(Reax, IB(31))
+
+#define cgtrn_xx(dp)                                                        \
+        mskrn_xx(dp)                                                        \
+        movwx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define minrn_xx(dp)                                                        \
+        mskrn_xx(dp)                                                        \
+        movwx_ld(Redx, Mebp, inf_SCR01(dp))                                 \
+        xorwx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        andwx_rr(Reax, Redx)                                                \
+        xorwx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        movwx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define maxrn_xx(dp)                                                        \
+        mskrn_xx(dp)                                                        \
+        movwx_ld(Redx, Mebp, inf_SCR01(dp))                                 \
+        xorwx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        andwx_rr(Reax, Redx)                                                \
+        xorwx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        movwx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define absrn_xx(dp)                                                        \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        movwx_rr(Redx, Reax)                                                \
+        shrwn_ri(Redx, IB(31))                                              \
+        xorwx_rr(Reax, Redx)                                                \
+        subwx_rr(Reax, Redx)                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define ceqtx_xx(dp)                                                        \
+        movzx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        xorzx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        movzx_rr(Redx, Reax)                                                \
+        negzx_rx(Redx)                                                      \
+        orrzx_rr(Reax, Redx)                                                \
+        shrzn_ri(Reax, IB(63))                                              \
+        notzx_rx(Reax)                                                      \
+        movzx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define msktn_xx(dp)                                                        \
+        movzx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        xorzx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        movzx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        subzx_ld(Redx, Mebp, inf_SCR01(dp))                                 \
+        xorzx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        andzx_rr(Reax, Redx)                                                \
+        xorzx_rr(Reax, Redx)                                                \
+        xorzx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        shrzn_ri(Reax, IB(63))
+
+#define cgttn_xx(dp)                                                        \
+        msktn_xx(dp)                                                        \
+        movzx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define mintn_xx(dp)                                                        \
+        msktn_xx(dp)                                                        \
+        movzx_ld(Redx, Mebp, inf_SCR01(dp))                                 \
+        xorzx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        andzx_rr(Reax, Redx)                                                \
+        xorzx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        movzx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define maxtn_xx(dp)                                                        \
+        msktn_xx(dp)                                                        \
+        movzx_ld(Redx, Mebp, inf_SCR01(dp))                                 \
+        xorzx_ld(Redx, Mebp, inf_SCR02(dp))                                 \
+        andzx_rr(Reax, Redx)                                                \
+        xorzx_ld(Reax, Mebp, inf_SCR02(dp))                                 \
+        movzx_st(Reax, Mebp, inf_SCR01(dp))
+
+#define abstn_xx(dp)                                                        \
+        movzx_ld(Reax, Mebp, inf_SCR01(dp))                                 \
+        movzx_rr(Redx, Reax)                                                \
+        shrzn_ri(Redx, IB(63))                                              \
+        xorzx_rr(Reax, Redx)                                                \
+        subzx_rr(Reax, Redx)                                                \
+        movzx_st(Reax, Mebp, inf_SCR01(dp))
+
+/*************   packed 32-bit integer compare, min/max and abs   *************/
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) */
+
+#ifndef ceqox_rr
+
+#define ceqox_rr(XG, XS)                                                    \
+        ceqox3rr(W(XG), W(XG), W(XS))
+
+#define ceqox_ld(XG, MS, DS)                                                \
+        ceqox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, ceqrx)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-/*
- * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
- * available at http://www.musicdsp.org/showone.php?id=206
- * converted to S-way SIMD version by VectorChief.
- */
-#define cbris_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbeis_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsis_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsis_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsis_rr(W(XD), W(X1), W(X2), W(XS))
+#define ceqox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, ceqrx)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cbeis_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        /* cube root estimate, the exponent is divided by three             \
-         * in such a way that remainder bits get shoved into                \
-         * the top of the normalized mantissa */                            \
-        movix_ld(W(X2), Mebp, inf_GPC04_32)                                 \
-        movix_rr(W(XD), W(XS))                                              \
-        andix_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
-        subix_ld(W(XD), Mebp, inf_GPC05_32) /* convert to 2's complement */ \
-        shrin_ri(W(XD), IB(10))  /* XD / 1024 */                            \
-        movix_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
-        shlix_ri(W(X1), IB(2))                                              \
-        addix_rr(W(XD), W(X1))                                              \
-        shlix_ri(W(X1), IB(2))                                              \
-        addix_rr(W(XD), W(X1))                                              \
-        shlix_ri(W(X1), IB(2))                                              \
-        addix_rr(W(XD), W(X1))                                              \
-        shlix_ri(W(X1), IB(2))                                              \
-        addix_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
-        addix_ld(W(XD), Mebp, inf_GPC05_32) /* back to biased-127 */        \
-        andix_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
-        annix_rr(W(X2), W(XS))   /* original sign */                        \
-        orrix_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+#endif /* ceqox_rr */
 
-#define cbsis_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        movix_rr(W(X1), W(XG))                                              \
-        mulis_rr(W(X1), W(XG))                                              \
-        movix_rr(W(X2), W(X1))                                              \
-        mulis_ld(W(X1), Mebp, inf_GPC03_32)                                 \
-        rceis_rr(W(X1), W(X1))                                              \
-        mulis_rr(W(X2), W(XG))                                              \
-        subis_rr(W(X2), W(XS))                                              \
-        mulis_rr(W(X2), W(X1))                                              \
-        subis_rr(W(XG), W(X2))
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) */
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#ifndef cgton_rr
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#define cgton_rr(XG, XS)                                                    \
+        cgton3rr(W(XG), W(XG), W(XS))
 
-#define rcpis_rr(XD, XS) /* destroys XS */                                  \
-        rceis_rr(W(XD), W(XS))                                              \
-        rcsis_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define cgton_ld(XG, MS, DS)                                                \
+        cgton3ld(W(XG), W(XG), W(MS), W(DS))
 
-#elif RT_SIMD_COMPAT_RCP == 1
+#define cgton3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, cgtrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rcpis_rr(XD, XS) /* destroys XS */                                  \
-        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divis_rr(W(XD), W(XS))
+#define cgton3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, cgtrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rceis_rr(XD, XS)                                                    \
-        movix_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divis_ld(W(XD), Mebp, inf_SCR02(0))
+#endif /* cgton_rr */
 
-#define rcsis_rr(XG, XS) /* destroys XS */
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) where emulated */
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#ifndef cneox_rr
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cneox_rr(XG, XS)                                                    \
+        cneox3rr(W(XG), W(XG), W(XS))
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#define cneox_ld(XG, MS, DS)                                                \
+        cneox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define rsqis_rr(XD, XS) /* destroys XS */                                  \
-        rseis_rr(W(XD), W(XS))                                              \
-        rssis_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define cneox3rr(XD, XS, XT)                                                \
+        ceqox3rr(W(XD), W(XS), W(XT))                                       \
+        notox_rx(W(XD))
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define cneox3ld(XD, XS, MT, DT)                                            \
+        ceqox3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notox_rx(W(XD))
 
-#define rsqis_rr(XD, XS) /* destroys XS */                                  \
-        sqris_rr(W(XS), W(XS))                                              \
-        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divis_rr(W(XD), W(XS))
+#endif /* cneox_rr */
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#ifndef clton_rr
+
+#define clton_rr(XG, XS)                                                    \
+        clton3rr(W(XG), W(XG), W(XS))
 
-#define rseis_rr(XD, XS)                                                    \
-        sqris_rr(W(XD), W(XS))                                              \
-        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movix_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divis_ld(W(XD), Mebp, inf_SCR02(0))
+#define clton_ld(XG, MS, DS)                                                \
+        clton3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define rssis_rr(XG, XS) /* destroys XS */
+#define clton3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_rr(W(XD), W(XT))                                              \
+        cgton_ld(W(XD), Mebp, inf_SCR02(0))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#define clton3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        cgton_ld(W(XD), Mebp, inf_SCR02(0))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#endif /* clton_rr */
 
-#if RT_SIMD_COMPAT_FMA == 2
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
 
-#define fmais_rr(XG, XS, XT)                                                \
-        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulis_rr(W(XS), W(XT))                                              \
-        addis_rr(W(XG), W(XS))                                              \
-        movix_ld(W(XS), Mebp, inf_SCR01(0))
+#ifndef cleon_rr
 
-#define fmais_ld(XG, XS, MT, DT)                                            \
-        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulis_ld(W(XS), W(MT), W(DT))                                       \
-        addis_rr(W(XG), W(XS))                                              \
-        movix_ld(W(XS), Mebp, inf_SCR01(0))
+#define cleon_rr(XG, XS)                                                    \
+        cleon3rr(W(XG), W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define cleon_ld(XG, MS, DS)                                                \
+        cleon3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define cleon3rr(XD, XS, XT)                                                \
+        cgton3rr(W(XD), W(XS), W(XT))                                       \
+        notox_rx(W(XD))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#define cleon3ld(XD, XS, MT, DT)                                            \
+        cgton3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notox_rx(W(XD))
 
-#define fmsis_rr(XG, XS, XT)                                                \
-        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulis_rr(W(XS), W(XT))                                              \
-        subis_rr(W(XG), W(XS))                                              \
-        movix_ld(W(XS), Mebp, inf_SCR01(0))
+#endif /* cleon_rr */
 
-#define fmsis_ld(XG, XS, MT, DT)                                            \
-        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulis_ld(W(XS), W(MT), W(DT))                                       \
-        subis_rr(W(XG), W(XS))                                              \
-        movix_ld(W(XS), Mebp, inf_SCR01(0))
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#ifndef cgeon_rr
 
-#endif /* RT_SIMD: 512, 256, 128 */
+#define cgeon_rr(XG, XS)                                                    \
+        cgeon3rr(W(XG), W(XG), W(XS))
 
-/******************************************************************************/
-/**** scalar ***** SIMD instructions with fixed-32-bit-element ****************/
-/******************************************************************************/
+#define cgeon_ld(XG, MS, DS)                                                \
+        cgeon3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cgeon3rr(XD, XS, XT)                                                \
+        clton3rr(W(XD), W(XS), W(XT))                                       \
+        notox_rx(W(XD))
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#define cgeon3ld(XD, XS, MT, DT)                                            \
+        clton3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notox_rx(W(XD))
 
-#define rcprs_rr(XD, XS) /* destroys XS */                                  \
-        rcers_rr(W(XD), W(XS))                                              \
-        rcsrs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#endif /* cgeon_rr */
 
-#elif RT_SIMD_COMPAT_RCP == 1
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define rcprs_rr(XD, XS) /* destroys XS */                                  \
-        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divrs_rr(W(XD), W(XS))
+#ifndef cgtox_rr
 
-#define rcers_rr(XD, XS)                                                    \
-        movrs_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divrs_ld(W(XD), Mebp, inf_SCR02(0))
+#define cgtox_rr(XG, XS)                                                    \
+        cgtox3rr(W(XG), W(XG), W(XS))
 
-#define rcsrs_rr(XG, XS) /* destroys XS */
+#define cgtox_ld(XG, MS, DS)                                                \
+        cgtox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define cgtox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_rr(W(XD), W(XT))                                              \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        cgton_ld(W(XD), Mebp, inf_SCR02(0))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cgtox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        cgton_ld(W(XD), Mebp, inf_SCR02(0))
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#endif /* cgtox_rr */
 
-#define rsqrs_rr(XD, XS) /* destroys XS */                                  \
-        rsers_rr(W(XD), W(XS))                                              \
-        rssrs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#ifndef cltox_rr
 
-#define rsqrs_rr(XD, XS) /* destroys XS */                                  \
-        sqrrs_rr(W(XS), W(XS))                                              \
-        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divrs_rr(W(XD), W(XS))
+#define cltox_rr(XG, XS)                                                    \
+        cltox3rr(W(XG), W(XG), W(XS))
 
-#define rsers_rr(XD, XS)                                                    \
-        sqrrs_rr(W(XD), W(XS))                                              \
-        movrs_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movrs_ld(W(XD), Mebp, inf_GPC01_32)                                 \
-        divrs_ld(W(XD), Mebp, inf_SCR02(0))
+#define cltox_ld(XG, MS, DS)                                                \
+        cltox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define rssrs_rr(XG, XS) /* destroys XS */
+#define cltox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_rr(W(XD), W(XT))                                              \
+        cgtox_ld(W(XD), Mebp, inf_SCR02(0))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#define cltox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        cgtox_ld(W(XD), Mebp, inf_SCR02(0))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#endif /* cltox_rr */
 
-#if RT_SIMD_COMPAT_FMA == 2
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define fmars_rr(XG, XS, XT)                                                \
-        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulrs_rr(W(XS), W(XT))                                              \
-        addrs_rr(W(XG), W(XS))                                              \
-        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+#ifndef cleox_rr
 
-#define fmars_ld(XG, XS, MT, DT)                                            \
-        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulrs_ld(W(XS), W(MT), W(DT))                                       \
-        addrs_rr(W(XG), W(XS))                                              \
-        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+#define cleox_rr(XG, XS)                                                    \
+        cleox3rr(W(XG), W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define cleox_ld(XG, MS, DS)                                                \
+        cleox3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define cleox3rr(XD, XS, XT)                                                \
+        cgtox3rr(W(XD), W(XS), W(XT))                                       \
+        notox_rx(W(XD))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#define cleox3ld(XD, XS, MT, DT)                                            \
+        cgtox3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notox_rx(W(XD))
 
-#define fmsrs_rr(XG, XS, XT)                                                \
-        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulrs_rr(W(XS), W(XT))                                              \
-        subrs_rr(W(XG), W(XS))                                              \
-        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+#endif /* cleox_rr */
 
-#define fmsrs_ld(XG, XS, MT, DT)                                            \
-        movrs_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulrs_ld(W(XS), W(MT), W(DT))                                       \
-        subrs_rr(W(XG), W(XS))                                              \
-        movrs_ld(W(XS), Mebp, inf_SCR01(0))
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#ifndef cgeox_rr
 
-/******************************************************************************/
-/**** var-len **** SIMD instructions with fixed-64-bit-element **** 512-bit ***/
-/******************************************************************************/
+#define cgeox_rr(XG, XS)                                                    \
+        cgeox3rr(W(XG), W(XG), W(XS))
 
-#if   (RT_SIMD >= 512)
+#define cgeox_ld(XG, MS, DS)                                                \
+        cgeox3ld(W(XG), W(XG), W(MS), W(DS))
 
-/*
- * main block of var-len SIMD instructions is defined in 512/1K4/2K8-bit headers
- */
+#define cgeox3rr(XD, XS, XT)                                                \
+        cltox3rr(W(XD), W(XS), W(XT))                                       \
+        notox_rx(W(XD))
 
-/* cbr (D = cbrt S) */
+#define cgeox3ld(XD, XS, MT, DT)                                            \
+        cltox3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notox_rx(W(XD))
 
-/*
- * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
- * available at http://www.musicdsp.org/showone.php?id=206
- * converted to S-way SIMD version by VectorChief.
- */
-#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbeqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsqs_rr(W(XD), W(X1), W(X2), W(XS))
+#endif /* cgeox_rr */
 
-#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        /* cube root estimate, the exponent is divided by three             \
-         * in such a way that remainder bits get shoved into                \
-         * the top of the normalized mantissa */                            \
-        movqx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
-        movqx_rr(W(XD), W(XS))                                              \
-        andqx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
-        subqx_ld(W(XD), Mebp, inf_GPC05_64) /* convert to 2's complement */ \
-        shrqn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
-        movqx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
-        shlqx_ri(W(X1), IB(2))                                              \
-        addqx_rr(W(XD), W(X1))                                              \
-        shlqx_ri(W(X1), IB(2))                                              \
-        addqx_rr(W(XD), W(X1))                                              \
-        shlqx_ri(W(X1), IB(2))                                              \
-        addqx_rr(W(XD), W(X1))                                              \
-        shlqx_ri(W(X1), IB(2))                                              \
-        addqx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
-        addqx_ld(W(XD), Mebp, inf_GPC05_64) /* back to biased-127 */        \
-        andqx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
-        annqx_rr(W(X2), W(XS))   /* original sign */                        \
-        orrqx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) */
 
-#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        movqx_rr(W(X1), W(XG))                                              \
-        mulqs_rr(W(X1), W(XG))                                              \
-        movqx_rr(W(X2), W(X1))                                              \
-        mulqs_ld(W(X1), Mebp, inf_GPC03_64)                                 \
-        rceqs_rr(W(X1), W(X1))                                              \
-        mulqs_rr(W(X2), W(XG))                                              \
-        subqs_rr(W(X2), W(XS))                                              \
-        mulqs_rr(W(X2), W(X1))                                              \
-        subqs_rr(W(XG), W(X2))
+#ifndef minon_rr
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define minon_rr(XG, XS)                                                    \
+        minon3rr(W(XG), W(XG), W(XS))
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#define minon_ld(XG, MS, DS)                                                \
+        minon3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
-        rceqs_rr(W(XD), W(XS))                                              \
-        rcsqs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define minon3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, minrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_RCP == 1
+#define minon3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, minrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
-        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divqs_rr(W(XD), W(XS))
+#endif /* minon_rr */
 
-#define rceqs_rr(XD, XS)                                                    \
-        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divqs_ld(W(XD), Mebp, inf_SCR02(0))
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) */
 
-#define rcsqs_rr(XG, XS) /* destroys XS */
+#ifndef maxon_rr
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define maxon_rr(XG, XS)                                                    \
+        maxon3rr(W(XG), W(XG), W(XS))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define maxon_ld(XG, MS, DS)                                                \
+        maxon3ld(W(XG), W(XG), W(MS), W(DS))
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#define maxon3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, maxrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
-        rseqs_rr(W(XD), W(XS))                                              \
-        rssqs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define maxon3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, maxrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#endif /* maxon_rr */
 
-#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
-        sqrqs_rr(W(XS), W(XS))                                              \
-        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divqs_rr(W(XD), W(XS))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define rseqs_rr(XD, XS)                                                    \
-        sqrqs_rr(W(XD), W(XS))                                              \
-        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movqx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divqs_ld(W(XD), Mebp, inf_SCR02(0))
+#ifndef minox_rr
 
-#define rssqs_rr(XG, XS) /* destroys XS */
+#define minox_rr(XG, XS)                                                    \
+        minox3rr(W(XG), W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#define minox_ld(XG, MS, DS)                                                \
+        minox3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#define minox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_rr(W(XD), W(XT))                                              \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        minon_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)
 
-#if RT_SIMD_COMPAT_FMA == 2
+#define minox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        minon_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)
 
-#define fmaqs_rr(XG, XS, XT)                                                \
-        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulqs_rr(W(XS), W(XT))                                              \
-        addqs_rr(W(XG), W(XS))                                              \
-        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+#endif /* minox_rr */
 
-#define fmaqs_ld(XG, XS, MT, DT)                                            \
-        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulqs_ld(W(XS), W(MT), W(DT))                                       \
-        addqs_rr(W(XG), W(XS))                                              \
-        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#ifndef maxox_rr
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define maxox_rr(XG, XS)                                                    \
+        maxox3rr(W(XG), W(XG), W(XS))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#define maxox_ld(XG, MS, DS)                                                \
+        maxox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define fmsqs_rr(XG, XS, XT)                                                \
-        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulqs_rr(W(XS), W(XT))                                              \
-        subqs_rr(W(XG), W(XS))                                              \
-        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+#define maxox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_rr(W(XD), W(XT))                                              \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        maxon_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)
 
-#define fmsqs_ld(XG, XS, MT, DT)                                            \
-        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulqs_ld(W(XS), W(MT), W(DT))                                       \
-        subqs_rr(W(XG), W(XS))                                              \
-        movqx_ld(W(XS), Mebp, inf_SCR01(0))
+#define maxox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        maxon_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_GPC06_32)
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#endif /* maxox_rr */
 
-/******************************************************************************/
-/**** var-len **** SIMD instructions with fixed-64-bit-element **** 256-bit ***/
-/******************************************************************************/
+/* abs (G = |G|), (D = |S|) - signed
+ * destroys Reax (scratch) */
 
-#elif (RT_SIMD == 256)
+#ifndef abson_rr
 
-/***************   packed double-precision generic move/logic   ***************/
+#define abson_rx(XG)                                                        \
+        abson_rr(W(XG), W(XG))
 
-/* mov (D = S) */
+#define abson_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmprx_cx, absrn)                                           \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define movqx_rr(XD, XS)                                                    \
-        movdx_rr(W(XD), W(XS))
+#endif /* abson_rr */
 
-#define movqx_ld(XD, MS, DS)                                                \
-        movdx_ld(W(XD), W(MS), W(DS))
+/*************   packed 64-bit integer compare, min/max and abs   *************/
 
-#define movqx_st(XS, MD, DD)                                                \
-        movdx_st(W(XS), W(MD), W(DD))
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) */
 
-/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
- * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+#ifndef ceqqx_rr
 
-#define mmvqx_ld(XG, MS, DS)                                                \
-        mmvdx_ld(W(XG), W(MS), W(DS))
+#define ceqqx_rr(XG, XS)                                                    \
+        ceqqx3rr(W(XG), W(XG), W(XS))
 
-#define mmvqx_st(XS, MG, DG)                                                \
-        mmvdx_st(W(XS), W(MG), W(DG))
+#define ceqqx_ld(XG, MS, DS)                                                \
+        ceqqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* and (G = G & S), (D = S & T) if (#D != #S) */
+#define ceqqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, ceqtx)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define andqx_rr(XG, XS)                                                    \
-        anddx_rr(W(XG), W(XS))
+#define ceqqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, ceqtx)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define andqx_ld(XG, MS, DS)                                                \
-        anddx_ld(W(XG), W(MS), W(DS))
+#endif /* ceqqx_rr */
 
-#define andqx3rr(XD, XS, XT)                                                \
-        anddx3rr(W(XD), W(XS), W(XT))
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) */
 
-#define andqx3ld(XD, XS, MT, DT)                                            \
-        anddx3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef cgtqn_rr
 
-/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+#define cgtqn_rr(XG, XS)                                                    \
+        cgtqn3rr(W(XG), W(XG), W(XS))
 
-#define annqx_rr(XG, XS)                                                    \
-        anndx_rr(W(XG), W(XS))
+#define cgtqn_ld(XG, MS, DS)                                                \
+        cgtqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define annqx_ld(XG, MS, DS)                                                \
-        anndx_ld(W(XG), W(MS), W(DS))
+#define cgtqn3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, cgttn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define annqx3rr(XD, XS, XT)                                                \
-        anndx3rr(W(XD), W(XS), W(XT))
+#define cgtqn3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, cgttn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define annqx3ld(XD, XS, MT, DT)                                            \
-        anndx3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* cgtqn_rr */
 
-/* orr (G = G | S), (D = S | T) if (#D != #S) */
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) where emulated */
 
-#define orrqx_rr(XG, XS)                                                    \
-        orrdx_rr(W(XG), W(XS))
+#ifndef cneqx_rr
 
-#define orrqx_ld(XG, MS, DS)                                                \
-        orrdx_ld(W(XG), W(MS), W(DS))
+#define cneqx_rr(XG, XS)                                                    \
+        cneqx3rr(W(XG), W(XG), W(XS))
 
-#define orrqx3rr(XD, XS, XT)                                                \
-        orrdx3rr(W(XD), W(XS), W(XT))
+#define cneqx_ld(XG, MS, DS)                                                \
+        cneqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define orrqx3ld(XD, XS, MT, DT)                                            \
-        orrdx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cneqx3rr(XD, XS, XT)                                                \
+        ceqqx3rr(W(XD), W(XS), W(XT))                                       \
+        notqx_rx(W(XD))
 
-/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+#define cneqx3ld(XD, XS, MT, DT)                                            \
+        ceqqx3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notqx_rx(W(XD))
 
-#define ornqx_rr(XG, XS)                                                    \
-        orndx_rr(W(XG), W(XS))
+#endif /* cneqx_rr */
 
-#define ornqx_ld(XG, MS, DS)                                                \
-        orndx_ld(W(XG), W(MS), W(DS))
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
 
-#define ornqx3rr(XD, XS, XT)                                                \
-        orndx3rr(W(XD), W(XS), W(XT))
+#ifndef cltqn_rr
 
-#define ornqx3ld(XD, XS, MT, DT)                                            \
-        orndx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cltqn_rr(XG, XS)                                                    \
+        cltqn3rr(W(XG), W(XG), W(XS))
 
-/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+#define cltqn_ld(XG, MS, DS)                                                \
+        cltqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define xorqx_rr(XG, XS)                                                    \
-        xordx_rr(W(XG), W(XS))
+#define cltqn3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movqx_rr(W(XD), W(XT))                                              \
+        cgtqn_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define xorqx_ld(XG, MS, DS)                                                \
-        xordx_ld(W(XG), W(MS), W(DS))
+#define cltqn3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        cgtqn_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define xorqx3rr(XD, XS, XT)                                                \
-        xordx3rr(W(XD), W(XS), W(XT))
+#endif /* cltqn_rr */
 
-#define xorqx3ld(XD, XS, MT, DT)                                            \
-        xordx3ld(W(XD), W(XS), W(MT), W(DT))
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
 
-/* not (G = ~G), (D = ~S) */
+#ifndef cleqn_rr
 
-#define notqx_rx(XG)                                                        \
-        notdx_rx(W(XG))
+#define cleqn_rr(XG, XS)                                                    \
+        cleqn3rr(W(XG), W(XG), W(XS))
 
-#define notqx_rr(XD, XS)                                                    \
-        notdx_rr(W(XD), W(XS))
+#define cleqn_ld(XG, MS, DS)                                                \
+        cleqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-/************   packed double-precision floating-point arithmetic   ***********/
+#define cleqn3rr(XD, XS, XT)                                                \
+        cgtqn3rr(W(XD), W(XS), W(XT))                                       \
+        notqx_rx(W(XD))
 
-/* neg (G = -G), (D = -S) */
+#define cleqn3ld(XD, XS, MT, DT)                                            \
+        cgtqn3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notqx_rx(W(XD))
 
-#define negqs_rx(XG)                                                        \
-        negds_rx(W(XG))
+#endif /* cleqn_rr */
 
-#define negqs_rr(XD, XS)                                                    \
-        negds_rr(W(XD), W(XS))
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#ifndef cgeqn_rr
 
-#define addqs_rr(XG, XS)                                                    \
-        addds_rr(W(XG), W(XS))
+#define cgeqn_rr(XG, XS)                                                    \
+        cgeqn3rr(W(XG), W(XG), W(XS))
 
-#define addqs_ld(XG, MS, DS)                                                \
-        addds_ld(W(XG), W(MS), W(DS))
+#define cgeqn_ld(XG, MS, DS)                                                \
+        cgeqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define addqs3rr(XD, XS, XT)                                                \
-        addds3rr(W(XD), W(XS), W(XT))
+#define cgeqn3rr(XD, XS, XT)                                                \
+        cltqn3rr(W(XD), W(XS), W(XT))                                       \
+        notqx_rx(W(XD))
 
-#define addqs3ld(XD, XS, MT, DT)                                            \
-        addds3ld(W(XD), W(XS), W(MT), W(DT))
+#define cgeqn3ld(XD, XS, MT, DT)                                            \
+        cltqn3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notqx_rx(W(XD))
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+#endif /* cgeqn_rr */
 
-#define subqs_rr(XG, XS)                                                    \
-        subds_rr(W(XG), W(XS))
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define subqs_ld(XG, MS, DS)                                                \
-        subds_ld(W(XG), W(MS), W(DS))
+#ifndef cgtqx_rr
 
-#define subqs3rr(XD, XS, XT)                                                \
-        subds3rr(W(XD), W(XS), W(XT))
+#define cgtqx_rr(XG, XS)                                                    \
+        cgtqx3rr(W(XG), W(XG), W(XS))
 
-#define subqs3ld(XD, XS, MT, DT)                                            \
-        subds3ld(W(XD), W(XS), W(MT), W(DT))
+#define cgtqx_ld(XG, MS, DS)                                                \
+        cgtqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* mul (G = G * S), (D = S * T) if (#D != #S) */
+#define cgtqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_rr(W(XD), W(XT))                                              \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        cgtqn_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define mulqs_rr(XG, XS)                                                    \
-        mulds_rr(W(XG), W(XS))
+#define cgtqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        cgtqn_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define mulqs_ld(XG, MS, DS)                                                \
-        mulds_ld(W(XG), W(MS), W(DS))
+#endif /* cgtqx_rr */
 
-#define mulqs3rr(XD, XS, XT)                                                \
-        mulds3rr(W(XD), W(XS), W(XT))
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define mulqs3ld(XD, XS, MT, DT)                                            \
-        mulds3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef cltqx_rr
 
-/* div (G = G / S), (D = S / T) if (#D != #S) */
+#define cltqx_rr(XG, XS)                                                    \
+        cltqx3rr(W(XG), W(XG), W(XS))
 
-#define divqs_rr(XG, XS)                                                    \
-        divds_rr(W(XG), W(XS))
+#define cltqx_ld(XG, MS, DS)                                                \
+        cltqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define divqs_ld(XG, MS, DS)                                                \
-        divds_ld(W(XG), W(MS), W(DS))
+#define cltqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movqx_rr(W(XD), W(XT))                                              \
+        cgtqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define divqs3rr(XD, XS, XT)                                                \
-        divds3rr(W(XD), W(XS), W(XT))
+#define cltqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        cgtqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define divqs3ld(XD, XS, MT, DT)                                            \
-        divds3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* cltqx_rr */
 
-/* sqr (D = sqrt S) */
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define sqrqs_rr(XD, XS)                                                    \
-        sqrds_rr(W(XD), W(XS))
+#ifndef cleqx_rr
 
-#define sqrqs_ld(XD, MS, DS)                                                \
-        sqrds_ld(W(XD), W(MS), W(DS))
+#define cleqx_rr(XG, XS)                                                    \
+        cleqx3rr(W(XG), W(XG), W(XS))
 
-/* cbr (D = cbrt S) */
+#define cleqx_ld(XG, MS, DS)                                                \
+        cleqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbrds_rr(W(XD), W(X1), W(X2), W(XS))
+#define cleqx3rr(XD, XS, XT)                                                \
+        cgtqx3rr(W(XD), W(XS), W(XT))                                       \
+        notqx_rx(W(XD))
 
-#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbeds_rr(W(XD), W(X1), W(X2), W(XS))
+#define cleqx3ld(XD, XS, MT, DT)                                            \
+        cgtqx3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notqx_rx(W(XD))
 
-#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbsds_rr(W(XG), W(X1), W(X2), W(XS))
+#endif /* cleqx_rr */
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
-        rcpds_rr(W(XD), W(XS))
+#ifndef cgeqx_rr
 
-#define rceqs_rr(XD, XS)                                                    \
-        rceds_rr(W(XD), W(XS))
+#define cgeqx_rr(XG, XS)                                                    \
+        cgeqx3rr(W(XG), W(XG), W(XS))
 
-#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
-        rcsds_rr(W(XG), W(XS))
+#define cgeqx_ld(XG, MS, DS)                                                \
+        cgeqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cgeqx3rr(XD, XS, XT)                                                \
+        cltqx3rr(W(XD), W(XS), W(XT))                                       \
+        notqx_rx(W(XD))
 
-#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
-        rsqds_rr(W(XD), W(XS))
+#define cgeqx3ld(XD, XS, MT, DT)                                            \
+        cltqx3ld(W(XD), W(XS), W(MT), W(DT))                                \
+        notqx_rx(W(XD))
 
-#define rseqs_rr(XD, XS)                                                    \
-        rseds_rr(W(XD), W(XS))
+#endif /* cgeqx_rr */
 
-#define rssqs_rr(XG, XS) /* destroys XS */                                  \
-        rssds_rr(W(XG), W(XS))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) */
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#ifndef minqn_rr
 
-#define fmaqs_rr(XG, XS, XT)                                                \
-        fmads_rr(W(XG), W(XS), W(XT))
+#define minqn_rr(XG, XS)                                                    \
+        minqn3rr(W(XG), W(XG), W(XS))
 
-#define fmaqs_ld(XG, XS, MT, DT)                                            \
-        fmads_ld(W(XG), W(XS), W(MT), W(DT))
+#define minqn_ld(XG, MS, DS)                                                \
+        minqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define minqn3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, mintn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define fmsqs_rr(XG, XS, XT)                                                \
-        fmsds_rr(W(XG), W(XS), W(XT))
+#define minqn3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, mintn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define fmsqs_ld(XG, XS, MT, DT)                                            \
-        fmsds_ld(W(XG), W(XS), W(MT), W(DT))
+#endif /* minqn_rr */
 
-/*************   packed double-precision floating-point compare   *************/
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) */
 
-/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+#ifndef maxqn_rr
 
-#define minqs_rr(XG, XS)                                                    \
-        minds_rr(W(XG), W(XS))
+#define maxqn_rr(XG, XS)                                                    \
+        maxqn3rr(W(XG), W(XG), W(XS))
 
-#define minqs_ld(XG, MS, DS)                                                \
-        minds_ld(W(XG), W(MS), W(DS))
+#define maxqn_ld(XG, MS, DS)                                                \
+        maxqn3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define minqs3rr(XD, XS, XT)                                                \
-        minds3rr(W(XD), W(XS), W(XT))
+#define maxqn3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, maxtn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define minqs3ld(XD, XS, MT, DT)                                            \
-        minds3ld(W(XD), W(XS), W(MT), W(DT))
+#define maxqn3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, maxtn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+#endif /* maxqn_rr */
 
-#define maxqs_rr(XG, XS)                                                    \
-        maxds_rr(W(XG), W(XS))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define maxqs_ld(XG, MS, DS)                                                \
-        maxds_ld(W(XG), W(MS), W(DS))
+#ifndef minqx_rr
 
-#define maxqs3rr(XD, XS, XT)                                                \
-        maxds3rr(W(XD), W(XS), W(XT))
+#define minqx_rr(XG, XS)                                                    \
+        minqx3rr(W(XG), W(XG), W(XS))
 
-#define maxqs3ld(XD, XS, MT, DT)                                            \
-        maxds3ld(W(XD), W(XS), W(MT), W(DT))
+#define minqx_ld(XG, MS, DS)                                                \
+        minqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+#define minqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_rr(W(XD), W(XT))                                              \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        minqn_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)
 
-#define ceqqs_rr(XG, XS)                                                    \
-        ceqds_rr(W(XG), W(XS))
+#define minqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        minqn_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)
 
-#define ceqqs_ld(XG, MS, DS)                                                \
-        ceqds_ld(W(XG), W(MS), W(DS))
+#endif /* minqx_rr */
 
-#define ceqqs3rr(XD, XS, XT)                                                \
-        ceqds3rr(W(XD), W(XS), W(XT))
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
 
-#define ceqqs3ld(XD, XS, MT, DT)                                            \
-        ceqds3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef maxqx_rr
 
-/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+#define maxqx_rr(XG, XS)                                                    \
+        maxqx3rr(W(XG), W(XG), W(XS))
 
-#define cneqs_rr(XG, XS)                                                    \
-        cneds_rr(W(XG), W(XS))
+#define maxqx_ld(XG, MS, DS)                                                \
+        maxqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define cneqs_ld(XG, MS, DS)                                                \
-        cneds_ld(W(XG), W(MS), W(DS))
+#define maxqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_rr(W(XD), W(XT))                                              \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        maxqn_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)
 
-#define cneqs3rr(XD, XS, XT)                                                \
-        cneds3rr(W(XD), W(XS), W(XT))
+#define maxqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)                                 \
+        maxqn_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_GPC06_64)
 
-#define cneqs3ld(XD, XS, MT, DT)                                            \
-        cneds3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* maxqx_rr */
 
-/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+/* abs (G = |G|), (D = |S|) - signed
+ * destroys Reax (scratch) */
 
-#define cltqs_rr(XG, XS)                                                    \
-        cltds_rr(W(XG), W(XS))
+#ifndef absqn_rr
 
-#define cltqs_ld(XG, MS, DS)                                                \
-        cltds_ld(W(XG), W(MS), W(DS))
+#define absqn_rx(XG)                                                        \
+        absqn_rr(W(XG), W(XG))
 
-#define cltqs3rr(XD, XS, XT)                                                \
-        cltds3rr(W(XD), W(XS), W(XT))
+#define absqn_rr(XD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Redx)                                                      \
+        elmxx_xx(cmptx_cx, abstn)                                           \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cltqs3ld(XD, XS, MT, DT)                                            \
-        cltds3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* absqn_rr */
 
-/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+/******************************************************************************/
+/**** var-len **** SIMD three-operand select with explicit mask ***************/
+/******************************************************************************/
 
-#define cleqs_rr(XG, XS)                                                    \
-        cleds_rr(W(XG), W(XS))
+/*
+ * Select picks elements from either of two sources by a mask held in any
+ * register (as opposed to mmv, which is tied to Xmm0), so branchless code
+ * can keep several compare-masks live. Masks are full-width elements from
+ * integer/fp compares (all-ones or zeros), as some targets look only at
+ * the sign-bit (blendv), some at the full element (AVX-512 opmask) and some
+ * at individual bits (bsl/bit/bif, bsel.v/bmnz.v, vsel/xxsel). Targets
+ * without a native 4-operand form combine S and T with xor/and/xor through
+ * inf_SCR01/inf_SCR02, so any of XD, XM, XS, XT may alias each other.
+ */
 
-#define cleqs_ld(XG, MS, DS)                                                \
-        cleds_ld(W(XG), W(MS), W(DS))
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
 
-#define cleqs3rr(XD, XS, XT)                                                \
-        cleds3rr(W(XD), W(XS), W(XT))
+#ifndef selox_rr
 
-#define cleqs3ld(XD, XS, MT, DT)                                            \
-        cleds3ld(W(XD), W(XS), W(MT), W(DT))
+#define selox_rr(XG, XM, XS)                                                \
+        selox3rr(W(XG), W(XM), W(XG), W(XS))
 
-/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+#define selox_ld(XG, XM, MS, DS)                                            \
+        selox3ld(W(XG), W(XM), W(XG), W(MS), W(DS))
 
-#define cgtqs_rr(XG, XS)                                                    \
-        cgtds_rr(W(XG), W(XS))
+#define selox3rr(XD, XM, XS, XT)                                            \
+        movox_st(W(XM), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_rr(W(XD), W(XT))                                              \
+        xorox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        andox_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cgtqs_ld(XG, MS, DS)                                                \
-        cgtds_ld(W(XG), W(MS), W(DS))
+#define selox3ld(XD, XM, XS, MT, DT)                                        \
+        movox_st(W(XM), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        xorox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        andox_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cgtqs3rr(XD, XS, XT)                                                \
-        cgtds3rr(W(XD), W(XS), W(XT))
+#endif /* selox_rr */
 
-#define cgtqs3ld(XD, XS, MT, DT)                                            \
-        cgtds3ld(W(XD), W(XS), W(MT), W(DT))
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
 
-/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+#ifndef selqx_rr
 
-#define cgeqs_rr(XG, XS)                                                    \
-        cgeds_rr(W(XG), W(XS))
+#define selqx_rr(XG, XM, XS)                                                \
+        selqx3rr(W(XG), W(XM), W(XG), W(XS))
 
-#define cgeqs_ld(XG, MS, DS)                                                \
-        cgeds_ld(W(XG), W(MS), W(DS))
+#define selqx_ld(XG, XM, MS, DS)                                            \
+        selqx3ld(W(XG), W(XM), W(XG), W(MS), W(DS))
 
-#define cgeqs3rr(XD, XS, XT)                                                \
-        cgeds3rr(W(XD), W(XS), W(XT))
+#define selqx3rr(XD, XM, XS, XT)                                            \
+        movqx_st(W(XM), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_rr(W(XD), W(XT))                                              \
+        xorqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        andqx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define cgeqs3ld(XD, XS, MT, DT)                                            \
-        cgeds3ld(W(XD), W(XS), W(MT), W(DT))
+#define selqx3ld(XD, XM, XS, MT, DT)                                        \
+        movqx_st(W(XM), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        xorqx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        andqx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* mkj (jump to lb) if (S satisfies mask condition) */
+#endif /* selqx_rr */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        mkjdx_rx(W(XS), mask, lb)
+/******************************************************************************/
+/**** var-len **** SIMD non-temporal (streaming) stores ***********************/
+/******************************************************************************/
 
-/*************   packed double-precision floating-point convert   *************/
+/*
+ * Streaming stores write full SIMD registers to SIMD-aligned destinations
+ * bypassing caches where supported (x86 SSE/AVX/AVX-512), avoiding the
+ * read-for-ownership of the target line, which pays off when the data isn't
+ * read back soon (framebuffers, bulk outputs larger than the last-level cache).
+ * They are weakly-ordered on x86, stores become visible to other threads only
+ * after a subsequent fence or a locked instruction, while the issuing thread
+ * sees them in program order. Targets without them fall back to regular
+ * stores, the same applies to the 64-bit subset which shares the encoding.
+ */
 
-/* cvz (D = fp-to-signed-int S)
- * rounding mode is encoded directly (can be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#ifndef movox_nt
 
-#define rnzqs_rr(XD, XS)     /* round towards zero */                       \
-        rnzds_rr(W(XD), W(XS))
+#define movox_nt(XS, MD, DD)                                                \
+        movox_st(W(XS), W(MD), W(DD))
 
-#define rnzqs_ld(XD, MS, DS) /* round towards zero */                       \
-        rnzds_ld(W(XD), W(MS), W(DS))
+#endif /* movox_nt */
 
-#define cvzqs_rr(XD, XS)     /* round towards zero */                       \
-        cvzds_rr(W(XD), W(XS))
+#define movqx_nt(XS, MD, DD)                                                \
+        movox_nt(W(XS), W(MD), W(DD))
 
-#define cvzqs_ld(XD, MS, DS) /* round towards zero */                       \
-        cvzds_ld(W(XD), W(MS), W(DS))
+/******************************************************************************/
+/**** var-len **** SIMD masked loads/stores for loop tails ********************/
+/******************************************************************************/
 
-/* cvp (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+/*
+ * Loop tails shorter than a full SIMD register are handled in-register:
+ * mkt sets Xmm0 elements below the number of remaining elements in RS
+ * to all-ones and the rest to zero (RS is a BASE register, zero or greater
+ * values than SIMD width are valid, the latter give a full mask), then mmz
+ * loads the active elements zeroing the rest, mmv (above) merges results
+ * back into memory leaving inactive elements unchanged. Targets with native
+ * masked loads (AVX vmaskmov, AVX-512 zero-masking) don't access inactive
+ * elements, elsewhere mmz loads the full vector and clears inactive elements,
+ * while mmv merges in-register and stores the full vector back (read-modify-
+ * write). As memory operands are SIMD-aligned, the full vector never crosses
+ * a page boundary, so neither can fault past the end of a valid array, but
+ * inactive elements mustn't be written concurrently by other threads.
+ * Both mkt and mmz preserve the mask in Xmm0, mmv destroys it on some targets.
+ */
 
-#define rnpqs_rr(XD, XS)     /* round towards +inf */                       \
-        rnpds_rr(W(XD), W(XS))
+/* internal helpers (not for direct use in code) */
 
-#define rnpqs_ld(XD, MS, DS) /* round towards +inf */                       \
-        rnpds_ld(W(XD), W(MS), W(DS))
+#define mktrx_cx(op, dp)                                                    \
+        op##_ri(Reax, IB(1))                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x00))                           \
+        op##_ri(Reax, IB(1))                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x04))                           \
+        op##_ri(Reax, IB(1))                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x08))                           \
+        op##_ri(Reax, IB(1))                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x0C))
 
-#define cvpqs_rr(XD, XS)     /* round towards +inf */                       \
-        cvpds_rr(W(XD), W(XS))
+#define mkttx_cx(op, dp)                                                    \
+        op##_ri(Reax, IB(1))                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x00))                           \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x04))                           \
+        op##_ri(Reax, IB(1))                                                \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x08))                           \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x0C))
 
-#define cvpqs_ld(XD, MS, DS) /* round towards +inf */                       \
-        cvpds_ld(W(XD), W(MS), W(DS))
+/* mkt (Xmm0 = tail-mask of S elems) where (elem: -1 if < S, 0 otherwise)
+ * uses Reax implicitly as a scratch register, RS can be Reax */
 
-/* cvm (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define mktox_xr(RS)                                                        \
+        movwx_rr(Reax, W(RS))                                               \
+        elmxx_xx(mktrx_cx, subwx)                                            \
+        movox_ld(Xmm0, Mebp, inf_SCR01(0))                                  \
+        shron_ri(Xmm0, IB(31))                                              \
+        notox_rx(Xmm0)
 
-#define rnmqs_rr(XD, XS)     /* round towards -inf */                       \
-        rnmds_rr(W(XD), W(XS))
+#define mktqx_xr(RS)                                                        \
+        movwx_rr(Reax, W(RS))                                               \
+        elmxx_xx(mkttx_cx, subwx)                                            \
+        movox_ld(Xmm0, Mebp, inf_SCR01(0))                                  \
+        shron_ri(Xmm0, IB(31))                                              \
+        notox_rx(Xmm0)
 
-#define rnmqs_ld(XD, MS, DS) /* round towards -inf */                       \
-        rnmds_ld(W(XD), W(MS), W(DS))
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, XD cannot be Xmm0 */
 
-#define cvmqs_rr(XD, XS)     /* round towards -inf */                       \
-        cvmds_rr(W(XD), W(XS))
+#ifndef mmzox_ld
 
-#define cvmqs_ld(XD, MS, DS) /* round towards -inf */                       \
-        cvmds_ld(W(XD), W(MS), W(DS))
+#define mmzox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        andox_rr(W(XD), Xmm0)
 
-/* cvn (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#endif /* mmzox_ld */
 
-#define rnnqs_rr(XD, XS)     /* round towards near */                       \
-        rnnds_rr(W(XD), W(XS))
+#ifndef mmzqx_ld
 
-#define rnnqs_ld(XD, MS, DS) /* round towards near */                       \
-        rnnds_ld(W(XD), W(MS), W(DS))
+#define mmzqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        andqx_rr(W(XD), Xmm0)
 
-#define cvnqs_rr(XD, XS)     /* round towards near */                       \
-        cvnds_rr(W(XD), W(XS))
+#endif /* mmzqx_ld */
 
-#define cvnqs_ld(XD, MS, DS) /* round towards near */                       \
-        cvnds_ld(W(XD), W(MS), W(DS))
+/******************************************************************************/
+/**** var-len **** SIMD compare-mask to BASE bit-mask and element count *******/
+/******************************************************************************/
 
-/* cvn (D = signed-int-to-fp S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+/*
+ * Compare results (elements of all-ones or zero) are moved into BASE register
+ * RD, so that divergence in packets can be handled with regular BASE logic
+ * instead of multiple mkj probes: mkb sets bit i of RD to the state of i-th
+ * element of S (bit 0 is the lowest element, unused upper bits are zeroed),
+ * mkc sets RD to the number of active (all-ones) elements in S. Neither of
+ * them destroys Reax or any other BASE register besides RD. The bit-mask fits
+ * 32-bit BASE registers (cmdw*) for up to 32 elements, 2K8-bit fp32 targets
+ * (64 elements) use all 64 bits of RD (cmdz*) for the result of mkb.
+ * x86 targets use movmsk/kmov (followed by popcnt for mkc on AVX and later),
+ * AArch64 and ARMv7 accumulate lane bits with shift-right-and-accumulate,
+ * other targets (and mkc on SSE) go through the scratch area below.
+ */
 
-#define cvnqn_rr(XD, XS)     /* round towards near */                       \
-        cvndn_rr(W(XD), W(XS))
+/* internal helpers (not for direct use in code) */
 
-#define cvnqn_ld(XD, MS, DS) /* round towards near */                       \
-        cvndn_ld(W(XD), W(MS), W(DS))
+#define mkbrx_cx(RD, dp)                                                    \
+        shlwx_ri(W(RD), IB(1))                                              \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x0C))                           \
+        shlwx_ri(W(RD), IB(1))                                              \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x08))                           \
+        shlwx_ri(W(RD), IB(1))                                              \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x04))                           \
+        shlwx_ri(W(RD), IB(1))                                              \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x00))
 
-/* cvt (D = fp-to-signed-int S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define mkbtx_cx(RD, dp)                                                    \
+        shlwx_ri(W(RD), IB(1))                                              \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x08))                           \
+        shlwx_ri(W(RD), IB(1))                                              \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x00))
 
-#define rndqs_rr(XD, XS)                                                    \
-        rndds_rr(W(XD), W(XS))
+#define mkcrx_cx(RD, dp)                                                    \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x00))                           \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x04))                           \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x08))                           \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x0C))
 
-#define rndqs_ld(XD, MS, DS)                                                \
-        rndds_ld(W(XD), W(MS), W(DS))
+#define mkctx_cx(RD, dp)                                                    \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x00))                           \
+        subwx_ld(W(RD), Mebp, inf_SCR01(dp+0x08))
 
-#define cvtqs_rr(XD, XS)                                                    \
-        cvtds_rr(W(XD), W(XS))
+/* elm (run cx for each 128-bit chunk of the SCR01 area, the highest first)
+ * elmxx_ri also passes immediate IT to cx for shf fallbacks further below */
 
-#define cvtqs_ld(XD, MS, DS)                                                \
-        cvtds_ld(W(XD), W(MS), W(DS))
+#define elmxx_rx(cx, RD)                                                    \
+        chnxx_dn(chnxx_r1, cx, W(RD), W(EMPTY, EMPTY, EMPTY))
 
-/* cvt (D = signed-int-to-fp S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+#define elmxx_ri(cx, RD, IT)                                                \
+        chnxx_dn(chnxx_r2, cx, W(RD), W(IT))
 
-#define cvtqn_rr(XD, XS)                                                    \
-        cvtdn_rr(W(XD), W(XS))
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
 
-#define cvtqn_ld(XD, MS, DS)                                                \
-        cvtdn_ld(W(XD), W(MS), W(DS))
+#ifndef mkbox_rr
 
-/* cvr (D = fp-to-signed-int S)
- * rounding mode is encoded directly (cannot be used in FCTRL blocks)
- * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
- * isn't always taken into account when used within full-IEEE ASM block
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define mkbox_rr(RD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movwx_ri(W(RD), IC(0))                                              \
+        elmxx_rx(mkbrx_cx, W(RD))
 
-#define rnrqs_rr(XD, XS, mode)                                              \
-        rnrds_rr(W(XD), W(XS), mode)
+#endif /* mkbox_rr */
 
-#define cvrqs_rr(XD, XS, mode)                                              \
-        cvrds_rr(W(XD), W(XS), mode)
+#ifndef mkbqx_rr
 
-/************   packed double-precision integer arithmetic/shifts   ***********/
+#define mkbqx_rr(RD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movwx_ri(W(RD), IC(0))                                              \
+        elmxx_rx(mkbtx_cx, W(RD))
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#endif /* mkbqx_rr */
 
-#define addqx_rr(XG, XS)                                                    \
-        adddx_rr(W(XG), W(XS))
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
 
-#define addqx_ld(XG, MS, DS)                                                \
-        adddx_ld(W(XG), W(MS), W(DS))
+#ifndef mkcox_rr
 
-#define addqx3rr(XD, XS, XT)                                                \
-        adddx3rr(W(XD), W(XS), W(XT))
+#define mkcox_rr(RD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movwx_ri(W(RD), IC(0))                                              \
+        elmxx_rx(mkcrx_cx, W(RD))
 
-#define addqx3ld(XD, XS, MT, DT)                                            \
-        adddx3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* mkcox_rr */
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+#ifndef mkcqx_rr
 
-#define subqx_rr(XG, XS)                                                    \
-        subdx_rr(W(XG), W(XS))
+#define mkcqx_rr(RD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movwx_ri(W(RD), IC(0))                                              \
+        elmxx_rx(mkctx_cx, W(RD))
 
-#define subqx_ld(XG, MS, DS)                                                \
-        subdx_ld(W(XG), W(MS), W(DS))
+#endif /* mkcqx_rr */
 
-#define subqx3rr(XD, XS, XT)                                                \
-        subdx3rr(W(XD), W(XS), W(XT))
+/******************************************************************************/
+/**** var-len **** SIMD broadcast and element insert/extract with BASE ********/
+/******************************************************************************/
 
-#define subqx3ld(XD, XS, MT, DT)                                            \
-        subdx3ld(W(XD), W(XS), W(MT), W(DT))
+/*
+ * Broadcast (spl) fills all elements of D with an elem-sized BASE register
+ * (cmdw* for 32-bit, cmdz* for 64-bit elements) or a scalar in memory,
+ * extract (ext) moves element IS of S into a BASE register, while insert
+ * (ins) replaces element IS of G with a BASE register, keeping the rest.
+ * Element index IS is an immediate (IB) below the number of elements in
+ * the SIMD register. No other BASE or SIMD registers are affected. Targets
+ * without direct moves (or without an element-index field wide enough
+ * for 256-bit and wider registers) go through inf_SCR01 below, loading
+ * memory scalars with the scalar SIMD subset to leave BASE untouched.
+ */
 
-/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* internal helpers (not for direct use in code) */
 
-#define shlqx_ri(XG, IS)                                                    \
-        shldx_ri(W(XG), W(IS))
+#define splrx_cx(RS, dp)                                                    \
+        movwx_st(W(RS), Mebp, inf_SCR01(dp+0x00))                           \
+        movwx_st(W(RS), Mebp, inf_SCR01(dp+0x04))                           \
+        movwx_st(W(RS), Mebp, inf_SCR01(dp+0x08))                           \
+        movwx_st(W(RS), Mebp, inf_SCR01(dp+0x0C))
 
-#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shldx_ld(W(XG), W(MS), W(DS))
+#define spltx_cx(RS, dp)                                                    \
+        movzx_st(W(RS), Mebp, inf_SCR01(dp+0x00))                           \
+        movzx_st(W(RS), Mebp, inf_SCR01(dp+0x08))
 
-#define shlqx3ri(XD, XS, IT)                                                \
-        shldx3ri(W(XD), W(XS), W(IT))
+#define splrs_cx(XS, dp)                                                    \
+        movrs_st(W(XS), Mebp, inf_SCR01(dp+0x00))                           \
+        movrs_st(W(XS), Mebp, inf_SCR01(dp+0x04))                           \
+        movrs_st(W(XS), Mebp, inf_SCR01(dp+0x08))                           \
+        movrs_st(W(XS), Mebp, inf_SCR01(dp+0x0C))
 
-#define shlqx3ld(XD, XS, MT, DT)                                            \
-        shldx3ld(W(XD), W(XS), W(MT), W(DT))
+#define splts_cx(XS, dp)                                                    \
+        movts_st(W(XS), Mebp, inf_SCR01(dp+0x00))                           \
+        movts_st(W(XS), Mebp, inf_SCR01(dp+0x08))
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
 
-#define shrqx_ri(XG, IS)                                                    \
-        shrdx_ri(W(XG), W(IS))
+#ifndef splox_rr
 
-#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrdx_ld(W(XG), W(MS), W(DS))
+#define splox_rr(XD, RS)                                                    \
+        elmxx_rx(splrx_cx, W(RS))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define shrqx3ri(XD, XS, IT)                                                \
-        shrdx3ri(W(XD), W(XS), W(IT))
+#define splox_ld(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        elmxx_rx(splrs_cx, W(XD))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define shrqx3ld(XD, XS, MT, DT)                                            \
-        shrdx3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* splox_rr */
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
 
-#define shrqn_ri(XG, IS)                                                    \
-        shrdn_ri(W(XG), W(IS))
+#ifndef extox_rr
 
-#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrdn_ld(W(XG), W(MS), W(DS))
+#define extox_rr(RD, XS, IS)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movwx_ld(W(RD), Mebp, inf_SCR01(VAL(IS)*4))
 
-#define shrqn3ri(XD, XS, IT)                                                \
-        shrdn3ri(W(XD), W(XS), W(IT))
+#endif /* extox_rr */
 
-#define shrqn3ld(XD, XS, MT, DT)                                            \
-        shrdn3ld(W(XD), W(XS), W(MT), W(DT))
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
 
-/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#ifndef insox_rr
 
-#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svldx_rr(W(XG), W(XS))
+#define insox_rr(XG, RS, IS)                                                \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movwx_st(W(RS), Mebp, inf_SCR01(VAL(IS)*4))                         \
+        movox_ld(W(XG), Mebp, inf_SCR01(0))
 
-#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svldx_ld(W(XG), W(MS), W(DS))
+#endif /* insox_rr */
 
-#define svlqx3rr(XD, XS, XT)                                                \
-        svldx3rr(W(XD), W(XS), W(XT))
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
 
-#define svlqx3ld(XD, XS, MT, DT)                                            \
-        svldx3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef splqx_rr
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define splqx_rr(XD, RS)                                                    \
+        elmxx_rx(spltx_cx, W(RS))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrdx_rr(W(XG), W(XS))
+#define splqx_ld(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        elmxx_rx(splts_cx, W(XD))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrdx_ld(W(XG), W(MS), W(DS))
+#endif /* splqx_rr */
 
-#define svrqx3rr(XD, XS, XT)                                                \
-        svrdx3rr(W(XD), W(XS), W(XT))
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
 
-#define svrqx3ld(XD, XS, MT, DT)                                            \
-        svrdx3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef extqx_rr
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define extqx_rr(RD, XS, IS)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movzx_ld(W(RD), Mebp, inf_SCR01(VAL(IS)*8))
 
-#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrdn_rr(W(XG), W(XS))
+#endif /* extqx_rr */
 
-#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrdn_ld(W(XG), W(MS), W(DS))
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
 
-#define svrqn3rr(XD, XS, XT)                                                \
-        svrdn3rr(W(XD), W(XS), W(XT))
+#ifndef insqx_rr
 
-#define svrqn3ld(XD, XS, MT, DT)                                            \
-        svrdn3ld(W(XD), W(XS), W(MT), W(DT))
+#define insqx_rr(XG, RS, IS)                                                \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movzx_st(W(RS), Mebp, inf_SCR01(VAL(IS)*8))                         \
+        movqx_ld(W(XG), Mebp, inf_SCR01(0))
 
-/*
- * common 256-bit floating-point SIMD instructions with 64-bit elements
- */
+#endif /* insqx_rr */
 
-/* cbr (D = cbrt S) */
+/******************************************************************************/
+/**** var-len **** SIMD elem shuffle, interleave and reverse ******************/
+/******************************************************************************/
 
 /*
- * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
- * available at http://www.musicdsp.org/showone.php?id=206
- * converted to S-way SIMD version by VectorChief.
+ * Shuffle (shf) and interleave (ilo/ihi) operate within each 128-bit chunk
+ * of the SIMD register independently, which maps to single instructions on
+ * most targets, while reverse (rev) crosses chunks (and register pairs or
+ * quads on wider targets) to provide the full-width permute in AoS/SoA
+ * reorganization. Targets without native forms go through inf_SCR01/02.
  */
-#define cbrds_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbeds_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsds_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsds_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsds_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define cbeds_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        /* cube root estimate, the exponent is divided by three             \
-         * in such a way that remainder bits get shoved into                \
-         * the top of the normalized mantissa */                            \
-        movdx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
-        movdx_rr(W(XD), W(XS))                                              \
-        anddx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
-        subdx_ld(W(XD), Mebp, inf_GPC05_64) /* convert to 2's complement */ \
-        shrdn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
-        movdx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
-        shldx_ri(W(X1), IB(2))                                              \
-        adddx_rr(W(XD), W(X1))                                              \
-        shldx_ri(W(X1), IB(2))                                              \
-        adddx_rr(W(XD), W(X1))                                              \
-        shldx_ri(W(X1), IB(2))                                              \
-        adddx_rr(W(XD), W(X1))                                              \
-        shldx_ri(W(X1), IB(2))                                              \
-        adddx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
-        adddx_ld(W(XD), Mebp, inf_GPC05_64) /* back to biased-127 */        \
-        anddx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
-        anndx_rr(W(X2), W(XS))   /* original sign */                        \
-        orrdx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+/* internal helpers (not for direct use in code) */
+
+#define shfrx_cx(XD, IT, dp)                                                \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+((VAL(IT)<<2)&0x0C)))            \
+        movrs_st(W(XD), Mebp, inf_SCR02(dp+0x00))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+(VAL(IT)&0x0C)))                 \
+        movrs_st(W(XD), Mebp, inf_SCR02(dp+0x04))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+((VAL(IT)>>2)&0x0C)))            \
+        movrs_st(W(XD), Mebp, inf_SCR02(dp+0x08))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+((VAL(IT)>>4)&0x0C)))            \
+        movrs_st(W(XD), Mebp, inf_SCR02(dp+0x0C))
+
+#define ilorx_cx(XD, dp)                                                    \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x04))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR02(dp+0x00))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x04))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR02(dp+0x04))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x0C))
+
+#define ihirx_cx(XD, dp)                                                    \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x00))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x0C))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR02(dp+0x08))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x04))                           \
+        movrs_ld(W(XD), Mebp, inf_SCR02(dp+0x0C))                           \
+        movrs_st(W(XD), Mebp, inf_SCR01(dp+0x0C))
+
+#define revrx_cx(XD, dp)                                                    \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x00))                           \
+        movrs_st(W(XD), Mebp, inf_SCR02(Q*0x10-0x04-dp))                    \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x04))                           \
+        movrs_st(W(XD), Mebp, inf_SCR02(Q*0x10-0x08-dp))                    \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movrs_st(W(XD), Mebp, inf_SCR02(Q*0x10-0x0C-dp))                    \
+        movrs_ld(W(XD), Mebp, inf_SCR01(dp+0x0C))                           \
+        movrs_st(W(XD), Mebp, inf_SCR02(Q*0x10-0x10-dp))
+
+#define shftx_cx(XD, IT, dp)                                                \
+        movts_ld(W(XD), Mebp, inf_SCR01(dp+((VAL(IT)<<3)&0x08)))            \
+        movts_st(W(XD), Mebp, inf_SCR02(dp+0x00))                           \
+        movts_ld(W(XD), Mebp, inf_SCR01(dp+((VAL(IT)<<2)&0x08)))            \
+        movts_st(W(XD), Mebp, inf_SCR02(dp+0x08))
+
+#define ilotx_cx(XD, dp)                                                    \
+        movts_ld(W(XD), Mebp, inf_SCR02(dp+0x00))                           \
+        movts_st(W(XD), Mebp, inf_SCR01(dp+0x08))
+
+#define ihitx_cx(XD, dp)                                                    \
+        movts_ld(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movts_st(W(XD), Mebp, inf_SCR01(dp+0x00))                           \
+        movts_ld(W(XD), Mebp, inf_SCR02(dp+0x08))                           \
+        movts_st(W(XD), Mebp, inf_SCR01(dp+0x08))
+
+#define revtx_cx(XD, dp)                                                    \
+        movts_ld(W(XD), Mebp, inf_SCR01(dp+0x00))                           \
+        movts_st(W(XD), Mebp, inf_SCR02(Q*0x10-0x08-dp))                    \
+        movts_ld(W(XD), Mebp, inf_SCR01(dp+0x08))                           \
+        movts_st(W(XD), Mebp, inf_SCR02(Q*0x10-0x10-dp))
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#ifndef shfox3ri
+
+#define shfox_ri(XG, IS)                                                    \
+        shfox3ri(W(XG), W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        elmxx_ri(shfrx_cx, W(XD), W(IT))                                    \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define cbsds_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        movdx_rr(W(X1), W(XG))                                              \
-        mulds_rr(W(X1), W(XG))                                              \
-        movdx_rr(W(X2), W(X1))                                              \
-        mulds_ld(W(X1), Mebp, inf_GPC03_64)                                 \
-        rceds_rr(W(X1), W(X1))                                              \
-        mulds_rr(W(X2), W(XG))                                              \
-        subds_rr(W(X2), W(XS))                                              \
-        mulds_rr(W(X2), W(X1))                                              \
-        subds_rr(W(XG), W(X2))
+#endif /* shfox3ri */
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#ifndef iloox3rr
 
-#define rcpds_rr(XD, XS) /* destroys XS */                                  \
-        rceds_rr(W(XD), W(XS))                                              \
-        rcsds_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define iloox_rr(XG, XS)                                                    \
+        iloox3rr(W(XG), W(XG), W(XS))
 
-#elif RT_SIMD_COMPAT_RCP == 1
+#define iloox_ld(XG, MS, DS)                                                \
+        iloox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define rcpds_rr(XD, XS) /* destroys XS */                                  \
-        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divds_rr(W(XD), W(XS))
+#define iloox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ilorx_cx, W(XD))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rceds_rr(XD, XS)                                                    \
-        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divds_ld(W(XD), Mebp, inf_SCR02(0))
+#define iloox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ilorx_cx, W(XD))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rcsds_rr(XG, XS) /* destroys XS */
+#endif /* iloox3rr */
 
-#endif /* RT_SIMD_COMPAT_RCP */
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#ifndef ihiox3rr
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#define ihiox_rr(XG, XS)                                                    \
+        ihiox3rr(W(XG), W(XG), W(XS))
 
-#define rsqds_rr(XD, XS) /* destroys XS */                                  \
-        rseds_rr(W(XD), W(XS))                                              \
-        rssds_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define ihiox_ld(XG, MS, DS)                                                \
+        ihiox3ld(W(XG), W(XG), W(MS), W(DS))
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define ihiox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ihirx_cx, W(XD))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rsqds_rr(XD, XS) /* destroys XS */                                  \
-        sqrds_rr(W(XS), W(XS))                                              \
-        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divds_rr(W(XD), W(XS))
+#define ihiox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ihirx_cx, W(XD))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define rseds_rr(XD, XS)                                                    \
-        sqrds_rr(W(XD), W(XS))                                              \
-        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movdx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divds_ld(W(XD), Mebp, inf_SCR02(0))
+#endif /* ihiox3rr */
 
-#define rssds_rr(XG, XS) /* destroys XS */
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#ifndef revox_rr
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#define revox_rx(XG)                                                        \
+        revox_rr(W(XG), W(XG))
 
-#if RT_SIMD_COMPAT_FMA == 2
+#define revox_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        elmxx_rx(revrx_cx, W(XD))                                           \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define fmads_rr(XG, XS, XT)                                                \
-        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulds_rr(W(XS), W(XT))                                              \
-        addds_rr(W(XG), W(XS))                                              \
-        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+#endif /* revox_rr */
 
-#define fmads_ld(XG, XS, MT, DT)                                            \
-        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulds_ld(W(XS), W(MT), W(DT))                                       \
-        addds_rr(W(XG), W(XS))                                              \
-        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#ifndef shfqx3ri
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#define shfqx3ri(XD, XS, IT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        elmxx_ri(shftx_cx, W(XD), W(IT))                                    \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define fmsds_rr(XG, XS, XT)                                                \
-        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulds_rr(W(XS), W(XT))                                              \
-        subds_rr(W(XG), W(XS))                                              \
-        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+#endif /* shfqx3ri */
 
-#define fmsds_ld(XG, XS, MT, DT)                                            \
-        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mulds_ld(W(XS), W(MT), W(DT))                                       \
-        subds_rr(W(XG), W(XS))                                              \
-        movdx_ld(W(XS), Mebp, inf_SCR01(0))
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#ifndef iloqx3rr
 
-/******************************************************************************/
-/**** var-len **** SIMD instructions with fixed-64-bit-element **** 128-bit ***/
-/******************************************************************************/
+#define iloqx_rr(XG, XS)                                                    \
+        iloqx3rr(W(XG), W(XG), W(XS))
 
-#elif (RT_SIMD == 128)
+#define iloqx_ld(XG, MS, DS)                                                \
+        iloqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-/***************   packed double-precision generic move/logic   ***************/
+#define iloqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ilotx_cx, W(XD))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* mov (D = S) */
+#define iloqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ilotx_cx, W(XD))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define movqx_rr(XD, XS)                                                    \
-        movjx_rr(W(XD), W(XS))
+#endif /* iloqx3rr */
 
-#define movqx_ld(XD, MS, DS)                                                \
-        movjx_ld(W(XD), W(MS), W(DS))
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
 
-#define movqx_st(XS, MD, DD)                                                \
-        movjx_st(W(XS), W(MD), W(DD))
+#ifndef ihiqx3rr
 
-/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
- * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
+#define ihiqx_rr(XG, XS)                                                    \
+        ihiqx3rr(W(XG), W(XG), W(XS))
 
-#define mmvqx_ld(XG, MS, DS)                                                \
-        mmvjx_ld(W(XG), W(MS), W(DS))
+#define ihiqx_ld(XG, MS, DS)                                                \
+        ihiqx3ld(W(XG), W(XG), W(MS), W(DS))
 
-#define mmvqx_st(XS, MG, DG)                                                \
-        mmvjx_st(W(XS), W(MG), W(DG))
+#define ihiqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ihitx_cx, W(XD))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-/* and (G = G & S), (D = S & T) if (#D != #S) */
+#define ihiqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        elmxx_rx(ihitx_cx, W(XD))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
 
-#define andqx_rr(XG, XS)                                                    \
-        andjx_rr(W(XG), W(XS))
+#endif /* ihiqx3rr */
 
-#define andqx_ld(XG, MS, DS)                                                \
-        andjx_ld(W(XG), W(MS), W(DS))
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
 
-#define andqx3rr(XD, XS, XT)                                                \
-        andjx3rr(W(XD), W(XS), W(XT))
+#ifndef revqx_rr
 
-#define andqx3ld(XD, XS, MT, DT)                                            \
-        andjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define revqx_rx(XG)                                                        \
+        revqx_rr(W(XG), W(XG))
 
-/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+#define revqx_rr(XD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        elmxx_rx(revtx_cx, W(XD))                                           \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define annqx_rr(XG, XS)                                                    \
-        annjx_rr(W(XG), W(XS))
+#endif /* revqx_rr */
 
-#define annqx_ld(XG, MS, DS)                                                \
-        annjx_ld(W(XG), W(MS), W(DS))
+/******************************************************************************/
+/**** var-len **** SIMD fp arithmetic with explicit rounding mode *************/
+/******************************************************************************/
 
-#define annqx3rr(XD, XS, XT)                                                \
-        annjx3rr(W(XD), W(XS), W(XT))
+/*
+ * Explicit-rounding arithmetic (adr, sbr, mlr, dvr, fmr) takes the rounding
+ * mode as the last parameter (ROUNDN, ROUNDM, ROUNDP, ROUNDZ and _F modes)
+ * instead of relying on FCTRL blocks, which cannot be nested and serialize
+ * the pipeline on mode changes. AVX-512 targets encode the mode directly
+ * (EVEX embedded rounding, 512-bit registers only), elsewhere the op below
+ * is wrapped into a single-op FCTRL block (FCTRL_ENTER_R/FCTRL_LEAVE_R),
+ * which doesn't write fp control register for the default mode (ROUNDN).
+ * Therefore they cannot be used within FCTRL blocks on any target
+ * (see single-op FCTRL blocks next to original FCTRL blocks above).
+ * NOTE: ARMv7 SIMD fp-arithmetic always uses ROUNDN (see FCTRL notes),
+ * x87 fpu-fallbacks for fma honour the mode only with RT_SIMD_COMPAT_FMR.
+ */
 
-#define annqx3ld(XD, XS, MT, DT)                                            \
-        annjx3ld(W(XD), W(XS), W(MT), W(DT))
+/* adr (G = G + S) */
 
-/* orr (G = G | S), (D = S | T) if (#D != #S) */
+#ifndef adros_rr
 
-#define orrqx_rr(XG, XS)                                                    \
-        orrjx_rr(W(XG), W(XS))
+#define adros_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        addos_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-#define orrqx_ld(XG, MS, DS)                                                \
-        orrjx_ld(W(XG), W(MS), W(DS))
+#endif /* adros_rr */
 
-#define orrqx3rr(XD, XS, XT)                                                \
-        orrjx3rr(W(XD), W(XS), W(XT))
+/* sbr (G = G - S) */
 
-#define orrqx3ld(XD, XS, MT, DT)                                            \
-        orrjx3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef sbros_rr
 
-/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+#define sbros_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        subos_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-#define ornqx_rr(XG, XS)                                                    \
-        ornjx_rr(W(XG), W(XS))
+#endif /* sbros_rr */
 
-#define ornqx_ld(XG, MS, DS)                                                \
-        ornjx_ld(W(XG), W(MS), W(DS))
+/* mlr (G = G * S) */
 
-#define ornqx3rr(XD, XS, XT)                                                \
-        ornjx3rr(W(XD), W(XS), W(XT))
+#ifndef mlros_rr
 
-#define ornqx3ld(XD, XS, MT, DT)                                            \
-        ornjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define mlros_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        mulos_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+#endif /* mlros_rr */
 
-#define xorqx_rr(XG, XS)                                                    \
-        xorjx_rr(W(XG), W(XS))
+/* dvr (G = G / S) */
 
-#define xorqx_ld(XG, MS, DS)                                                \
-        xorjx_ld(W(XG), W(MS), W(DS))
+#ifndef dvros_rr
 
-#define xorqx3rr(XD, XS, XT)                                                \
-        xorjx3rr(W(XD), W(XS), W(XT))
+#define dvros_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        divos_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-#define xorqx3ld(XD, XS, MT, DT)                                            \
-        xorjx3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* dvros_rr */
 
-/* not (G = ~G), (D = ~S) */
+/* fmr (G = G + S * T) if (#G != #S && #G != #T) */
 
-#define notqx_rx(XG)                                                        \
-        notjx_rx(W(XG))
+#ifndef fmros_rr
 
-#define notqx_rr(XD, XS)                                                    \
-        notjx_rr(W(XD), W(XS))
+#define fmros_rr(XG, XS, XT, mode)                                          \
+        FCTRL_ENTER_R(mode)                                                 \
+        fmaos_rr(W(XG), W(XS), W(XT))                                       \
+        FCTRL_LEAVE_R(mode)
 
-/************   packed double-precision floating-point arithmetic   ***********/
+#endif /* fmros_rr */
 
-/* neg (G = -G), (D = -S) */
+/* adr (G = G + S) */
 
-#define negqs_rx(XG)                                                        \
-        negjs_rx(W(XG))
+#ifndef adrqs_rr
 
-#define negqs_rr(XD, XS)                                                    \
-        negjs_rr(W(XD), W(XS))
+#define adrqs_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        addqs_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#endif /* adrqs_rr */
 
-#define addqs_rr(XG, XS)                                                    \
-        addjs_rr(W(XG), W(XS))
+/* sbr (G = G - S) */
 
-#define addqs_ld(XG, MS, DS)                                                \
-        addjs_ld(W(XG), W(MS), W(DS))
+#ifndef sbrqs_rr
 
-#define addqs3rr(XD, XS, XT)                                                \
-        addjs3rr(W(XD), W(XS), W(XT))
+#define sbrqs_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        subqs_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-#define addqs3ld(XD, XS, MT, DT)                                            \
-        addjs3ld(W(XD), W(XS), W(MT), W(DT))
+#endif /* sbrqs_rr */
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+/* mlr (G = G * S) */
 
-#define subqs_rr(XG, XS)                                                    \
-        subjs_rr(W(XG), W(XS))
+#ifndef mlrqs_rr
 
-#define subqs_ld(XG, MS, DS)                                                \
-        subjs_ld(W(XG), W(MS), W(DS))
+#define mlrqs_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        mulqs_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-#define subqs3rr(XD, XS, XT)                                                \
-        subjs3rr(W(XD), W(XS), W(XT))
+#endif /* mlrqs_rr */
 
-#define subqs3ld(XD, XS, MT, DT)                                            \
-        subjs3ld(W(XD), W(XS), W(MT), W(DT))
+/* dvr (G = G / S) */
 
-/* mul (G = G * S), (D = S * T) if (#D != #S) */
+#ifndef dvrqs_rr
 
-#define mulqs_rr(XG, XS)                                                    \
-        muljs_rr(W(XG), W(XS))
+#define dvrqs_rr(XG, XS, mode)                                              \
+        FCTRL_ENTER_R(mode)                                                 \
+        divqs_rr(W(XG), W(XS))                                              \
+        FCTRL_LEAVE_R(mode)
 
-#define mulqs_ld(XG, MS, DS)                                                \
-        muljs_ld(W(XG), W(MS), W(DS))
+#endif /* dvrqs_rr */
 
-#define mulqs3rr(XD, XS, XT)                                                \
-        muljs3rr(W(XD), W(XS), W(XT))
+/* fmr (G = G + S * T) if (#G != #S && #G != #T) */
 
-#define mulqs3ld(XD, XS, MT, DT)                                            \
-        muljs3ld(W(XD), W(XS), W(MT), W(DT))
+#ifndef fmrqs_rr
 
-/* div (G = G / S), (D = S / T) if (#D != #S) */
+#define fmrqs_rr(XG, XS, XT, mode)                                          \
+        FCTRL_ENTER_R(mode)                                                 \
+        fmaqs_rr(W(XG), W(XS), W(XT))                                       \
+        FCTRL_LEAVE_R(mode)
 
-#define divqs_rr(XG, XS)                                                    \
-        divjs_rr(W(XG), W(XS))
+#endif /* fmrqs_rr */
 
-#define divqs_ld(XG, MS, DS)                                                \
-        divjs_ld(W(XG), W(MS), W(DS))
+/******************************************************************************/
+/**** var-len **** SIMD transcendental meta-instructions (exp, log, pow) ******/
+/******************************************************************************/
 
-#define divqs3rr(XD, XS, XT)                                                \
-        divjs3rr(W(XD), W(XS), W(XT))
+/*
+ * Exponent and logarithm are built from plain var-len instructions, hence
+ * available on all targets. Polynomial coefficients are kept in the regs
+ * structure (reg_EXP*, reg_LOG*, reg_LN2*) addressed via inf_REGS, hence all
+ * of them destroy Reax (scratch). Full-precision versions (exp, log, pow)
+ * are within 2 ulps of libm (pow error grows with |T * log S|), estimates
+ * (exe, lge, pwe) are within 1e-3 relative and avoid divisions.
+ * Results of exp saturate at the normal range instead of overflowing.
+ */
 
-#define divqs3ld(XD, XS, MT, DT)                                            \
-        divjs3ld(W(XD), W(XS), W(MT), W(DT))
+/* exp (D = exp S), full precision, clamped to normal range */
+
+#define expos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        exeos_rx(W(XD), W(X1), W(X2), W(XS))                                \
+        mulos_ld(W(X2), Iebp, reg_LN2LO_32)                                 \
+        subos_rr(W(XD), W(X2))                                              \
+        movox_rr(W(X2), W(XD))   /* c = r - r^2 * P(r^2) */                 \
+        mulos_rr(W(X2), W(XD))                                              \
+        mulos_ld(W(X2), Iebp, reg_EXPP2_32)                                 \
+        addos_ld(W(X2), Iebp, reg_EXPP1_32)                                 \
+        mulos_rr(W(X2), W(XD))                                              \
+        mulos_rr(W(X2), W(XD))                                              \
+        subos_rr(W(X2), W(XD))   /* -c */                                   \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        addos_rr(W(XD), W(XD))   /* exp(r) = 1 + 2r / (2 - c) */            \
+        divos_rr(W(XD), W(X2))                                              \
+        addos_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        addox_rr(W(XD), W(X1))   /* scale by 2^k */
+
+#define exeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        exeos_rx(W(XD), W(X1), W(X2), W(XS))                                \
+        movox_rr(W(X2), W(XD))   /* exp(r) ~= 1 + r + r^2/2 + r^3/6 */      \
+        mulos_ld(W(X2), Iebp, reg_EXPP1_32)                                 \
+        subos_ld(W(X2), Mebp, inf_GPC02_32)                                 \
+        mulos_rr(W(X2), W(XD))                                              \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        mulos_rr(W(XD), W(X2))                                              \
+        addos_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        addox_rr(W(XD), W(X1))   /* scale by 2^k */
+
+#define exeos_rx(XD, X1, X2, XS) /* not portable, do not use outside */     \
+        movox_rr(W(XD), W(XS))                                              \
+        minos_ld(W(XD), Iebp, reg_EXPHI_32)                                 \
+        maxos_ld(W(XD), Iebp, reg_EXPLO_32)                                 \
+        movox_rr(W(X1), W(XD))   /* k = round(x / ln(2)) */                 \
+        mulos_ld(W(X1), Iebp, reg_LOG2E_32)                                 \
+        rnnos_rr(W(X1), W(X1))                                              \
+        movox_rr(W(X2), W(X1))   /* r = x - k * ln(2) */                    \
+        mulos_ld(W(X2), Iebp, reg_LN2HI_32)                                 \
+        subos_rr(W(XD), W(X2))                                              \
+        movox_rr(W(X2), W(X1))                                              \
+        cvzos_rr(W(X1), W(X1))   /* k << mantissa-width */                  \
+        shlox_ri(W(X1), IB(23))
+
+/* log (D = log S), full precision, S is positive, normal */
+
+#define logos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        lgxos_rx(W(XD), W(X1), W(XS))                                       \
+        divos_rr(W(XD), W(X1))   /* s = f / (2 + f) */                      \
+        movox_rr(W(X1), W(XD))                                              \
+        mulos_rr(W(X1), W(XD))   /* z = s^2 */                              \
+        movox_rr(W(X2), W(X1))   /* log(1 + f) = s * (2 + R(z)) */          \
+        mulos_ld(W(X2), Iebp, reg_LOGL4_32)                                 \
+        addos_ld(W(X2), Iebp, reg_LOGL3_32)                                 \
+        mulos_rr(W(X2), W(X1))                                              \
+        addos_ld(W(X2), Iebp, reg_LOGL2_32)                                 \
+        mulos_rr(W(X2), W(X1))                                              \
+        addos_ld(W(X2), Iebp, reg_LOGL1_32)                                 \
+        mulos_rr(W(X2), W(X1))                                              \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        mulos_rr(W(XD), W(X2))                                              \
+        lgkos_rx(W(XD), W(X1), W(X2), W(XS))
+
+#define lgeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        lgxos_rx(W(XD), W(X1), W(XS))                                       \
+        rceos_rr(W(X2), W(X1))   /* s ~= f * rcp(2 + f) */                  \
+        mulos_rr(W(XD), W(X2))                                              \
+        movox_rr(W(X2), W(XD))   /* log(1 + f) ~= s * (2 + L1 * s^2) */     \
+        mulos_rr(W(X2), W(XD))                                              \
+        mulos_ld(W(X2), Iebp, reg_LOGL1_32)                                 \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        addos_ld(W(X2), Mebp, inf_GPC01_32)                                 \
+        mulos_rr(W(XD), W(X2))                                              \
+        lgkos_rx(W(XD), W(X1), W(X2), W(XS))
+
+#define lgxos_rx(XD, X1, XS) /* not portable, do not use outside */         \
+        movox_rr(W(XD), W(XS))   /* m in [sqrt(0.5), sqrt(2)) */            \
+        addox_ld(W(XD), Mebp, inf_GPC05_32)                                 \
+        subox_ld(W(XD), Iebp, reg_SQRTH_32)                                 \
+        movox_rr(W(X1), W(XD))                                              \
+        shrox_ri(W(X1), IB(23))                                             \
+        shlox_ri(W(X1), IB(23))                                             \
+        subox_rr(W(XD), W(X1))                                              \
+        addox_ld(W(XD), Iebp, reg_SQRTH_32)                                 \
+        subos_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        movox_rr(W(X1), W(XD))   /* f = m - 1, X1 = 2 + f */                \
+        addos_ld(W(X1), Mebp, inf_GPC01_32)                                 \
+        addos_ld(W(X1), Mebp, inf_GPC01_32)
+
+#define lgkos_rx(XG, X1, X2, XS) /* not portable, do not use outside */     \
+        movox_rr(W(X1), W(XS))   /* G += k * ln(2), k = exponent of S */    \
+        subox_ld(W(X1), Iebp, reg_SQRTH_32)                                 \
+        shron_ri(W(X1), IB(23))                                             \
+        cvnon_rr(W(X1), W(X1))                                              \
+        movox_rr(W(X2), W(X1))                                              \
+        mulos_ld(W(X2), Iebp, reg_LN2LO_32)                                 \
+        addos_rr(W(XG), W(X2))                                              \
+        mulos_ld(W(X1), Iebp, reg_LN2HI_32)                                 \
+        addos_rr(W(XG), W(X1))
+
+/* pow (D = S ^ T) if (#D != #S && #D != #T), S is positive, normal */
+
+#define powos_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        logos_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        mulos_rr(W(XD), W(XT))                                              \
+        expos_rr(W(XD), W(X1), W(X2), W(XD))
+
+#define pweos_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        lgeos_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        mulos_rr(W(XD), W(XT))                                              \
+        exeos_rr(W(XD), W(X1), W(X2), W(XD))
+
+/* exp (D = exp S), full precision, clamped to normal range */
+
+#define expqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        exeqs_rx(W(XD), W(X1), W(X2), W(XS))                                \
+        mulqs_ld(W(X2), Iebp, reg_LN2LO_64)                                 \
+        subqs_rr(W(XD), W(X2))                                              \
+        movqx_rr(W(X2), W(XD))   /* c = r - r^2 * P(r^2) */                 \
+        mulqs_rr(W(X2), W(XD))                                              \
+        mulqs_ld(W(X2), Iebp, reg_EXPP5_64)                                 \
+        addqs_ld(W(X2), Iebp, reg_EXPP4_64)                                 \
+        mulqs_rr(W(X2), W(XD))                                              \
+        mulqs_rr(W(X2), W(XD))                                              \
+        addqs_ld(W(X2), Iebp, reg_EXPP3_64)                                 \
+        mulqs_rr(W(X2), W(XD))                                              \
+        mulqs_rr(W(X2), W(XD))                                              \
+        addqs_ld(W(X2), Iebp, reg_EXPP2_64)                                 \
+        mulqs_rr(W(X2), W(XD))                                              \
+        mulqs_rr(W(X2), W(XD))                                              \
+        addqs_ld(W(X2), Iebp, reg_EXPP1_64)                                 \
+        mulqs_rr(W(X2), W(XD))                                              \
+        mulqs_rr(W(X2), W(XD))                                              \
+        subqs_rr(W(X2), W(XD))   /* -c */                                   \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        addqs_rr(W(XD), W(XD))   /* exp(r) = 1 + 2r / (2 - c) */            \
+        divqs_rr(W(XD), W(X2))                                              \
+        addqs_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        addqx_rr(W(XD), W(X1))   /* scale by 2^k */
+
+#define exeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        exeqs_rx(W(XD), W(X1), W(X2), W(XS))                                \
+        movqx_rr(W(X2), W(XD))   /* exp(r) ~= 1 + r + r^2/2 + r^3/6 */      \
+        mulqs_ld(W(X2), Iebp, reg_EXPP1_64)                                 \
+        subqs_ld(W(X2), Mebp, inf_GPC02_64)                                 \
+        mulqs_rr(W(X2), W(XD))                                              \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        mulqs_rr(W(XD), W(X2))                                              \
+        addqs_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        addqx_rr(W(XD), W(X1))   /* scale by 2^k */
+
+#define exeqs_rx(XD, X1, X2, XS) /* not portable, do not use outside */     \
+        movqx_rr(W(XD), W(XS))                                              \
+        minqs_ld(W(XD), Iebp, reg_EXPHI_64)                                 \
+        maxqs_ld(W(XD), Iebp, reg_EXPLO_64)                                 \
+        movqx_rr(W(X1), W(XD))   /* k = round(x / ln(2)) */                 \
+        mulqs_ld(W(X1), Iebp, reg_LOG2E_64)                                 \
+        rnnqs_rr(W(X1), W(X1))                                              \
+        movqx_rr(W(X2), W(X1))   /* r = x - k * ln(2) */                    \
+        mulqs_ld(W(X2), Iebp, reg_LN2HI_64)                                 \
+        subqs_rr(W(XD), W(X2))                                              \
+        movqx_rr(W(X2), W(X1))                                              \
+        cvzqs_rr(W(X1), W(X1))   /* k << mantissa-width */                  \
+        shlqx_ri(W(X1), IB(52))
+
+/* log (D = log S), full precision, S is positive, normal */
+
+#define logqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        lgxqs_rx(W(XD), W(X1), W(XS))                                       \
+        divqs_rr(W(XD), W(X1))   /* s = f / (2 + f) */                      \
+        movqx_rr(W(X1), W(XD))                                              \
+        mulqs_rr(W(X1), W(XD))   /* z = s^2 */                              \
+        movqx_rr(W(X2), W(X1))   /* log(1 + f) = s * (2 + R(z)) */          \
+        mulqs_ld(W(X2), Iebp, reg_LOGL7_64)                                 \
+        addqs_ld(W(X2), Iebp, reg_LOGL6_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_LOGL5_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_LOGL4_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_LOGL3_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_LOGL2_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_LOGL1_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        mulqs_rr(W(XD), W(X2))                                              \
+        lgkqs_rx(W(XD), W(X1), W(X2), W(XS))
+
+#define lgeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        lgxqs_rx(W(XD), W(X1), W(XS))                                       \
+        rceqs_rr(W(X2), W(X1))   /* s ~= f * rcp(2 + f) */                  \
+        mulqs_rr(W(XD), W(X2))                                              \
+        movqx_rr(W(X2), W(XD))   /* log(1 + f) ~= s * (2 + L1 * s^2) */     \
+        mulqs_rr(W(X2), W(XD))                                              \
+        mulqs_ld(W(X2), Iebp, reg_LOGL1_64)                                 \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        addqs_ld(W(X2), Mebp, inf_GPC01_64)                                 \
+        mulqs_rr(W(XD), W(X2))                                              \
+        lgkqs_rx(W(XD), W(X1), W(X2), W(XS))
+
+#define lgxqs_rx(XD, X1, XS) /* not portable, do not use outside */         \
+        movqx_rr(W(XD), W(XS))   /* m in [sqrt(0.5), sqrt(2)) */            \
+        addqx_ld(W(XD), Mebp, inf_GPC05_64)                                 \
+        subqx_ld(W(XD), Iebp, reg_SQRTH_64)                                 \
+        movqx_rr(W(X1), W(XD))                                              \
+        shrqx_ri(W(X1), IB(52))                                             \
+        shlqx_ri(W(X1), IB(52))                                             \
+        subqx_rr(W(XD), W(X1))                                              \
+        addqx_ld(W(XD), Iebp, reg_SQRTH_64)                                 \
+        subqs_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        movqx_rr(W(X1), W(XD))   /* f = m - 1, X1 = 2 + f */                \
+        addqs_ld(W(X1), Mebp, inf_GPC01_64)                                 \
+        addqs_ld(W(X1), Mebp, inf_GPC01_64)
+
+#define lgkqs_rx(XG, X1, X2, XS) /* not portable, do not use outside */     \
+        movqx_rr(W(X1), W(XS))   /* G += k * ln(2), k = exponent of S */    \
+        subqx_ld(W(X1), Iebp, reg_SQRTH_64)                                 \
+        shrqn_ri(W(X1), IB(52))                                             \
+        cvnqn_rr(W(X1), W(X1))                                              \
+        movqx_rr(W(X2), W(X1))                                              \
+        mulqs_ld(W(X2), Iebp, reg_LN2LO_64)                                 \
+        addqs_rr(W(XG), W(X2))                                              \
+        mulqs_ld(W(X1), Iebp, reg_LN2HI_64)                                 \
+        addqs_rr(W(XG), W(X1))
 
-/* sqr (D = sqrt S) */
+/* pow (D = S ^ T) if (#D != #S && #D != #T), S is positive, normal */
 
-#define sqrqs_rr(XD, XS)                                                    \
-        sqrjs_rr(W(XD), W(XS))
+#define powqs_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        logqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        mulqs_rr(W(XD), W(XT))                                              \
+        expqs_rr(W(XD), W(X1), W(X2), W(XD))
 
-#define sqrqs_ld(XD, MS, DS)                                                \
-        sqrjs_ld(W(XD), W(MS), W(DS))
+#define pweqs_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        lgeqs_rr(W(XD), W(X1), W(X2), W(XS))                                \
+        mulqs_rr(W(XD), W(XT))                                              \
+        exeqs_rr(W(XD), W(X1), W(X2), W(XD))
 
-/* cbr (D = cbrt S) */
+/******************************************************************************/
+/**** var-len **** SIMD trigonometric meta-instructions (sin, cos, atan2) *****/
+/******************************************************************************/
 
-#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbrjs_rr(W(XD), W(X1), W(X2), W(XS))
+/*
+ * Sine, cosine and arctangent are built from plain var-len instructions,
+ * hence available on all targets. Arguments of sin/cos are reduced by
+ * k * pi/2 split in three parts (reg_PIO2*), subtracted with fms in fp32
+ * (exact with native or x87-fallback fms, see RT_SIMD_COMPAT_FMS) and with
+ * exact products in fp64, reduction range for |S| is 2^20 in both cases.
+ * Both polynomials (reg_SIN*, reg_COS*) are then evaluated and picked per
+ * quadrant, thus scs (sincos) costs about the same as either sin or cos.
+ * Arctangent reduces the ratio of |S| and |T| to |a| <= tan(pi/8) with
+ * a single division (reg_ATN*). Within the reduction range sin/cos are
+ * within 2 ulps of libm, atan2 is within 3 ulps. Constants are kept in the
+ * regs structure addressed via inf_REGS, hence all of them destroy Reax.
+ */
 
-#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbejs_rr(W(XD), W(X1), W(X2), W(XS))
+/* sin (D = sin S) if (#D != #S), |S| within reduction range */
+
+#define sinos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        scsos_rx(W(XD), W(X2), W(X1), W(XS))                                \
+        snsos_rx(W(XD), W(X1), W(XS))
+
+/* cos (D = cos S) if (#D != #S), |S| within reduction range */
+
+#define cosos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        scsos_rx(W(X2), W(XD), W(X1), W(XS))                                \
+        cssos_rx(W(XD), W(X1), W(XS))
+
+/* scs (D = sin S, E = cos S) if (#D != #S && #E != #S) */
+
+#define scsos_rr(XD, XE, X1, XS) /* destroys X1 (temp reg) */               \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        scsos_rx(W(XD), W(XE), W(X1), W(XS))                                \
+        snsos_rx(W(XD), W(X1), W(XS))                                       \
+        cssos_rx(W(XE), W(X1), W(XS))
+
+#define scsos_rx(XD, XE, X1, XS) /* not portable, do not use outside */     \
+        movox_rr(W(X1), W(XS))   /* k = round(x * 2/pi) */                  \
+        mulos_ld(W(X1), Iebp, reg_RPIO2_32)                                 \
+        rnnos_rr(W(X1), W(X1))                                              \
+        movox_rr(W(XD), W(XS))   /* r = x - k * pi/2 */                     \
+        movox_ld(W(XE), Iebp, reg_PIO21_32)                                 \
+        fmsos_rr(W(XD), W(X1), W(XE))                                       \
+        movox_ld(W(XE), Iebp, reg_PIO22_32)                                 \
+        fmsos_rr(W(XD), W(X1), W(XE))                                       \
+        movox_ld(W(XE), Iebp, reg_PIO23_32)                                 \
+        fmsos_rr(W(XD), W(X1), W(XE))                                       \
+        movox_rr(W(X1), W(XD))   /* z = r^2 */                              \
+        mulos_rr(W(X1), W(XD))                                              \
+        movox_rr(W(XE), W(X1))   /* sin(r) = r + r * z * S(z) */            \
+        mulos_ld(W(XE), Iebp, reg_SINP3_32)                                 \
+        addos_ld(W(XE), Iebp, reg_SINP2_32)                                 \
+        mulos_rr(W(XE), W(X1))                                              \
+        addos_ld(W(XE), Iebp, reg_SINP1_32)                                 \
+        mulos_rr(W(XE), W(X1))                                              \
+        mulos_rr(W(XE), W(XD))                                              \
+        addos_rr(W(XD), W(XE))                                              \
+        movox_rr(W(XE), W(X1))   /* cos(r) = 1 - z/2 + z^2 * C(z) */        \
+        mulos_ld(W(XE), Iebp, reg_COSP3_32)                                 \
+        addos_ld(W(XE), Iebp, reg_COSP2_32)                                 \
+        mulos_rr(W(XE), W(X1))                                              \
+        addos_ld(W(XE), Iebp, reg_COSP1_32)                                 \
+        mulos_rr(W(XE), W(X1))                                              \
+        addos_ld(W(XE), Mebp, inf_GPC02_32)                                 \
+        mulos_rr(W(XE), W(X1))                                              \
+        addos_ld(W(XE), Mebp, inf_GPC01_32)                                 \
+        movox_rr(W(X1), W(XS))   /* swap if k is odd */                     \
+        mulos_ld(W(X1), Iebp, reg_RPIO2_32)                                 \
+        cvnos_rr(W(X1), W(X1))                                              \
+        shlox_ri(W(X1), IB(31))                                             \
+        shron_ri(W(X1), IB(31))                                             \
+        xorox_rr(W(XD), W(XE))                                              \
+        andox_rr(W(X1), W(XD))                                              \
+        xorox_rr(W(XD), W(XE))                                              \
+        xorox_rr(W(XD), W(X1))                                              \
+        xorox_rr(W(XE), W(X1))
+
+#define snsos_rx(XG, X1, XS) /* not portable, do not use outside */         \
+        movox_rr(W(X1), W(XS))   /* negate if (k & 2) */                    \
+        mulos_ld(W(X1), Iebp, reg_RPIO2_32)                                 \
+        cvnos_rr(W(X1), W(X1))                                              \
+        shlox_ri(W(X1), IB(30))                                             \
+        andox_ld(W(X1), Mebp, inf_GPC06_32)                                 \
+        xorox_rr(W(XG), W(X1))
+
+#define cssos_rx(XG, X1, XS) /* not portable, do not use outside */         \
+        movox_rr(W(X1), W(XS))   /* negate if (k + 1 & 2) */                \
+        mulos_ld(W(X1), Iebp, reg_RPIO2_32)                                 \
+        rnnos_rr(W(X1), W(X1))                                              \
+        addos_ld(W(X1), Mebp, inf_GPC01_32)                                 \
+        cvnos_rr(W(X1), W(X1))                                              \
+        shlox_ri(W(X1), IB(30))                                             \
+        andox_ld(W(X1), Mebp, inf_GPC06_32)                                 \
+        xorox_rr(W(XG), W(X1))
+
+/* atn (D = atan2(S, T)) if (#D != #S && #D != #T), S, T finite, not both 0 */
+
+#define atnos_rr(XD, X1, X2, X3, XS, XT) /* destroys X1, X2, X3 */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        movox_rr(W(X1), W(XS))   /* a = min(|S|, |T|) / max(|S|, |T|) */    \
+        andox_ld(W(X1), Mebp, inf_GPC04_32)                                 \
+        movox_rr(W(X2), W(XT))                                              \
+        andox_ld(W(X2), Mebp, inf_GPC04_32)                                 \
+        movox_rr(W(XD), W(X1))                                              \
+        minos_rr(W(XD), W(X2))                                              \
+        maxos_rr(W(X1), W(X2))                                              \
+        movox_rr(W(X2), W(X1))   /* m = (a > tan(pi/8)) */                  \
+        mulos_ld(W(X2), Iebp, reg_TANP8_32)                                 \
+        cltos_rr(W(X2), W(XD))                                              \
+        movox_rr(W(X3), W(X2))   /* a = (a - 1) / (a + 1) if m */           \
+        andox_rr(W(X3), W(XD))                                              \
+        andox_rr(W(X2), W(X1))                                              \
+        addos_rr(W(X1), W(X3))                                              \
+        subos_rr(W(XD), W(X2))                                              \
+        divos_rr(W(XD), W(X1))                                              \
+        movox_rr(W(X1), W(XD))   /* atan(a) = a + a * z * A(z) */           \
+        mulos_rr(W(X1), W(XD))                                              \
+        movox_rr(W(X2), W(X1))                                              \
+        mulos_ld(W(X2), Iebp, reg_ATNP4_32)                                 \
+        addos_ld(W(X2), Iebp, reg_ATNP3_32)                                 \
+        mulos_rr(W(X2), W(X1))                                              \
+        addos_ld(W(X2), Iebp, reg_ATNP2_32)                                 \
+        mulos_rr(W(X2), W(X1))                                              \
+        addos_ld(W(X2), Iebp, reg_ATNP1_32)                                 \
+        mulos_rr(W(X2), W(X1))                                              \
+        mulos_rr(W(X2), W(XD))                                              \
+        addos_rr(W(XD), W(X2))                                              \
+        addox_ld(W(X3), Mebp, inf_GPC07)   /* + pi/4 if m */                \
+        shron_ri(W(X3), IB(31))                                             \
+        annox_ld(W(X3), Iebp, reg_PIO4_32)                                  \
+        addos_rr(W(XD), W(X3))                                              \
+        movox_rr(W(X1), W(XS))   /* pi/2 - D if |S| > |T| */                \
+        andox_ld(W(X1), Mebp, inf_GPC04_32)                                 \
+        movox_rr(W(X2), W(XT))                                              \
+        andox_ld(W(X2), Mebp, inf_GPC04_32)                                 \
+        cgtos_rr(W(X1), W(X2))                                              \
+        shlox_ri(W(X1), IB(31))                                             \
+        xorox_rr(W(XD), W(X1))                                              \
+        shron_ri(W(X1), IB(31))                                             \
+        andox_ld(W(X1), Iebp, reg_PIO2_32)                                  \
+        addos_rr(W(XD), W(X1))                                              \
+        movox_rr(W(X1), W(XT))   /* pi - D if T < 0 */                      \
+        andox_ld(W(X1), Mebp, inf_GPC06_32)                                 \
+        xorox_rr(W(XD), W(X1))                                              \
+        shron_ri(W(X1), IB(31))                                             \
+        andox_ld(W(X1), Iebp, reg_PI_32)                                    \
+        addos_rr(W(XD), W(X1))                                              \
+        movox_rr(W(X1), W(XS))   /* sign of S */                            \
+        andox_ld(W(X1), Mebp, inf_GPC06_32)                                 \
+        xorox_rr(W(XD), W(X1))
+
+/* sin (D = sin S) if (#D != #S), |S| within reduction range */
+
+#define sinqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        scsqs_rx(W(XD), W(X2), W(X1), W(XS))                                \
+        snsqs_rx(W(XD), W(X1), W(XS))
+
+/* cos (D = cos S) if (#D != #S), |S| within reduction range */
+
+#define cosqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        scsqs_rx(W(X2), W(XD), W(X1), W(XS))                                \
+        cssqs_rx(W(XD), W(X1), W(XS))
+
+/* scs (D = sin S, E = cos S) if (#D != #S && #E != #S) */
+
+#define scsqs_rr(XD, XE, X1, XS) /* destroys X1 (temp reg) */               \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        scsqs_rx(W(XD), W(XE), W(X1), W(XS))                                \
+        snsqs_rx(W(XD), W(X1), W(XS))                                       \
+        cssqs_rx(W(XE), W(X1), W(XS))
+
+#define scsqs_rx(XD, XE, X1, XS) /* not portable, do not use outside */     \
+        movqx_rr(W(X1), W(XS))   /* k = round(x * 2/pi) */                  \
+        mulqs_ld(W(X1), Iebp, reg_RPIO2_64)                                 \
+        rnnqs_rr(W(X1), W(X1))                                              \
+        movqx_rr(W(XD), W(XS))   /* r = x - k * pi/2 */                     \
+        movqx_rr(W(XE), W(X1))                                              \
+        mulqs_ld(W(XE), Iebp, reg_PIO21_64)                                 \
+        subqs_rr(W(XD), W(XE))                                              \
+        movqx_rr(W(XE), W(X1))                                              \
+        mulqs_ld(W(XE), Iebp, reg_PIO22_64)                                 \
+        subqs_rr(W(XD), W(XE))                                              \
+        mulqs_ld(W(X1), Iebp, reg_PIO23_64)                                 \
+        subqs_rr(W(XD), W(X1))                                              \
+        movqx_rr(W(X1), W(XD))   /* z = r^2 */                              \
+        mulqs_rr(W(X1), W(XD))                                              \
+        movqx_rr(W(XE), W(X1))   /* sin(r) = r + r * z * S(z) */            \
+        mulqs_ld(W(XE), Iebp, reg_SINP6_64)                                 \
+        addqs_ld(W(XE), Iebp, reg_SINP5_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_SINP4_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_SINP3_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_SINP2_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_SINP1_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        mulqs_rr(W(XE), W(XD))                                              \
+        addqs_rr(W(XD), W(XE))                                              \
+        movqx_rr(W(XE), W(X1))   /* cos(r) = 1 - z/2 + z^2 * C(z) */        \
+        mulqs_ld(W(XE), Iebp, reg_COSP6_64)                                 \
+        addqs_ld(W(XE), Iebp, reg_COSP5_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_COSP4_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_COSP3_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_COSP2_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Iebp, reg_COSP1_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Mebp, inf_GPC02_64)                                 \
+        mulqs_rr(W(XE), W(X1))                                              \
+        addqs_ld(W(XE), Mebp, inf_GPC01_64)                                 \
+        movqx_rr(W(X1), W(XS))   /* swap if k is odd */                     \
+        mulqs_ld(W(X1), Iebp, reg_RPIO2_64)                                 \
+        cvnqs_rr(W(X1), W(X1))                                              \
+        shlqx_ri(W(X1), IB(63))                                             \
+        shrqn_ri(W(X1), IB(63))                                             \
+        xorqx_rr(W(XD), W(XE))                                              \
+        andqx_rr(W(X1), W(XD))                                              \
+        xorqx_rr(W(XD), W(XE))                                              \
+        xorqx_rr(W(XD), W(X1))                                              \
+        xorqx_rr(W(XE), W(X1))
+
+#define snsqs_rx(XG, X1, XS) /* not portable, do not use outside */         \
+        movqx_rr(W(X1), W(XS))   /* negate if (k & 2) */                    \
+        mulqs_ld(W(X1), Iebp, reg_RPIO2_64)                                 \
+        cvnqs_rr(W(X1), W(X1))                                              \
+        shlqx_ri(W(X1), IB(62))                                             \
+        andqx_ld(W(X1), Mebp, inf_GPC06_64)                                 \
+        xorqx_rr(W(XG), W(X1))
+
+#define cssqs_rx(XG, X1, XS) /* not portable, do not use outside */         \
+        movqx_rr(W(X1), W(XS))   /* negate if (k + 1 & 2) */                \
+        mulqs_ld(W(X1), Iebp, reg_RPIO2_64)                                 \
+        rnnqs_rr(W(X1), W(X1))                                              \
+        addqs_ld(W(X1), Mebp, inf_GPC01_64)                                 \
+        cvnqs_rr(W(X1), W(X1))                                              \
+        shlqx_ri(W(X1), IB(62))                                             \
+        andqx_ld(W(X1), Mebp, inf_GPC06_64)                                 \
+        xorqx_rr(W(XG), W(X1))
+
+/* atn (D = atan2(S, T)) if (#D != #S && #D != #T), S, T finite, not both 0 */
+
+#define atnqs_rr(XD, X1, X2, X3, XS, XT) /* destroys X1, X2, X3 */          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        movqx_rr(W(X1), W(XS))   /* a = min(|S|, |T|) / max(|S|, |T|) */    \
+        andqx_ld(W(X1), Mebp, inf_GPC04_64)                                 \
+        movqx_rr(W(X2), W(XT))                                              \
+        andqx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
+        movqx_rr(W(XD), W(X1))                                              \
+        minqs_rr(W(XD), W(X2))                                              \
+        maxqs_rr(W(X1), W(X2))                                              \
+        movqx_rr(W(X2), W(X1))   /* m = (a > tan(pi/8)) */                  \
+        mulqs_ld(W(X2), Iebp, reg_TANP8_64)                                 \
+        cltqs_rr(W(X2), W(XD))                                              \
+        movqx_rr(W(X3), W(X2))   /* a = (a - 1) / (a + 1) if m */           \
+        andqx_rr(W(X3), W(XD))                                              \
+        andqx_rr(W(X2), W(X1))                                              \
+        addqs_rr(W(X1), W(X3))                                              \
+        subqs_rr(W(XD), W(X2))                                              \
+        divqs_rr(W(XD), W(X1))                                              \
+        movqx_rr(W(X1), W(XD))   /* atan(a) = a + a * z * A(z) */           \
+        mulqs_rr(W(X1), W(XD))                                              \
+        movqx_rr(W(X2), W(X1))                                              \
+        mulqs_ld(W(X2), Iebp, reg_ATNP11_64)                                \
+        addqs_ld(W(X2), Iebp, reg_ATNP10_64)                                \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP9_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP8_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP7_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP6_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP5_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP4_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP3_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP2_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        addqs_ld(W(X2), Iebp, reg_ATNP1_64)                                 \
+        mulqs_rr(W(X2), W(X1))                                              \
+        mulqs_rr(W(X2), W(XD))                                              \
+        addqs_rr(W(XD), W(X2))                                              \
+        addqx_ld(W(X3), Mebp, inf_GPC07)   /* + pi/4 if m */                \
+        shrqn_ri(W(X3), IB(63))                                             \
+        annqx_ld(W(X3), Iebp, reg_PIO4_64)                                  \
+        addqs_rr(W(XD), W(X3))                                              \
+        movqx_rr(W(X1), W(XS))   /* pi/2 - D if |S| > |T| */                \
+        andqx_ld(W(X1), Mebp, inf_GPC04_64)                                 \
+        movqx_rr(W(X2), W(XT))                                              \
+        andqx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
+        cgtqs_rr(W(X1), W(X2))                                              \
+        shlqx_ri(W(X1), IB(63))                                             \
+        xorqx_rr(W(XD), W(X1))                                              \
+        shrqn_ri(W(X1), IB(63))                                             \
+        andqx_ld(W(X1), Iebp, reg_PIO2_64)                                  \
+        addqs_rr(W(XD), W(X1))                                              \
+        movqx_rr(W(X1), W(XT))   /* pi - D if T < 0 */                      \
+        andqx_ld(W(X1), Mebp, inf_GPC06_64)                                 \
+        xorqx_rr(W(XD), W(X1))                                              \
+        shrqn_ri(W(X1), IB(63))                                             \
+        andqx_ld(W(X1), Iebp, reg_PI_64)                                    \
+        addqs_rr(W(XD), W(X1))                                              \
+        movqx_rr(W(X1), W(XS))   /* sign of S */                            \
+        andqx_ld(W(X1), Mebp, inf_GPC06_64)                                 \
+        xorqx_rr(W(XD), W(X1))
 
-#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbsjs_rr(W(XG), W(X1), W(X2), W(XS))
+/******************************************************************************/
+/**** var-len **** SIMD pseudo-random generator meta-instructions (xorshift*) */
+/******************************************************************************/
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/*
+ * Per-lane xorshift generators with multiplicative output scrambling,
+ * state is kept in a SIMD register by the caller (stored to memory between
+ * ASM blocks if needed), every lane is seeded with its own non-zero value.
+ * Upper bits of the scrambled state fill the mantissa of 1.0, then 1.0 is
+ * subtracted to get a uniform fp value in [0, 1), which is 23 (fp32) or
+ * 52 (fp64) bits of randomness. Shifts are (13, 17, 5) for 32-bit lanes
+ * (period 2^32 - 1) and (12, 25, 27) for 64-bit lanes (period 2^64 - 1),
+ * multipliers are kept in the regs structure (reg_RNGM*).
+ */
 
-#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
-        rcpjs_rr(W(XD), W(XS))
+/* rng (G = next state of G), state must be non-zero */
 
-#define rceqs_rr(XD, XS)                                                    \
-        rcejs_rr(W(XD), W(XS))
+#define rngox_rr(XG, X1) /* destroys X1 (temp reg) */                       \
+        movox_rr(W(X1), W(XG))   /* xorshift */                             \
+        shlox_ri(W(X1), IB(13))                                             \
+        xorox_rr(W(XG), W(X1))                                              \
+        movox_rr(W(X1), W(XG))                                              \
+        shrox_ri(W(X1), IB(17))                                             \
+        xorox_rr(W(XG), W(X1))                                              \
+        movox_rr(W(X1), W(XG))                                              \
+        shlox_ri(W(X1), IB(5))                                              \
+        xorox_rr(W(XG), W(X1))
+
+/* rng (G = next state of G, D = uniform [0, 1) from G) if (#D != #G)
+ * destroys Reax (scratch) */
+
+#define rngos_rr(XD, XG)                                                    \
+        rngox_rr(W(XG), W(XD))                                              \
+        movxx_ld(Reax, Mebp, inf_REGS)   /* scramble */                     \
+        subxx_rr(Reax, Rebp)                                                \
+        movox_ld(W(XD), Iebp, reg_RNGM_32)                                  \
+        mulox_rr(W(XD), W(XG))                                              \
+        shrox_ri(W(XD), IB(9))   /* 1.0 <= D < 2.0 */                       \
+        orrox_ld(W(XD), Mebp, inf_GPC05_32)                                 \
+        subos_ld(W(XD), Mebp, inf_GPC01_32)
+
+/* rng (G = next state of G), state must be non-zero */
+
+#define rngqx_rr(XG, X1) /* destroys X1 (temp reg) */                       \
+        movqx_rr(W(X1), W(XG))   /* xorshift */                             \
+        shrqx_ri(W(X1), IB(12))                                             \
+        xorqx_rr(W(XG), W(X1))                                              \
+        movqx_rr(W(X1), W(XG))                                              \
+        shlqx_ri(W(X1), IB(25))                                             \
+        xorqx_rr(W(XG), W(X1))                                              \
+        movqx_rr(W(X1), W(XG))                                              \
+        shrqx_ri(W(X1), IB(27))                                             \
+        xorqx_rr(W(XG), W(X1))
+
+/* rng (G = next state of G, D = uniform [0, 1) from G) if (#D != #G)
+ * destroys Reax (scratch) */
+
+#define rngqs_rr(XD, XG)                                                    \
+        rngqx_rr(W(XG), W(XD))                                              \
+        movxx_ld(Reax, Mebp, inf_REGS)   /* scramble */                     \
+        subxx_rr(Reax, Rebp)                                                \
+        movqx_ld(W(XD), Iebp, reg_RNGM_64)                                  \
+        mulqx_rr(W(XD), W(XG))                                              \
+        shrqx_ri(W(XD), IB(12))   /* 1.0 <= D < 2.0 */                      \
+        orrqx_ld(W(XD), Mebp, inf_GPC05_64)                                 \
+        subqs_ld(W(XD), Mebp, inf_GPC01_64)
 
-#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
-        rcsjs_rr(W(XG), W(XS))
+/******************************************************************************/
+/**** var-len **** SIMD fp16 storage loads/stores with fp32 conversion ********/
+/******************************************************************************/
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/*
+ * Half-precision data is kept in memory only (packed fp16 arithmetic in cmdm*
+ * is reserved), cvf loads S fp16 elements from half-width memory widening
+ * them to fp32 elements of D, or narrows fp32 elements of S storing them to
+ * half-width memory, which must be aligned to half of the SIMD width.
+ * Targets with native conversions (F16C on AVX2/FMA3, AVX-512, AArch64)
+ * define their own, elsewhere generic versions below move 16-bit elements
+ * between memory and inf_SCR01 via Reax/Redx with Redx preserved on the stack
+ * and convert them in registers, scaling by 2^112 to rebias the exponent.
+ * Widening is exact (unless fp16 denormals are flushed by the target),
+ * narrowing rounds as set by fp control register (in FCTRL blocks),
+ * overflows to inf and keeps nan (as quiet nan with unspecified payload).
+ */
 
-#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
-        rsqjs_rr(W(XD), W(XS))
+/* internal helpers (not for direct use in code) */
+
+#if RT_ENDIAN == 0
+
+#define hldrx_cx(op, dp)                                                    \
+        movwx_ld(Reax, Medx, DP(dp/2+0x00))                                 \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        op##_ri(Reax, IB(16))                                               \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        movwx_ld(Reax, Medx, DP(dp/2+0x04))                                 \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        op##_ri(Reax, IB(16))                                               \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x0C))
+
+#define hstrx_cx(op, dp)                                                    \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        op##_ri(Reax, IB(16))                                               \
+        orrwx_ld(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        movwx_st(Reax, Medx, DP(dp/2+0x00))                                 \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x0C))                            \
+        op##_ri(Reax, IB(16))                                               \
+        orrwx_ld(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        movwx_st(Reax, Medx, DP(dp/2+0x04))
+
+#else /* RT_ENDIAN == 1 */
+
+#define hldrx_cx(op, dp)                                                    \
+        movwx_ld(Reax, Medx, DP(dp/2+0x00))                                 \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        op##_ri(Reax, IB(16))                                               \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        movwx_ld(Reax, Medx, DP(dp/2+0x04))                                 \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x0C))                            \
+        op##_ri(Reax, IB(16))                                               \
+        movwx_st(Reax, Mebp, inf_SCR01(dp+0x08))
+
+#define hstrx_cx(op, dp)                                                    \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x00))                            \
+        op##_ri(Reax, IB(16))                                               \
+        orrwx_ld(Reax, Mebp, inf_SCR01(dp+0x04))                            \
+        movwx_st(Reax, Medx, DP(dp/2+0x00))                                 \
+        movwx_ld(Reax, Mebp, inf_SCR01(dp+0x08))                            \
+        op##_ri(Reax, IB(16))                                               \
+        orrwx_ld(Reax, Mebp, inf_SCR01(dp+0x0C))                            \
+        movwx_st(Reax, Medx, DP(dp/2+0x04))
+
+#endif /* RT_ENDIAN */
+
+/* cvf (D = fp16-to-fp32 S), loads half-width memory
+ * uses Xmm0 as temp register, destroys Xmm0, Reax (scratch), XD != Xmm0 */
+
+#ifndef cvfos_ld
+
+#define cvfos_ld(XD, MS, DS)                                                \
+        stack_st(Redx)                                                      \
+        adrxx_ld(Redx, W(MS), W(DS))                                        \
+        elmxx_xx(hldrx_cx, shrwx)                                           \
+        stack_ld(Redx)                                                      \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shlox_ri(W(XD), IB(16))   /* sign, exponent, mantissa */            \
+        shron_ri(W(XD), IB(3))                                              \
+        andox_ld(W(XD), Iebp, reg_HLF01_32)                                 \
+        mulos_ld(W(XD), Iebp, reg_HLF02_32)                                 \
+        movox_rr(Xmm0, W(XD))   /* inf/nan: max exponent */                 \
+        andox_ld(Xmm0, Mebp, inf_GPC04_32)                                  \
+        cgeos_ld(Xmm0, Iebp, reg_HLF03_32)                                  \
+        andox_ld(Xmm0, Iebp, reg_HLF04_32)                                  \
+        orrox_rr(W(XD), Xmm0)
+
+#endif /* cvfos_ld */
+
+/* cvf (D = fp32-to-fp16 S), stores half-width memory
+ * uses Xmm0 as temp register, destroys Xmm0, XS, Reax (scratch) */
+
+#ifndef cvfos_st
+
+#define cvfos_st(XS, MD, DD)                                                \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_rr(Xmm0, W(XS))   /* rounding bias */                         \
+        andox_ld(Xmm0, Iebp, reg_HLF04_32)                                  \
+        maxos_ld(Xmm0, Iebp, reg_HLF06_32)                                  \
+        mulos_ld(Xmm0, Iebp, reg_HLF07_32)                                  \
+        andox_ld(W(XS), Mebp, inf_GPC04_32)                                 \
+        mulos_ld(W(XS), Iebp, reg_HLF02_32)   /* overflow to inf */         \
+        mulos_ld(W(XS), Iebp, reg_HLF05_32)                                 \
+        addos_rr(W(XS), Xmm0)                                               \
+        movox_ld(Xmm0, Mebp, inf_SCR02(0))   /* sign */                     \
+        andox_ld(Xmm0, Mebp, inf_GPC06_32)                                  \
+        orrox_rr(W(XS), Xmm0)                                               \
+        movox_ld(Xmm0, Mebp, inf_SCR02(0))   /* nan */                      \
+        ceqos_rr(Xmm0, Xmm0)                                                \
+        andox_rr(W(XS), Xmm0)                                               \
+        annox_ld(Xmm0, Iebp, reg_HLF08_32)                                  \
+        orrox_rr(W(XS), Xmm0)                                               \
+        movox_rr(Xmm0, W(XS))   /* exponent + mantissa */                   \
+        shrox_ri(Xmm0, IB(13))                                              \
+        andox_ld(Xmm0, Iebp, reg_HLF09_32)                                  \
+        andox_ld(W(XS), Iebp, reg_HLF10_32)                                 \
+        addox_rr(W(XS), Xmm0)                                               \
+        movox_rr(Xmm0, W(XS))   /* sign to bit 15 */                        \
+        shrox_ri(Xmm0, IB(16))                                              \
+        shlox_ri(W(XS), IB(1))                                              \
+        shrox_ri(W(XS), IB(1))                                              \
+        orrox_rr(W(XS), Xmm0)                                               \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Redx)                                                      \
+        adrxx_ld(Redx, W(MD), W(DD))                                        \
+        elmxx_xx(hstrx_cx, shlwx)                                           \
+        stack_ld(Redx)
 
-#define rseqs_rr(XD, XS)                                                    \
-        rsejs_rr(W(XD), W(XS))
+#endif /* cvfos_st */
 
-#define rssqs_rr(XG, XS) /* destroys XS */                                  \
-        rssjs_rr(W(XG), W(XS))
+/******************************************************************************/
+/**** var-len **** SIMD sub-word integer subset (16-bit and byte elements) ****/
+/******************************************************************************/
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+/*
+ * Sub-word integer elements are kept in regular SIMD registers, cmdm*_** is
+ * the var-len subset (as cmdo*_**), cmdg*_** and cmda*_** are its fixed-size
+ * 128/256-bit counterparts (as cmdi*_** and cmdc*_** for 32-bit elements).
+ * For 16-bit elements arithmetic is wrap-around (add, sub), saturating (ads,
+ * sbs) or rounded average (avg), unsigned (x) or signed (n), while min/max
+ * are signed (n) only. Byte elements are unsigned (b) only, as used for 8-bit
+ * image channels. Widening from bytes (cvl, cvh) zero/sign-extends lower or
+ * upper half of S to 16-bit, narrowing (cvs) packs two registers back into
+ * bytes with unsigned saturation, so a regular SIMD load followed by cvl/cvh
+ * serves as a widening load.
+ * The subset is native on SSE2, AVX2, AVX-512BW, NEON, MSA and VMX/VSX,
+ * AVX1 and AVX-512F (KNL) go through SIMD halves in inf_SCR01/inf_SCR02,
+ * paired/quaded backends (except AArch64) widen/narrow via scratch as well.
+ * Legacy x86 targets (rtarch_x86_*.h) don't define it, check with #ifdef.
+ */
 
-#define fmaqs_rr(XG, XS, XT)                                                \
-        fmajs_rr(W(XG), W(XS), W(XT))
+#if   (RT_SIMD == 256) && (defined addax_rr)
 
-#define fmaqs_ld(XG, XS, MT, DT)                                            \
-        fmajs_ld(W(XG), W(XS), W(MT), W(DT))
+/* add (G = G + S), (D = S + T) if (#D != #S) */
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define addmx_rr(XG, XS)                                                    \
+        addax_rr(W(XG), W(XS))
 
-#define fmsqs_rr(XG, XS, XT)                                                \
-        fmsjs_rr(W(XG), W(XS), W(XT))
+#define addmx_ld(XG, MS, DS)                                                \
+        addax_ld(W(XG), W(MS), W(DS))
 
-#define fmsqs_ld(XG, XS, MT, DT)                                            \
-        fmsjs_ld(W(XG), W(XS), W(MT), W(DT))
+#define addmx3rr(XD, XS, XT)                                                \
+        addax3rr(W(XD), W(XS), W(XT))
 
-/*************   packed double-precision floating-point compare   *************/
+#define addmx3ld(XD, XS, MT, DT)                                            \
+        addax3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
 
-#define minqs_rr(XG, XS)                                                    \
-        minjs_rr(W(XG), W(XS))
+#define submx_rr(XG, XS)                                                    \
+        subax_rr(W(XG), W(XS))
 
-#define minqs_ld(XG, MS, DS)                                                \
-        minjs_ld(W(XG), W(MS), W(DS))
+#define submx_ld(XG, MS, DS)                                                \
+        subax_ld(W(XG), W(MS), W(DS))
 
-#define minqs3rr(XD, XS, XT)                                                \
-        minjs3rr(W(XD), W(XS), W(XT))
+#define submx3rr(XD, XS, XT)                                                \
+        subax3rr(W(XD), W(XS), W(XT))
 
-#define minqs3ld(XD, XS, MT, DT)                                            \
-        minjs3ld(W(XD), W(XS), W(MT), W(DT))
+#define submx3ld(XD, XS, MT, DT)                                            \
+        subax3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
 
-#define maxqs_rr(XG, XS)                                                    \
-        maxjs_rr(W(XG), W(XS))
+#define adsmx_rr(XG, XS)                                                    \
+        adsax_rr(W(XG), W(XS))
 
-#define maxqs_ld(XG, MS, DS)                                                \
-        maxjs_ld(W(XG), W(MS), W(DS))
+#define adsmx_ld(XG, MS, DS)                                                \
+        adsax_ld(W(XG), W(MS), W(DS))
 
-#define maxqs3rr(XD, XS, XT)                                                \
-        maxjs3rr(W(XD), W(XS), W(XT))
+#define adsmx3rr(XD, XS, XT)                                                \
+        adsax3rr(W(XD), W(XS), W(XT))
 
-#define maxqs3ld(XD, XS, MT, DT)                                            \
-        maxjs3ld(W(XD), W(XS), W(MT), W(DT))
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+        adsax3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
 
-#define ceqqs_rr(XG, XS)                                                    \
-        ceqjs_rr(W(XG), W(XS))
+#define adsmn_rr(XG, XS)                                                    \
+        adsan_rr(W(XG), W(XS))
 
-#define ceqqs_ld(XG, MS, DS)                                                \
-        ceqjs_ld(W(XG), W(MS), W(DS))
+#define adsmn_ld(XG, MS, DS)                                                \
+        adsan_ld(W(XG), W(MS), W(DS))
 
-#define ceqqs3rr(XD, XS, XT)                                                \
-        ceqjs3rr(W(XD), W(XS), W(XT))
+#define adsmn3rr(XD, XS, XT)                                                \
+        adsan3rr(W(XD), W(XS), W(XT))
 
-#define ceqqs3ld(XD, XS, MT, DT)                                            \
-        ceqjs3ld(W(XD), W(XS), W(MT), W(DT))
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+        adsan3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
 
-#define cneqs_rr(XG, XS)                                                    \
-        cnejs_rr(W(XG), W(XS))
+#define sbsmx_rr(XG, XS)                                                    \
+        sbsax_rr(W(XG), W(XS))
 
-#define cneqs_ld(XG, MS, DS)                                                \
-        cnejs_ld(W(XG), W(MS), W(DS))
+#define sbsmx_ld(XG, MS, DS)                                                \
+        sbsax_ld(W(XG), W(MS), W(DS))
 
-#define cneqs3rr(XD, XS, XT)                                                \
-        cnejs3rr(W(XD), W(XS), W(XT))
+#define sbsmx3rr(XD, XS, XT)                                                \
+        sbsax3rr(W(XD), W(XS), W(XT))
 
-#define cneqs3ld(XD, XS, MT, DT)                                            \
-        cnejs3ld(W(XD), W(XS), W(MT), W(DT))
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+        sbsax3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
 
-#define cltqs_rr(XG, XS)                                                    \
-        cltjs_rr(W(XG), W(XS))
+#define sbsmn_rr(XG, XS)                                                    \
+        sbsan_rr(W(XG), W(XS))
 
-#define cltqs_ld(XG, MS, DS)                                                \
-        cltjs_ld(W(XG), W(MS), W(DS))
+#define sbsmn_ld(XG, MS, DS)                                                \
+        sbsan_ld(W(XG), W(MS), W(DS))
 
-#define cltqs3rr(XD, XS, XT)                                                \
-        cltjs3rr(W(XD), W(XS), W(XT))
+#define sbsmn3rr(XD, XS, XT)                                                \
+        sbsan3rr(W(XD), W(XS), W(XT))
 
-#define cltqs3ld(XD, XS, MT, DT)                                            \
-        cltjs3ld(W(XD), W(XS), W(MT), W(DT))
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+        sbsan3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
 
-#define cleqs_rr(XG, XS)                                                    \
-        clejs_rr(W(XG), W(XS))
+#define avgmx_rr(XG, XS)                                                    \
+        avgax_rr(W(XG), W(XS))
 
-#define cleqs_ld(XG, MS, DS)                                                \
-        clejs_ld(W(XG), W(MS), W(DS))
+#define avgmx_ld(XG, MS, DS)                                                \
+        avgax_ld(W(XG), W(MS), W(DS))
 
-#define cleqs3rr(XD, XS, XT)                                                \
-        clejs3rr(W(XD), W(XS), W(XT))
+#define avgmx3rr(XD, XS, XT)                                                \
+        avgax3rr(W(XD), W(XS), W(XT))
 
-#define cleqs3ld(XD, XS, MT, DT)                                            \
-        clejs3ld(W(XD), W(XS), W(MT), W(DT))
+#define avgmx3ld(XD, XS, MT, DT)                                            \
+        avgax3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
 
-#define cgtqs_rr(XG, XS)                                                    \
-        cgtjs_rr(W(XG), W(XS))
+#define minmn_rr(XG, XS)                                                    \
+        minan_rr(W(XG), W(XS))
 
-#define cgtqs_ld(XG, MS, DS)                                                \
-        cgtjs_ld(W(XG), W(MS), W(DS))
+#define minmn_ld(XG, MS, DS)                                                \
+        minan_ld(W(XG), W(MS), W(DS))
 
-#define cgtqs3rr(XD, XS, XT)                                                \
-        cgtjs3rr(W(XD), W(XS), W(XT))
+#define minmn3rr(XD, XS, XT)                                                \
+        minan3rr(W(XD), W(XS), W(XT))
 
-#define cgtqs3ld(XD, XS, MT, DT)                                            \
-        cgtjs3ld(W(XD), W(XS), W(MT), W(DT))
+#define minmn3ld(XD, XS, MT, DT)                                            \
+        minan3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
 
-#define cgeqs_rr(XG, XS)                                                    \
-        cgejs_rr(W(XG), W(XS))
+#define maxmn_rr(XG, XS)                                                    \
+        maxan_rr(W(XG), W(XS))
 
-#define cgeqs_ld(XG, MS, DS)                                                \
-        cgejs_ld(W(XG), W(MS), W(DS))
+#define maxmn_ld(XG, MS, DS)                                                \
+        maxan_ld(W(XG), W(MS), W(DS))
 
-#define cgeqs3rr(XD, XS, XT)                                                \
-        cgejs3rr(W(XD), W(XS), W(XT))
+#define maxmn3rr(XD, XS, XT)                                                \
+        maxan3rr(W(XD), W(XS), W(XT))
 
-#define cgeqs3ld(XD, XS, MT, DT)                                            \
-        cgejs3ld(W(XD), W(XS), W(MT), W(DT))
+#define maxmn3ld(XD, XS, MT, DT)                                            \
+        maxan3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* mkj (jump to lb) if (S satisfies mask condition) */
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
 
-#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        mkjjx_rx(W(XS), mask, lb)
+#define addmb_rr(XG, XS)                                                    \
+        addab_rr(W(XG), W(XS))
 
-/*************   packed double-precision floating-point convert   *************/
+#define addmb_ld(XG, MS, DS)                                                \
+        addab_ld(W(XG), W(MS), W(DS))
 
-/* cvz (D = fp-to-signed-int S)
- * rounding mode is encoded directly (can be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define addmb3rr(XD, XS, XT)                                                \
+        addab3rr(W(XD), W(XS), W(XT))
 
-#define rnzqs_rr(XD, XS)     /* round towards zero */                       \
-        rnzjs_rr(W(XD), W(XS))
+#define addmb3ld(XD, XS, MT, DT)                                            \
+        addab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rnzqs_ld(XD, MS, DS) /* round towards zero */                       \
-        rnzjs_ld(W(XD), W(MS), W(DS))
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
 
-#define cvzqs_rr(XD, XS)     /* round towards zero */                       \
-        cvzjs_rr(W(XD), W(XS))
+#define submb_rr(XG, XS)                                                    \
+        subab_rr(W(XG), W(XS))
 
-#define cvzqs_ld(XD, MS, DS) /* round towards zero */                       \
-        cvzjs_ld(W(XD), W(MS), W(DS))
+#define submb_ld(XG, MS, DS)                                                \
+        subab_ld(W(XG), W(MS), W(DS))
 
-/* cvp (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define submb3rr(XD, XS, XT)                                                \
+        subab3rr(W(XD), W(XS), W(XT))
 
-#define rnpqs_rr(XD, XS)     /* round towards +inf */                       \
-        rnpjs_rr(W(XD), W(XS))
+#define submb3ld(XD, XS, MT, DT)                                            \
+        subab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rnpqs_ld(XD, MS, DS) /* round towards +inf */                       \
-        rnpjs_ld(W(XD), W(MS), W(DS))
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
 
-#define cvpqs_rr(XD, XS)     /* round towards +inf */                       \
-        cvpjs_rr(W(XD), W(XS))
+#define adsmb_rr(XG, XS)                                                    \
+        adsab_rr(W(XG), W(XS))
 
-#define cvpqs_ld(XD, MS, DS) /* round towards +inf */                       \
-        cvpjs_ld(W(XD), W(MS), W(DS))
+#define adsmb_ld(XG, MS, DS)                                                \
+        adsab_ld(W(XG), W(MS), W(DS))
 
-/* cvm (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define adsmb3rr(XD, XS, XT)                                                \
+        adsab3rr(W(XD), W(XS), W(XT))
 
-#define rnmqs_rr(XD, XS)     /* round towards -inf */                       \
-        rnmjs_rr(W(XD), W(XS))
+#define adsmb3ld(XD, XS, MT, DT)                                            \
+        adsab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rnmqs_ld(XD, MS, DS) /* round towards -inf */                       \
-        rnmjs_ld(W(XD), W(MS), W(DS))
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
 
-#define cvmqs_rr(XD, XS)     /* round towards -inf */                       \
-        cvmjs_rr(W(XD), W(XS))
+#define sbsmb_rr(XG, XS)                                                    \
+        sbsab_rr(W(XG), W(XS))
 
-#define cvmqs_ld(XD, MS, DS) /* round towards -inf */                       \
-        cvmjs_ld(W(XD), W(MS), W(DS))
+#define sbsmb_ld(XG, MS, DS)                                                \
+        sbsab_ld(W(XG), W(MS), W(DS))
 
-/* cvn (D = fp-to-signed-int S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks)
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define sbsmb3rr(XD, XS, XT)                                                \
+        sbsab3rr(W(XD), W(XS), W(XT))
 
-#define rnnqs_rr(XD, XS)     /* round towards near */                       \
-        rnnjs_rr(W(XD), W(XS))
+#define sbsmb3ld(XD, XS, MT, DT)                                            \
+        sbsab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rnnqs_ld(XD, MS, DS) /* round towards near */                       \
-        rnnjs_ld(W(XD), W(MS), W(DS))
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
 
-#define cvnqs_rr(XD, XS)     /* round towards near */                       \
-        cvnjs_rr(W(XD), W(XS))
+#define avgmb_rr(XG, XS)                                                    \
+        avgab_rr(W(XG), W(XS))
 
-#define cvnqs_ld(XD, MS, DS) /* round towards near */                       \
-        cvnjs_ld(W(XD), W(MS), W(DS))
+#define avgmb_ld(XG, MS, DS)                                                \
+        avgab_ld(W(XG), W(MS), W(DS))
 
-/* cvn (D = signed-int-to-fp S)
- * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+#define avgmb3rr(XD, XS, XT)                                                \
+        avgab3rr(W(XD), W(XS), W(XT))
 
-#define cvnqn_rr(XD, XS)     /* round towards near */                       \
-        cvnjn_rr(W(XD), W(XS))
+#define avgmb3ld(XD, XS, MT, DT)                                            \
+        avgab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cvnqn_ld(XD, MS, DS) /* round towards near */                       \
-        cvnjn_ld(W(XD), W(MS), W(DS))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
 
-/* cvt (D = fp-to-signed-int S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: ROUNDZ is not supported on pre-VSX Power systems, use cvz
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define minmb_rr(XG, XS)                                                    \
+        minab_rr(W(XG), W(XS))
 
-#define rndqs_rr(XD, XS)                                                    \
-        rndjs_rr(W(XD), W(XS))
+#define minmb_ld(XG, MS, DS)                                                \
+        minab_ld(W(XG), W(MS), W(DS))
 
-#define rndqs_ld(XD, MS, DS)                                                \
-        rndjs_ld(W(XD), W(MS), W(DS))
+#define minmb3rr(XD, XS, XT)                                                \
+        minab3rr(W(XD), W(XS), W(XT))
 
-#define cvtqs_rr(XD, XS)                                                    \
-        cvtjs_rr(W(XD), W(XS))
+#define minmb3ld(XD, XS, MT, DT)                                            \
+        minab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cvtqs_ld(XD, MS, DS)                                                \
-        cvtjs_ld(W(XD), W(MS), W(DS))
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
 
-/* cvt (D = signed-int-to-fp S)
- * rounding mode comes from fp control register (set in FCTRL blocks)
- * NOTE: only default ROUNDN is supported on pre-VSX Power systems */
+#define maxmb_rr(XG, XS)                                                    \
+        maxab_rr(W(XG), W(XS))
 
-#define cvtqn_rr(XD, XS)                                                    \
-        cvtjn_rr(W(XD), W(XS))
+#define maxmb_ld(XG, MS, DS)                                                \
+        maxab_ld(W(XG), W(MS), W(DS))
 
-#define cvtqn_ld(XD, MS, DS)                                                \
-        cvtjn_ld(W(XD), W(MS), W(DS))
+#define maxmb3rr(XD, XS, XT)                                                \
+        maxab3rr(W(XD), W(XS), W(XT))
 
-/* cvr (D = fp-to-signed-int S)
- * rounding mode is encoded directly (cannot be used in FCTRL blocks)
- * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
- * isn't always taken into account when used within full-IEEE ASM block
- * NOTE: due to compatibility with legacy targets, SIMD fp-to-int
- * round instructions are only accurate within 64-bit signed int range */
+#define maxmb3ld(XD, XS, MT, DT)                                            \
+        maxab3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rnrqs_rr(XD, XS, mode)                                              \
-        rnrjs_rr(W(XD), W(XS), mode)
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
 
-#define cvrqs_rr(XD, XS, mode)                                              \
-        cvrjs_rr(W(XD), W(XS), mode)
+#define cvlmx_rr(XD, XS)                                                    \
+        cvlax_rr(W(XD), W(XS))
 
-/************   packed double-precision integer arithmetic/shifts   ***********/
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#define cvlmn_rr(XD, XS)                                                    \
+        cvlan_rr(W(XD), W(XS))
 
-#define addqx_rr(XG, XS)                                                    \
-        addjx_rr(W(XG), W(XS))
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
 
-#define addqx_ld(XG, MS, DS)                                                \
-        addjx_ld(W(XG), W(MS), W(DS))
+#define cvhmx_rr(XD, XS)                                                    \
+        cvhax_rr(W(XD), W(XS))
 
-#define addqx3rr(XD, XS, XT)                                                \
-        addjx3rr(W(XD), W(XS), W(XT))
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
 
-#define addqx3ld(XD, XS, MT, DT)                                            \
-        addjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cvhmn_rr(XD, XS)                                                    \
+        cvhan_rr(W(XD), W(XS))
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
 
-#define subqx_rr(XG, XS)                                                    \
-        subjx_rr(W(XG), W(XS))
+#define cvsmb_rr(XD, XS, XT)                                                \
+        cvsab_rr(W(XD), W(XS), W(XT))
 
-#define subqx_ld(XG, MS, DS)                                                \
-        subjx_ld(W(XG), W(MS), W(DS))
+#elif (RT_SIMD == 128) && (defined addgx_rr)
 
-#define subqx3rr(XD, XS, XT)                                                \
-        subjx3rr(W(XD), W(XS), W(XT))
+/* add (G = G + S), (D = S + T) if (#D != #S) */
 
-#define subqx3ld(XD, XS, MT, DT)                                            \
-        subjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define addmx_rr(XG, XS)                                                    \
+        addgx_rr(W(XG), W(XS))
 
-/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define addmx_ld(XG, MS, DS)                                                \
+        addgx_ld(W(XG), W(MS), W(DS))
 
-#define shlqx_ri(XG, IS)                                                    \
-        shljx_ri(W(XG), W(IS))
+#define addmx3rr(XD, XS, XT)                                                \
+        addgx3rr(W(XD), W(XS), W(XT))
 
-#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shljx_ld(W(XG), W(MS), W(DS))
+#define addmx3ld(XD, XS, MT, DT)                                            \
+        addgx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define shlqx3ri(XD, XS, IT)                                                \
-        shljx3ri(W(XD), W(XS), W(IT))
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
 
-#define shlqx3ld(XD, XS, MT, DT)                                            \
-        shljx3ld(W(XD), W(XS), W(MT), W(DT))
+#define submx_rr(XG, XS)                                                    \
+        subgx_rr(W(XG), W(XS))
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define submx_ld(XG, MS, DS)                                                \
+        subgx_ld(W(XG), W(MS), W(DS))
 
-#define shrqx_ri(XG, IS)                                                    \
-        shrjx_ri(W(XG), W(IS))
+#define submx3rr(XD, XS, XT)                                                \
+        subgx3rr(W(XD), W(XS), W(XT))
 
-#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrjx_ld(W(XG), W(MS), W(DS))
+#define submx3ld(XD, XS, MT, DT)                                            \
+        subgx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define shrqx3ri(XD, XS, IT)                                                \
-        shrjx3ri(W(XD), W(XS), W(IT))
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
 
-#define shrqx3ld(XD, XS, MT, DT)                                            \
-        shrjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define adsmx_rr(XG, XS)                                                    \
+        adsgx_rr(W(XG), W(XS))
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define adsmx_ld(XG, MS, DS)                                                \
+        adsgx_ld(W(XG), W(MS), W(DS))
 
-#define shrqn_ri(XG, IS)                                                    \
-        shrjn_ri(W(XG), W(IS))
+#define adsmx3rr(XD, XS, XT)                                                \
+        adsgx3rr(W(XD), W(XS), W(XT))
 
-#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses 64-bit at given address */ \
-        shrjn_ld(W(XG), W(MS), W(DS))
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+        adsgx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define shrqn3ri(XD, XS, IT)                                                \
-        shrjn3ri(W(XD), W(XS), W(IT))
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
 
-#define shrqn3ld(XD, XS, MT, DT)                                            \
-        shrjn3ld(W(XD), W(XS), W(MT), W(DT))
+#define adsmn_rr(XG, XS)                                                    \
+        adsgn_rr(W(XG), W(XS))
 
-/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define adsmn_ld(XG, MS, DS)                                                \
+        adsgn_ld(W(XG), W(MS), W(DS))
 
-#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svljx_rr(W(XG), W(XS))
+#define adsmn3rr(XD, XS, XT)                                                \
+        adsgn3rr(W(XD), W(XS), W(XT))
 
-#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svljx_ld(W(XG), W(MS), W(DS))
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+        adsgn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define svlqx3rr(XD, XS, XT)                                                \
-        svljx3rr(W(XD), W(XS), W(XT))
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
 
-#define svlqx3ld(XD, XS, MT, DT)                                            \
-        svljx3ld(W(XD), W(XS), W(MT), W(DT))
+#define sbsmx_rr(XG, XS)                                                    \
+        sbsgx_rr(W(XG), W(XS))
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define sbsmx_ld(XG, MS, DS)                                                \
+        sbsgx_ld(W(XG), W(MS), W(DS))
 
-#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrjx_rr(W(XG), W(XS))
+#define sbsmx3rr(XD, XS, XT)                                                \
+        sbsgx3rr(W(XD), W(XS), W(XT))
 
-#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrjx_ld(W(XG), W(MS), W(DS))
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+        sbsgx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define svrqx3rr(XD, XS, XT)                                                \
-        svrjx3rr(W(XD), W(XS), W(XT))
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
 
-#define svrqx3ld(XD, XS, MT, DT)                                            \
-        svrjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define sbsmn_rr(XG, XS)                                                    \
+        sbsgn_rr(W(XG), W(XS))
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define sbsmn_ld(XG, MS, DS)                                                \
+        sbsgn_ld(W(XG), W(MS), W(DS))
 
-#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrjn_rr(W(XG), W(XS))
+#define sbsmn3rr(XD, XS, XT)                                                \
+        sbsgn3rr(W(XD), W(XS), W(XT))
 
-#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrjn_ld(W(XG), W(MS), W(DS))
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+        sbsgn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define svrqn3rr(XD, XS, XT)                                                \
-        svrjn3rr(W(XD), W(XS), W(XT))
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned */
 
-#define svrqn3ld(XD, XS, MT, DT)                                            \
-        svrjn3ld(W(XD), W(XS), W(MT), W(DT))
+#define avgmx_rr(XG, XS)                                                    \
+        avggx_rr(W(XG), W(XS))
 
-/*
- * common 128-bit floating-point SIMD instructions with 64-bit elements
- */
+#define avgmx_ld(XG, MS, DS)                                                \
+        avggx_ld(W(XG), W(MS), W(DS))
 
-/* cbr (D = cbrt S) */
+#define avgmx3rr(XD, XS, XT)                                                \
+        avggx3rr(W(XD), W(XS), W(XT))
 
-/*
- * Based on the original idea by Russell Borogove (kaleja[AT]estarcion[DOT]com)
- * available at http://www.musicdsp.org/showone.php?id=206
- * converted to S-way SIMD version by VectorChief.
- */
-#define cbrjs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        cbejs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsjs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsjs_rr(W(XD), W(X1), W(X2), W(XS))                                \
-        cbsjs_rr(W(XD), W(X1), W(X2), W(XS))
+#define avgmx3ld(XD, XS, MT, DT)                                            \
+        avggx3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define cbejs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        /* cube root estimate, the exponent is divided by three             \
-         * in such a way that remainder bits get shoved into                \
-         * the top of the normalized mantissa */                            \
-        movjx_ld(W(X2), Mebp, inf_GPC04_64)                                 \
-        movjx_rr(W(XD), W(XS))                                              \
-        andjx_rr(W(XD), W(X2))   /* exponent & mantissa in biased-127 */    \
-        subjx_ld(W(XD), Mebp, inf_GPC05_64) /* convert to 2's complement */ \
-        shrjn_ri(W(XD), IB(10))  /* XD / 1024 */                            \
-        movjx_rr(W(X1), W(XD))   /* XD * 341 (next 8 ops) */                \
-        shljx_ri(W(X1), IB(2))                                              \
-        addjx_rr(W(XD), W(X1))                                              \
-        shljx_ri(W(X1), IB(2))                                              \
-        addjx_rr(W(XD), W(X1))                                              \
-        shljx_ri(W(X1), IB(2))                                              \
-        addjx_rr(W(XD), W(X1))                                              \
-        shljx_ri(W(X1), IB(2))                                              \
-        addjx_rr(W(XD), W(X1))   /* XD * (341/1024) ~= XD * (0.333) */      \
-        addjx_ld(W(XD), Mebp, inf_GPC05_64) /* back to biased-127 */        \
-        andjx_rr(W(XD), W(X2))   /* remask exponent & mantissa */           \
-        annjx_rr(W(X2), W(XS))   /* original sign */                        \
-        orrjx_rr(W(XD), W(X2))   /* new exponent & mantissa, old sign */
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed */
 
-#define cbsjs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
-        movjx_rr(W(X1), W(XG))                                              \
-        muljs_rr(W(X1), W(XG))                                              \
-        movjx_rr(W(X2), W(X1))                                              \
-        muljs_ld(W(X1), Mebp, inf_GPC03_64)                                 \
-        rcejs_rr(W(X1), W(X1))                                              \
-        muljs_rr(W(X2), W(XG))                                              \
-        subjs_rr(W(X2), W(XS))                                              \
-        muljs_rr(W(X2), W(X1))                                              \
-        subjs_rr(W(XG), W(X2))
+#define minmn_rr(XG, XS)                                                    \
+        mingn_rr(W(XG), W(XS))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define minmn_ld(XG, MS, DS)                                                \
+        mingn_ld(W(XG), W(MS), W(DS))
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#define minmn3rr(XD, XS, XT)                                                \
+        mingn3rr(W(XD), W(XS), W(XT))
 
-#define rcpjs_rr(XD, XS) /* destroys XS */                                  \
-        rcejs_rr(W(XD), W(XS))                                              \
-        rcsjs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define minmn3ld(XD, XS, MT, DT)                                            \
+        mingn3ld(W(XD), W(XS), W(MT), W(DT))
 
-#elif RT_SIMD_COMPAT_RCP == 1
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed */
 
-#define rcpjs_rr(XD, XS) /* destroys XS */                                  \
-        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divjs_rr(W(XD), W(XS))
+#define maxmn_rr(XG, XS)                                                    \
+        maxgn_rr(W(XG), W(XS))
 
-#define rcejs_rr(XD, XS)                                                    \
-        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divjs_ld(W(XD), Mebp, inf_SCR02(0))
+#define maxmn_ld(XG, MS, DS)                                                \
+        maxgn_ld(W(XG), W(MS), W(DS))
 
-#define rcsjs_rr(XG, XS) /* destroys XS */
+#define maxmn3rr(XD, XS, XT)                                                \
+        maxgn3rr(W(XD), W(XS), W(XT))
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define maxmn3ld(XD, XS, MT, DT)                                            \
+        maxgn3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* add (G = G + S), (D = S + T) if (#D != #S) - byte-wise */
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#define addmb_rr(XG, XS)                                                    \
+        addgb_rr(W(XG), W(XS))
 
-#define rsqjs_rr(XD, XS) /* destroys XS */                                  \
-        rsejs_rr(W(XD), W(XS))                                              \
-        rssjs_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define addmb_ld(XG, MS, DS)                                                \
+        addgb_ld(W(XG), W(MS), W(DS))
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define addmb3rr(XD, XS, XT)                                                \
+        addgb3rr(W(XD), W(XS), W(XT))
 
-#define rsqjs_rr(XD, XS) /* destroys XS */                                  \
-        sqrjs_rr(W(XS), W(XS))                                              \
-        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divjs_rr(W(XD), W(XS))
+#define addmb3ld(XD, XS, MT, DT)                                            \
+        addgb3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rsejs_rr(XD, XS)                                                    \
-        sqrjs_rr(W(XD), W(XS))                                              \
-        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movjx_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divjs_ld(W(XD), Mebp, inf_SCR02(0))
+/* sub (G = G - S), (D = S - T) if (#D != #S) - byte-wise */
 
-#define rssjs_rr(XG, XS) /* destroys XS */
+#define submb_rr(XG, XS)                                                    \
+        subgb_rr(W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#define submb_ld(XG, MS, DS)                                                \
+        subgb_ld(W(XG), W(MS), W(DS))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#define submb3rr(XD, XS, XT)                                                \
+        subgb3rr(W(XD), W(XS), W(XT))
 
-#if RT_SIMD_COMPAT_FMA == 2
+#define submb3ld(XD, XS, MT, DT)                                            \
+        subgb3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define fmajs_rr(XG, XS, XT)                                                \
-        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        muljs_rr(W(XS), W(XT))                                              \
-        addjs_rr(W(XG), W(XS))                                              \
-        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned byte */
 
-#define fmajs_ld(XG, XS, MT, DT)                                            \
-        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        muljs_ld(W(XS), W(MT), W(DT))                                       \
-        addjs_rr(W(XG), W(XS))                                              \
-        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+#define adsmb_rr(XG, XS)                                                    \
+        adsgb_rr(W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define adsmb_ld(XG, MS, DS)                                                \
+        adsgb_ld(W(XG), W(MS), W(DS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define adsmb3rr(XD, XS, XT)                                                \
+        adsgb3rr(W(XD), W(XS), W(XT))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#define adsmb3ld(XD, XS, MT, DT)                                            \
+        adsgb3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define fmsjs_rr(XG, XS, XT)                                                \
-        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        muljs_rr(W(XS), W(XT))                                              \
-        subjs_rr(W(XG), W(XS))                                              \
-        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned byte */
 
-#define fmsjs_ld(XG, XS, MT, DT)                                            \
-        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        muljs_ld(W(XS), W(MT), W(DT))                                       \
-        subjs_rr(W(XG), W(XS))                                              \
-        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+#define sbsmb_rr(XG, XS)                                                    \
+        sbsgb_rr(W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#define sbsmb_ld(XG, MS, DS)                                                \
+        sbsgb_ld(W(XG), W(MS), W(DS))
 
-#endif /* RT_SIMD: 512, 256, 128 */
+#define sbsmb3rr(XD, XS, XT)                                                \
+        sbsgb3rr(W(XD), W(XS), W(XT))
 
-/******************************************************************************/
-/**** scalar ***** SIMD instructions with fixed-64-bit-element ****************/
-/******************************************************************************/
+#define sbsmb3ld(XD, XS, MT, DT)                                            \
+        sbsgb3ld(W(XD), W(XS), W(MT), W(DT))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* avg (G = G + S + 1 >> 1), (D = S + T + 1 >> 1) if (#D != #S)
+ * rounded average, unsigned byte */
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#define avgmb_rr(XG, XS)                                                    \
+        avggb_rr(W(XG), W(XS))
 
-#define rcpts_rr(XD, XS) /* destroys XS */                                  \
-        rcets_rr(W(XD), W(XS))                                              \
-        rcsts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define avgmb_ld(XG, MS, DS)                                                \
+        avggb_ld(W(XG), W(MS), W(DS))
 
-#elif RT_SIMD_COMPAT_RCP == 1
+#define avgmb3rr(XD, XS, XT)                                                \
+        avggb3rr(W(XD), W(XS), W(XT))
 
-#define rcpts_rr(XD, XS) /* destroys XS */                                  \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_rr(W(XD), W(XS))
+#define avgmb3ld(XD, XS, MT, DT)                                            \
+        avggb3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rcets_rr(XD, XS)                                                    \
-        movts_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_ld(W(XD), Mebp, inf_SCR02(0))
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned byte */
 
-#define rcsts_rr(XG, XS) /* destroys XS */
+#define minmb_rr(XG, XS)                                                    \
+        mingb_rr(W(XG), W(XS))
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define minmb_ld(XG, MS, DS)                                                \
+        mingb_ld(W(XG), W(MS), W(DS))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define minmb3rr(XD, XS, XT)                                                \
+        mingb3rr(W(XD), W(XS), W(XT))
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#define minmb3ld(XD, XS, MT, DT)                                            \
+        mingb3ld(W(XD), W(XS), W(MT), W(DT))
 
-#define rsqts_rr(XD, XS) /* destroys XS */                                  \
-        rsets_rr(W(XD), W(XS))                                              \
-        rssts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned byte */
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define maxmb_rr(XG, XS)                                                    \
+        maxgb_rr(W(XG), W(XS))
 
-#define rsqts_rr(XD, XS) /* destroys XS */                                  \
-        sqrts_rr(W(XS), W(XS))                                              \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_rr(W(XD), W(XS))
+#define maxmb_ld(XG, MS, DS)                                                \
+        maxgb_ld(W(XG), W(MS), W(DS))
 
-#define rsets_rr(XD, XS)                                                    \
-        sqrts_rr(W(XD), W(XS))                                              \
-        movts_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_ld(W(XD), Mebp, inf_SCR02(0))
+#define maxmb3rr(XD, XS, XT)                                                \
+        maxgb3rr(W(XD), W(XS), W(XT))
 
-#define rssts_rr(XG, XS) /* destroys XS */
+#define maxmb3ld(XD, XS, MT, DT)                                            \
+        maxgb3ld(W(XD), W(XS), W(MT), W(DT))
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+/* cvl (D = byte-to-half lower half of S) - unsigned
+ * lower half of byte elements of S is zero-extended to 16-bit elements of D */
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#define cvlmx_rr(XD, XS)                                                    \
+        cvlgx_rr(W(XD), W(XS))
 
-#if RT_SIMD_COMPAT_FMA == 2
+/* cvl (D = byte-to-half lower half of S) - signed
+ * lower half of byte elements of S is sign-extended to 16-bit elements of D */
 
-#define fmats_rr(XG, XS, XT)                                                \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_rr(W(XS), W(XT))                                              \
-        addts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+#define cvlmn_rr(XD, XS)                                                    \
+        cvlgn_rr(W(XD), W(XS))
 
-#define fmats_ld(XG, XS, MT, DT)                                            \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_ld(W(XS), W(MT), W(DT))                                       \
-        addts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+/* cvh (D = byte-to-half upper half of S) - unsigned
+ * upper half of byte elements of S is zero-extended to 16-bit elements of D */
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define cvhmx_rr(XD, XS)                                                    \
+        cvhgx_rr(W(XD), W(XS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all Power systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+/* cvh (D = byte-to-half upper half of S) - signed
+ * upper half of byte elements of S is sign-extended to 16-bit elements of D */
 
-#if RT_SIMD_COMPAT_FMS == 2
+#define cvhmn_rr(XD, XS)                                                    \
+        cvhgn_rr(W(XD), W(XS))
 
-#define fmsts_rr(XG, XS, XT)                                                \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_rr(W(XS), W(XT))                                              \
-        subts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+/* cvs (D = half-to-byte S, T) - saturate, unsigned byte
+ * signed 16-bit elements of S/T are narrowed to lower/upper half of bytes,
+ * values outside of [0, 255] are clamped to the nearest unsigned byte */
 
-#define fmsts_ld(XG, XS, MT, DT)                                            \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_ld(W(XS), W(MT), W(DT))                                       \
-        subts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+#define cvsmb_rr(XD, XS, XT)                                                \
+        cvsgb_rr(W(XD), W(XS), W(XT))
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#endif /* RT_SIMD: 256, 128 */
 
 /******************************************************************************/
 /**** var-len **** SIMD instructions with configurable-element **** 32-bit ****/
@@ -4309,6 +11005,12 @@ rt_si32 from_mask(rt_si32 mask)
 #define movpx_st(XS, MD, DD)                                                \
         movox_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S) non-temporal (streaming) store, bypasses caches
+ * destination must be SIMD-aligned, weakly-ordered with regular stores */
+
+#define movpx_nt(XS, MD, DD)                                                \
+        movox_nt(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
 
@@ -4318,6 +11020,96 @@ rt_si32 from_mask(rt_si32 mask)
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvox_st(W(XS), W(MG), W(DG))
 
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, XD cannot be Xmm0 */
+
+#define mmzpx_ld(XD, MS, DS)                                                \
+        mmzox_ld(W(XD), W(MS), W(DS))
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selpx_rr(XG, XM, XS)                                                \
+        selox_rr(W(XG), W(XM), W(XS))
+
+#define selpx_ld(XG, XM, MS, DS)                                            \
+        selox_ld(W(XG), W(XM), W(MS), W(DS))
+
+#define selpx3rr(XD, XM, XS, XT)                                            \
+        selox3rr(W(XD), W(XM), W(XS), W(XT))
+
+#define selpx3ld(XD, XM, XS, MT, DT)                                        \
+        selox3ld(W(XD), W(XM), W(XS), W(MT), W(DT))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splpx_rr(XD, RS)                                                    \
+        splox_rr(W(XD), W(RS))
+
+#define splpx_ld(XD, MS, DS)                                                \
+        splox_ld(W(XD), W(MS), W(DS))
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extpx_rr(RD, XS, IS)                                                \
+        extox_rr(W(RD), W(XS), W(IS))
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define inspx_rr(XG, RS, IS)                                                \
+        insox_rr(W(XG), W(RS), W(IS))
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> 2*i) & 3 of the source */
+
+#define shfpx_ri(XG, IS)                                                    \
+        shfox_ri(W(XG), W(IS))
+
+#define shfpx3ri(XD, XS, IT)                                                \
+        shfox3ri(W(XD), W(XS), W(IT))
+
+/* ilo (G = G0 S0 G1 S1), (D = S0 T0 S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ilopx_rr(XG, XS)                                                    \
+        iloox_rr(W(XG), W(XS))
+
+#define ilopx_ld(XG, MS, DS)                                                \
+        iloox_ld(W(XG), W(MS), W(DS))
+
+#define ilopx3rr(XD, XS, XT)                                                \
+        iloox3rr(W(XD), W(XS), W(XT))
+
+#define ilopx3ld(XD, XS, MT, DT)                                            \
+        iloox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ihi (G = G2 S2 G3 S3), (D = S2 T2 S3 T3) if (#D != #S) in 128-bit chunks */
+
+#define ihipx_rr(XG, XS)                                                    \
+        ihiox_rr(W(XG), W(XS))
+
+#define ihipx_ld(XG, MS, DS)                                                \
+        ihiox_ld(W(XG), W(MS), W(DS))
+
+#define ihipx3rr(XD, XS, XT)                                                \
+        ihiox3rr(W(XD), W(XS), W(XT))
+
+#define ihipx3ld(XD, XS, MT, DT)                                            \
+        ihiox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revpx_rx(XG)                                                        \
+        revox_rx(W(XG))
+
+#define revpx_rr(XD, XS)                                                    \
+        revox_rr(W(XD), W(XS))
+
+/* mkt (Xmm0 = tail-mask of S elems) where (elem: -1 if < S, 0 otherwise)
+ * uses Reax implicitly as a scratch register, RS can be Reax */
+
+#define mktpx_xr(RS)                                                        \
+        mktox_xr(W(RS))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -4481,6 +11273,61 @@ rt_si32 from_mask(rt_si32 mask)
 #define cbsps_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsos_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S), full precision, clamped to normal range */
+
+#define expps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expos_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define exeps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        exeos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S), full precision, S is positive, normal */
+
+#define logps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logos_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define lgeps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        lgeos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* pow (D = S ^ T) if (#D != #S && #D != #T), S is positive, normal */
+
+#define powps_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        powos_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+#define pweps_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        pweos_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* sin (D = sin S) if (#D != #S), |S| within reduction range */
+
+#define sinps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) if (#D != #S), |S| within reduction range */
+
+#define cosps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* scs (D = sin S, E = cos S) if (#D != #S && #E != #S) */
+
+#define scsps_rr(XD, XE, X1, XS) /* destroys X1 (temp reg) */               \
+        scsos_rr(W(XD), W(XE), W(X1), W(XS))
+
+/* atn (D = atan2(S, T)) if (#D != #S && #D != #T), S, T finite, not both 0 */
+
+#define atnps_rr(XD, X1, X2, X3, XS, XT) /* destroys X1, X2, X3 */          \
+        atnos_rr(W(XD), W(X1), W(X2), W(X3), W(XS), W(XT))
+
+/* rng (G = next state of G), state must be non-zero */
+
+#define rngpx_rr(XG, X1) /* destroys X1 (temp reg) */                      \
+        rngox_rr(W(XG), W(X1))
+
+/* rng (G = next state of G, D = uniform [0, 1) from G) if (#D != #G)
+ * destroys Reax (scratch) */
+
+#define rngps_rr(XD, XG)                                                    \
+        rngos_rr(W(XD), W(XG))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -4555,6 +11402,42 @@ rt_si32 from_mask(rt_si32 mask)
 #define maxps3ld(XD, XS, MT, DT)                                            \
         maxos3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* adh (D = S[0] + S[1] + ... + S[n]), result in lowest element of D */
+
+#define adhps_rr(XD, XS)                                                    \
+        adhos_rr(W(XD), W(XS))
+
+#define adhps_ld(XD, MS, DS)                                                \
+        adhos_ld(W(XD), W(MS), W(DS))
+
+/* mnh (D = min(S[0], S[1], ..., S[n])), result in lowest element of D */
+
+#define mnhps_rr(XD, XS)                                                    \
+        mnhos_rr(W(XD), W(XS))
+
+#define mnhps_ld(XD, MS, DS)                                                \
+        mnhos_ld(W(XD), W(MS), W(DS))
+
+/* mxh (D = max(S[0], S[1], ..., S[n])), result in lowest element of D */
+
+#define mxhps_rr(XD, XS)                                                    \
+        mxhos_rr(W(XD), W(XS))
+
+#define mxhps_ld(XD, MS, DS)                                                \
+        mxhos_ld(W(XD), W(MS), W(DS))
+
+/* gat (D[i] = [RB + I[i] * elem-size]) if (#D != #I)
+ * destroys Xmm0 (AVX2 mask register), Reax (scratch) */
+
+#define gatpx_ld(XD, RB, XI)                                                \
+        gatox_ld(W(XD), W(RB), W(XI))
+
+/* sct ([RB + I[i] * elem-size] = S[i])
+ * destroys Reax (scratch) */
+
+#define sctpx_st(XS, RB, XI)                                                \
+        sctox_st(W(XS), W(RB), W(XI))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqps_rr(XG, XS)                                                    \
@@ -4644,6 +11527,16 @@ rt_si32 from_mask(rt_si32 mask)
 #define mkjpx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjox_rx(W(XS), mask, lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbpx_rr(RD, XS)                                                    \
+        mkbox_rr(W(RD), W(XS))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcpx_rr(RD, XS)                                                    \
+        mkcox_rr(W(RD), W(XS))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -4764,6 +11657,24 @@ rt_si32 from_mask(rt_si32 mask)
 #define cvrps_rr(XD, XS, mode)                                              \
         cvros_rr(W(XD), W(XS), mode)
 
+/* adr, sbr, mlr, dvr (G = G op S), fmr (G = G + S * T)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define adrps_rr(XG, XS, mode)                                              \
+        adros_rr(W(XG), W(XS), mode)
+
+#define sbrps_rr(XG, XS, mode)                                              \
+        sbros_rr(W(XG), W(XS), mode)
+
+#define mlrps_rr(XG, XS, mode)                                              \
+        mlros_rr(W(XG), W(XS), mode)
+
+#define dvrps_rr(XG, XS, mode)                                              \
+        dvros_rr(W(XG), W(XS), mode)
+
+#define fmrps_rr(XG, XS, XT, mode)                                          \
+        fmros_rr(W(XG), W(XS), W(XT), mode)
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -4794,6 +11705,60 @@ rt_si32 from_mask(rt_si32 mask)
 #define subpx3ld(XD, XS, MT, DT)                                            \
         subox3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* abs (G = |G|), (D = |S|) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define abspn_rx(XG)                                                        \
+        abson_rx(W(XG))
+
+#define abspn_rr(XD, XS)                                                    \
+        abson_rr(W(XD), W(XS))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product
+ * destroys Reax (scratch) where emulated */
+
+#define mulpx_rr(XG, XS)                                                    \
+        mulox_rr(W(XG), W(XS))
+
+#define mulpx_ld(XG, MS, DS)                                                \
+        mulox_ld(W(XG), W(MS), W(DS))
+
+#define mulpx3rr(XD, XS, XT)                                                \
+        mulox3rr(W(XD), W(XS), W(XT))
+
+#define mulpx3ld(XD, XS, MT, DT)                                            \
+        mulox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, unsigned
+ * destroys Reax (scratch) */
+
+#define mhipx_rr(XG, XS)                                                    \
+        mhiox_rr(W(XG), W(XS))
+
+#define mhipx_ld(XG, MS, DS)                                                \
+        mhiox_ld(W(XG), W(MS), W(DS))
+
+#define mhipx3rr(XD, XS, XT)                                                \
+        mhiox3rr(W(XD), W(XS), W(XT))
+
+#define mhipx3ld(XD, XS, MT, DT)                                            \
+        mhiox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, signed
+ * destroys Reax (scratch) */
+
+#define mhipn_rr(XG, XS)                                                    \
+        mhion_rr(W(XG), W(XS))
+
+#define mhipn_ld(XG, MS, DS)                                                \
+        mhion_ld(W(XG), W(MS), W(DS))
+
+#define mhipn3rr(XD, XS, XT)                                                \
+        mhion3rr(W(XD), W(XS), W(XT))
+
+#define mhipn3ld(XD, XS, MT, DT)                                            \
+        mhion3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -4884,6 +11849,218 @@ rt_si32 from_mask(rt_si32 mask)
 #define svrpn3ld(XD, XS, MT, DT)                                            \
         svron3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define minpx_rr(XG, XS)                                                    \
+        minox_rr(W(XG), W(XS))
+
+#define minpx_ld(XG, MS, DS)                                                \
+        minox_ld(W(XG), W(MS), W(DS))
+
+#define minpx3rr(XD, XS, XT)                                                \
+        minox3rr(W(XD), W(XS), W(XT))
+
+#define minpx3ld(XD, XS, MT, DT)                                            \
+        minox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define minpn_rr(XG, XS)                                                    \
+        minon_rr(W(XG), W(XS))
+
+#define minpn_ld(XG, MS, DS)                                                \
+        minon_ld(W(XG), W(MS), W(DS))
+
+#define minpn3rr(XD, XS, XT)                                                \
+        minon3rr(W(XD), W(XS), W(XT))
+
+#define minpn3ld(XD, XS, MT, DT)                                            \
+        minon3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define maxpx_rr(XG, XS)                                                    \
+        maxox_rr(W(XG), W(XS))
+
+#define maxpx_ld(XG, MS, DS)                                                \
+        maxox_ld(W(XG), W(MS), W(DS))
+
+#define maxpx3rr(XD, XS, XT)                                                \
+        maxox3rr(W(XD), W(XS), W(XT))
+
+#define maxpx3ld(XD, XS, MT, DT)                                            \
+        maxox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define maxpn_rr(XG, XS)                                                    \
+        maxon_rr(W(XG), W(XS))
+
+#define maxpn_ld(XG, MS, DS)                                                \
+        maxon_ld(W(XG), W(MS), W(DS))
+
+#define maxpn3rr(XD, XS, XT)                                                \
+        maxon3rr(W(XD), W(XS), W(XT))
+
+#define maxpn3ld(XD, XS, MT, DT)                                            \
+        maxon3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) where emulated */
+
+#define ceqpx_rr(XG, XS)                                                    \
+        ceqox_rr(W(XG), W(XS))
+
+#define ceqpx_ld(XG, MS, DS)                                                \
+        ceqox_ld(W(XG), W(MS), W(DS))
+
+#define ceqpx3rr(XD, XS, XT)                                                \
+        ceqox3rr(W(XD), W(XS), W(XT))
+
+#define ceqpx3ld(XD, XS, MT, DT)                                            \
+        ceqox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) where emulated */
+
+#define cnepx_rr(XG, XS)                                                    \
+        cneox_rr(W(XG), W(XS))
+
+#define cnepx_ld(XG, MS, DS)                                                \
+        cneox_ld(W(XG), W(MS), W(DS))
+
+#define cnepx3rr(XD, XS, XT)                                                \
+        cneox3rr(W(XD), W(XS), W(XT))
+
+#define cnepx3ld(XD, XS, MT, DT)                                            \
+        cneox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define cltpx_rr(XG, XS)                                                    \
+        cltox_rr(W(XG), W(XS))
+
+#define cltpx_ld(XG, MS, DS)                                                \
+        cltox_ld(W(XG), W(MS), W(DS))
+
+#define cltpx3rr(XD, XS, XT)                                                \
+        cltox3rr(W(XD), W(XS), W(XT))
+
+#define cltpx3ld(XD, XS, MT, DT)                                            \
+        cltox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define cltpn_rr(XG, XS)                                                    \
+        clton_rr(W(XG), W(XS))
+
+#define cltpn_ld(XG, MS, DS)                                                \
+        clton_ld(W(XG), W(MS), W(DS))
+
+#define cltpn3rr(XD, XS, XT)                                                \
+        clton3rr(W(XD), W(XS), W(XT))
+
+#define cltpn3ld(XD, XS, MT, DT)                                            \
+        clton3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define clepx_rr(XG, XS)                                                    \
+        cleox_rr(W(XG), W(XS))
+
+#define clepx_ld(XG, MS, DS)                                                \
+        cleox_ld(W(XG), W(MS), W(DS))
+
+#define clepx3rr(XD, XS, XT)                                                \
+        cleox3rr(W(XD), W(XS), W(XT))
+
+#define clepx3ld(XD, XS, MT, DT)                                            \
+        cleox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define clepn_rr(XG, XS)                                                    \
+        cleon_rr(W(XG), W(XS))
+
+#define clepn_ld(XG, MS, DS)                                                \
+        cleon_ld(W(XG), W(MS), W(DS))
+
+#define clepn3rr(XD, XS, XT)                                                \
+        cleon3rr(W(XD), W(XS), W(XT))
+
+#define clepn3ld(XD, XS, MT, DT)                                            \
+        cleon3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define cgtpx_rr(XG, XS)                                                    \
+        cgtox_rr(W(XG), W(XS))
+
+#define cgtpx_ld(XG, MS, DS)                                                \
+        cgtox_ld(W(XG), W(MS), W(DS))
+
+#define cgtpx3rr(XD, XS, XT)                                                \
+        cgtox3rr(W(XD), W(XS), W(XT))
+
+#define cgtpx3ld(XD, XS, MT, DT)                                            \
+        cgtox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define cgtpn_rr(XG, XS)                                                    \
+        cgton_rr(W(XG), W(XS))
+
+#define cgtpn_ld(XG, MS, DS)                                                \
+        cgton_ld(W(XG), W(MS), W(DS))
+
+#define cgtpn3rr(XD, XS, XT)                                                \
+        cgton3rr(W(XD), W(XS), W(XT))
+
+#define cgtpn3ld(XD, XS, MT, DT)                                            \
+        cgton3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define cgepx_rr(XG, XS)                                                    \
+        cgeox_rr(W(XG), W(XS))
+
+#define cgepx_ld(XG, MS, DS)                                                \
+        cgeox_ld(W(XG), W(MS), W(DS))
+
+#define cgepx3rr(XD, XS, XT)                                                \
+        cgeox3rr(W(XD), W(XS), W(XT))
+
+#define cgepx3ld(XD, XS, MT, DT)                                            \
+        cgeox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define cgepn_rr(XG, XS)                                                    \
+        cgeon_rr(W(XG), W(XS))
+
+#define cgepn_ld(XG, MS, DS)                                                \
+        cgeon_ld(W(XG), W(MS), W(DS))
+
+#define cgepn3rr(XD, XS, XT)                                                \
+        cgeon3rr(W(XD), W(XS), W(XT))
+
+#define cgepn3ld(XD, XS, MT, DT)                                            \
+        cgeon3ld(W(XD), W(XS), W(MT), W(DT))
+
 /******************************************************************************/
 /**** 256-bit **** SIMD instructions with configurable-element **** 32-bit ****/
 /******************************************************************************/
@@ -6326,6 +13503,12 @@ rt_si32 from_mask(rt_si32 mask)
 #define movpx_st(XS, MD, DD)                                                \
         movqx_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S) non-temporal (streaming) store, bypasses caches
+ * destination must be SIMD-aligned, weakly-ordered with regular stores */
+
+#define movpx_nt(XS, MD, DD)                                                \
+        movqx_nt(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, XS unmasked elems */
 
@@ -6335,6 +13518,96 @@ rt_si32 from_mask(rt_si32 mask)
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvqx_st(W(XS), W(MG), W(DG))
 
+/* mmz (D = mask-zero S) where (mask-elem: 0 zeroes D, -1 loads S)
+ * uses Xmm0 implicitly as a mask register, XD cannot be Xmm0 */
+
+#define mmzpx_ld(XD, MS, DS)                                                \
+        mmzqx_ld(W(XD), W(MS), W(DS))
+
+/* sel (G = M ? S : G), (D = M ? T : S) if (#D != #S) with explicit XM mask
+ * where (mask-elem: 0 keeps G/S, -1 picks S/T), elems are all-ones or 0s */
+
+#define selpx_rr(XG, XM, XS)                                                \
+        selqx_rr(W(XG), W(XM), W(XS))
+
+#define selpx_ld(XG, XM, MS, DS)                                            \
+        selqx_ld(W(XG), W(XM), W(MS), W(DS))
+
+#define selpx3rr(XD, XM, XS, XT)                                            \
+        selqx3rr(W(XD), W(XM), W(XS), W(XT))
+
+#define selpx3ld(XD, XM, XS, MT, DT)                                        \
+        selqx3ld(W(XD), W(XM), W(XS), W(MT), W(DT))
+
+/* spl (D = S) broadcasts elem-sized BASE S or mem-scalar to all elems of D */
+
+#define splpx_rr(XD, RS)                                                    \
+        splqx_rr(W(XD), W(RS))
+
+#define splpx_ld(XD, MS, DS)                                                \
+        splqx_ld(W(XD), W(MS), W(DS))
+
+/* ext (D = S[IS]) moves element IS of S (SIMD) into elem-sized BASE D */
+
+#define extpx_rr(RD, XS, IS)                                                \
+        extqx_rr(W(RD), W(XS), W(IS))
+
+/* ins (G[IS] = S) replaces element IS of G (SIMD) with elem-sized BASE S */
+
+#define inspx_rr(XG, RS, IS)                                                \
+        insqx_rr(W(XG), W(RS), W(IS))
+
+/* shf (G = G shuffled by IS), (D = S shuffled by IT) in each 128-bit chunk,
+ * elem i of the chunk is replaced with elem (IT >> i) & 1 of the source */
+
+#define shfpx_ri(XG, IS)                                                    \
+        shfqx_ri(W(XG), W(IS))
+
+#define shfpx3ri(XD, XS, IT)                                                \
+        shfqx3ri(W(XD), W(XS), W(IT))
+
+/* ilo (G = G0 S0), (D = S0 T0) if (#D != #S) in 128-bit chunks */
+
+#define ilopx_rr(XG, XS)                                                    \
+        iloqx_rr(W(XG), W(XS))
+
+#define ilopx_ld(XG, MS, DS)                                                \
+        iloqx_ld(W(XG), W(MS), W(DS))
+
+#define ilopx3rr(XD, XS, XT)                                                \
+        iloqx3rr(W(XD), W(XS), W(XT))
+
+#define ilopx3ld(XD, XS, MT, DT)                                            \
+        iloqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ihi (G = G1 S1), (D = S1 T1) if (#D != #S) in 128-bit chunks */
+
+#define ihipx_rr(XG, XS)                                                    \
+        ihiqx_rr(W(XG), W(XS))
+
+#define ihipx_ld(XG, MS, DS)                                                \
+        ihiqx_ld(W(XG), W(MS), W(DS))
+
+#define ihipx3rr(XD, XS, XT)                                                \
+        ihiqx3rr(W(XD), W(XS), W(XT))
+
+#define ihipx3ld(XD, XS, MT, DT)                                            \
+        ihiqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* rev (G = reverse G), (D = reverse S) elem order across the full width */
+
+#define revpx_rx(XG)                                                        \
+        revqx_rx(W(XG))
+
+#define revpx_rr(XD, XS)                                                    \
+        revqx_rr(W(XD), W(XS))
+
+/* mkt (Xmm0 = tail-mask of S elems) where (elem: -1 if < S, 0 otherwise)
+ * uses Reax implicitly as a scratch register, RS can be Reax */
+
+#define mktpx_xr(RS)                                                        \
+        mktqx_xr(W(RS))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -6498,6 +13771,61 @@ rt_si32 from_mask(rt_si32 mask)
 #define cbsps_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsqs_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S), full precision, clamped to normal range */
+
+#define expps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define exeps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        exeqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S), full precision, S is positive, normal */
+
+#define logps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+#define lgeps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        lgeqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* pow (D = S ^ T) if (#D != #S && #D != #T), S is positive, normal */
+
+#define powps_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        powqs_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+#define pweps_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        pweqs_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* sin (D = sin S) if (#D != #S), |S| within reduction range */
+
+#define sinps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) if (#D != #S), |S| within reduction range */
+
+#define cosps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* scs (D = sin S, E = cos S) if (#D != #S && #E != #S) */
+
+#define scsps_rr(XD, XE, X1, XS) /* destroys X1 (temp reg) */               \
+        scsqs_rr(W(XD), W(XE), W(X1), W(XS))
+
+/* atn (D = atan2(S, T)) if (#D != #S && #D != #T), S, T finite, not both 0 */
+
+#define atnps_rr(XD, X1, X2, X3, XS, XT) /* destroys X1, X2, X3 */          \
+        atnqs_rr(W(XD), W(X1), W(X2), W(X3), W(XS), W(XT))
+
+/* rng (G = next state of G), state must be non-zero */
+
+#define rngpx_rr(XG, X1) /* destroys X1 (temp reg) */                      \
+        rngqx_rr(W(XG), W(X1))
+
+/* rng (G = next state of G, D = uniform [0, 1) from G) if (#D != #G)
+ * destroys Reax (scratch) */
+
+#define rngps_rr(XD, XG)                                                    \
+        rngqs_rr(W(XD), W(XG))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -6572,6 +13900,42 @@ rt_si32 from_mask(rt_si32 mask)
 #define maxps3ld(XD, XS, MT, DT)                                            \
         maxqs3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* adh (D = S[0] + S[1] + ... + S[n]), result in lowest element of D */
+
+#define adhps_rr(XD, XS)                                                    \
+        adhqs_rr(W(XD), W(XS))
+
+#define adhps_ld(XD, MS, DS)                                                \
+        adhqs_ld(W(XD), W(MS), W(DS))
+
+/* mnh (D = min(S[0], S[1], ..., S[n])), result in lowest element of D */
+
+#define mnhps_rr(XD, XS)                                                    \
+        mnhqs_rr(W(XD), W(XS))
+
+#define mnhps_ld(XD, MS, DS)                                                \
+        mnhqs_ld(W(XD), W(MS), W(DS))
+
+/* mxh (D = max(S[0], S[1], ..., S[n])), result in lowest element of D */
+
+#define mxhps_rr(XD, XS)                                                    \
+        mxhqs_rr(W(XD), W(XS))
+
+#define mxhps_ld(XD, MS, DS)                                                \
+        mxhqs_ld(W(XD), W(MS), W(DS))
+
+/* gat (D[i] = [RB + I[i] * elem-size]) if (#D != #I)
+ * destroys Xmm0 (AVX2 mask register), Reax (scratch) */
+
+#define gatpx_ld(XD, RB, XI)                                                \
+        gatqx_ld(W(XD), W(RB), W(XI))
+
+/* sct ([RB + I[i] * elem-size] = S[i])
+ * destroys Reax (scratch) */
+
+#define sctpx_st(XS, RB, XI)                                                \
+        sctqx_st(W(XS), W(RB), W(XI))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqps_rr(XG, XS)                                                    \
@@ -6661,6 +14025,16 @@ rt_si32 from_mask(rt_si32 mask)
 #define mkjpx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjqx_rx(W(XS), mask, lb)
 
+/* mkb (D = bit-mask of S elements) where (elem: -1 sets bit, 0 clears bit) */
+
+#define mkbpx_rr(RD, XS)                                                    \
+        mkbqx_rr(W(RD), W(XS))
+
+/* mkc (D = number of S elements) where (elem: -1 is counted, 0 is not) */
+
+#define mkcpx_rr(RD, XS)                                                    \
+        mkcqx_rr(W(RD), W(XS))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -6781,6 +14155,24 @@ rt_si32 from_mask(rt_si32 mask)
 #define cvrps_rr(XD, XS, mode)                                              \
         cvrqs_rr(W(XD), W(XS), mode)
 
+/* adr, sbr, mlr, dvr (G = G op S), fmr (G = G + S * T)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks) */
+
+#define adrps_rr(XG, XS, mode)                                              \
+        adrqs_rr(W(XG), W(XS), mode)
+
+#define sbrps_rr(XG, XS, mode)                                              \
+        sbrqs_rr(W(XG), W(XS), mode)
+
+#define mlrps_rr(XG, XS, mode)                                              \
+        mlrqs_rr(W(XG), W(XS), mode)
+
+#define dvrps_rr(XG, XS, mode)                                              \
+        dvrqs_rr(W(XG), W(XS), mode)
+
+#define fmrps_rr(XG, XS, XT, mode)                                          \
+        fmrqs_rr(W(XG), W(XS), W(XT), mode)
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -6811,6 +14203,60 @@ rt_si32 from_mask(rt_si32 mask)
 #define subpx3ld(XD, XS, MT, DT)                                            \
         subqx3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* abs (G = |G|), (D = |S|) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define abspn_rx(XG)                                                        \
+        absqn_rx(W(XG))
+
+#define abspn_rr(XD, XS)                                                    \
+        absqn_rr(W(XD), W(XS))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) - low half of the product
+ * destroys Reax (scratch) where emulated */
+
+#define mulpx_rr(XG, XS)                                                    \
+        mulqx_rr(W(XG), W(XS))
+
+#define mulpx_ld(XG, MS, DS)                                                \
+        mulqx_ld(W(XG), W(MS), W(DS))
+
+#define mulpx3rr(XD, XS, XT)                                                \
+        mulqx3rr(W(XD), W(XS), W(XT))
+
+#define mulpx3ld(XD, XS, MT, DT)                                            \
+        mulqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, unsigned
+ * destroys Reax (scratch) */
+
+#define mhipx_rr(XG, XS)                                                    \
+        mhiqx_rr(W(XG), W(XS))
+
+#define mhipx_ld(XG, MS, DS)                                                \
+        mhiqx_ld(W(XG), W(MS), W(DS))
+
+#define mhipx3rr(XD, XS, XT)                                                \
+        mhiqx3rr(W(XD), W(XS), W(XT))
+
+#define mhipx3ld(XD, XS, MT, DT)                                            \
+        mhiqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mhi (G = G * S), (D = S * T) if (#D != #S) - high half, signed
+ * destroys Reax (scratch) */
+
+#define mhipn_rr(XG, XS)                                                    \
+        mhiqn_rr(W(XG), W(XS))
+
+#define mhipn_ld(XG, MS, DS)                                                \
+        mhiqn_ld(W(XG), W(MS), W(DS))
+
+#define mhipn3rr(XD, XS, XT)                                                \
+        mhiqn3rr(W(XD), W(XS), W(XT))
+
+#define mhipn3ld(XD, XS, MT, DT)                                            \
+        mhiqn3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility, shift count mustn't exceed elem-size */
 
@@ -6901,6 +14347,218 @@ rt_si32 from_mask(rt_si32 mask)
 #define svrpn3ld(XD, XS, MT, DT)                                            \
         svrqn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define minpx_rr(XG, XS)                                                    \
+        minqx_rr(W(XG), W(XS))
+
+#define minpx_ld(XG, MS, DS)                                                \
+        minqx_ld(W(XG), W(MS), W(DS))
+
+#define minpx3rr(XD, XS, XT)                                                \
+        minqx3rr(W(XD), W(XS), W(XT))
+
+#define minpx3ld(XD, XS, MT, DT)                                            \
+        minqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define minpn_rr(XG, XS)                                                    \
+        minqn_rr(W(XG), W(XS))
+
+#define minpn_ld(XG, MS, DS)                                                \
+        minqn_ld(W(XG), W(MS), W(DS))
+
+#define minpn3rr(XD, XS, XT)                                                \
+        minqn3rr(W(XD), W(XS), W(XT))
+
+#define minpn3ld(XD, XS, MT, DT)                                            \
+        minqn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define maxpx_rr(XG, XS)                                                    \
+        maxqx_rr(W(XG), W(XS))
+
+#define maxpx_ld(XG, MS, DS)                                                \
+        maxqx_ld(W(XG), W(MS), W(DS))
+
+#define maxpx3rr(XD, XS, XT)                                                \
+        maxqx3rr(W(XD), W(XS), W(XT))
+
+#define maxpx3ld(XD, XS, MT, DT)                                            \
+        maxqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define maxpn_rr(XG, XS)                                                    \
+        maxqn_rr(W(XG), W(XS))
+
+#define maxpn_ld(XG, MS, DS)                                                \
+        maxqn_ld(W(XG), W(MS), W(DS))
+
+#define maxpn3rr(XD, XS, XT)                                                \
+        maxqn3rr(W(XD), W(XS), W(XT))
+
+#define maxpn3ld(XD, XS, MT, DT)                                            \
+        maxqn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) where emulated */
+
+#define ceqpx_rr(XG, XS)                                                    \
+        ceqqx_rr(W(XG), W(XS))
+
+#define ceqpx_ld(XG, MS, DS)                                                \
+        ceqqx_ld(W(XG), W(MS), W(DS))
+
+#define ceqpx3rr(XD, XS, XT)                                                \
+        ceqqx3rr(W(XD), W(XS), W(XT))
+
+#define ceqpx3ld(XD, XS, MT, DT)                                            \
+        ceqqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S)
+ * destroys Reax (scratch) where emulated */
+
+#define cnepx_rr(XG, XS)                                                    \
+        cneqx_rr(W(XG), W(XS))
+
+#define cnepx_ld(XG, MS, DS)                                                \
+        cneqx_ld(W(XG), W(MS), W(DS))
+
+#define cnepx3rr(XD, XS, XT)                                                \
+        cneqx3rr(W(XD), W(XS), W(XT))
+
+#define cnepx3ld(XD, XS, MT, DT)                                            \
+        cneqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define cltpx_rr(XG, XS)                                                    \
+        cltqx_rr(W(XG), W(XS))
+
+#define cltpx_ld(XG, MS, DS)                                                \
+        cltqx_ld(W(XG), W(MS), W(DS))
+
+#define cltpx3rr(XD, XS, XT)                                                \
+        cltqx3rr(W(XD), W(XS), W(XT))
+
+#define cltpx3ld(XD, XS, MT, DT)                                            \
+        cltqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define cltpn_rr(XG, XS)                                                    \
+        cltqn_rr(W(XG), W(XS))
+
+#define cltpn_ld(XG, MS, DS)                                                \
+        cltqn_ld(W(XG), W(MS), W(DS))
+
+#define cltpn3rr(XD, XS, XT)                                                \
+        cltqn3rr(W(XD), W(XS), W(XT))
+
+#define cltpn3ld(XD, XS, MT, DT)                                            \
+        cltqn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define clepx_rr(XG, XS)                                                    \
+        cleqx_rr(W(XG), W(XS))
+
+#define clepx_ld(XG, MS, DS)                                                \
+        cleqx_ld(W(XG), W(MS), W(DS))
+
+#define clepx3rr(XD, XS, XT)                                                \
+        cleqx3rr(W(XD), W(XS), W(XT))
+
+#define clepx3ld(XD, XS, MT, DT)                                            \
+        cleqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define clepn_rr(XG, XS)                                                    \
+        cleqn_rr(W(XG), W(XS))
+
+#define clepn_ld(XG, MS, DS)                                                \
+        cleqn_ld(W(XG), W(MS), W(DS))
+
+#define clepn3rr(XD, XS, XT)                                                \
+        cleqn3rr(W(XD), W(XS), W(XT))
+
+#define clepn3ld(XD, XS, MT, DT)                                            \
+        cleqn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define cgtpx_rr(XG, XS)                                                    \
+        cgtqx_rr(W(XG), W(XS))
+
+#define cgtpx_ld(XG, MS, DS)                                                \
+        cgtqx_ld(W(XG), W(MS), W(DS))
+
+#define cgtpx3rr(XD, XS, XT)                                                \
+        cgtqx3rr(W(XD), W(XS), W(XT))
+
+#define cgtpx3ld(XD, XS, MT, DT)                                            \
+        cgtqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define cgtpn_rr(XG, XS)                                                    \
+        cgtqn_rr(W(XG), W(XS))
+
+#define cgtpn_ld(XG, MS, DS)                                                \
+        cgtqn_ld(W(XG), W(MS), W(DS))
+
+#define cgtpn3rr(XD, XS, XT)                                                \
+        cgtqn3rr(W(XD), W(XS), W(XT))
+
+#define cgtpn3ld(XD, XS, MT, DT)                                            \
+        cgtqn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - unsigned
+ * destroys Reax (scratch) where emulated */
+
+#define cgepx_rr(XG, XS)                                                    \
+        cgeqx_rr(W(XG), W(XS))
+
+#define cgepx_ld(XG, MS, DS)                                                \
+        cgeqx_ld(W(XG), W(MS), W(DS))
+
+#define cgepx3rr(XD, XS, XT)                                                \
+        cgeqx3rr(W(XD), W(XS), W(XT))
+
+#define cgepx3ld(XD, XS, MT, DT)                                            \
+        cgeqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) - signed
+ * destroys Reax (scratch) where emulated */
+
+#define cgepn_rr(XG, XS)                                                    \
+        cgeqn_rr(W(XG), W(XS))
+
+#define cgepn_ld(XG, MS, DS)                                                \
+        cgeqn_ld(W(XG), W(MS), W(DS))
+
+#define cgepn3rr(XD, XS, XT)                                                \
+        cgeqn3rr(W(XD), W(XS), W(XT))
+
+#define cgepn3ld(XD, XS, MT, DT)                                            \
+        cgeqn3ld(W(XD), W(XS), W(MT), W(DT))
+
 /******************************************************************************/
 /**** 256-bit **** SIMD instructions with configurable-element **** 64-bit ****/
 /******************************************************************************/
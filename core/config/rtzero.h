@@ -100,13 +100,22 @@
  * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
  * This happens when registers written in 128-bit subset are then used/read
  * from within 256-bit subset. The same rule applies to mixing of 256/512-bit.
+ * On x86-AVX targets ASM_LEAVE clears upper halves (vzero_xx) by default to
+ * avoid AVX/SSE transition stalls in surrounding compiler-generated code.
+ * As SIMD registers are not declared clobbered by ASM_ENTER/ASM_LEAVE, this
+ * is only safe if the caller is built SSE-only, otherwise (-mavx, -mavx512f)
+ * the compiler may keep ymm/zmm values live across the asm block and lose
+ * their upper halves. Therefore RT_SIMD_COMPAT_VZU defaults to 0 if __AVX__
+ * is defined, enabling it manually for such callers is not recommended.
  *
  * Working with sub-word BASE elements (byte, half) is reserved for future use.
  * However, current displacement types may not work due to natural alignment.
  * Signed/unsigned types can be supported orthogonally in cmd*n_**, cmd*x_**.
- * Working with sub-word SIMD elements (byte, half) has not been investigated.
+ * Working with sub-word SIMD elements (byte, half) is limited to integer ops
+ * in cmdm*_** (cmdg*_**, cmda*_**) subsets, intended for 8-bit image data.
  * However, as current major ISAs lack the ability to do sub-word fp-compute,
  * these corresponding subsets cannot be viewed as valid targets for SPMD.
+ * Packed fp16 storage is supported via fp32 converting loads/stores (cvf).
  *
  * Scalar SIMD improvements, horizontal SIMD reductions, wider SIMD vectors
  * with zeroing/merging predicates in 3/4-operand instructions are planned as
@@ -11,7 +11,8 @@ LIB_LIST =                              \
         -lm
 
 
-build: simd_test_x64_32 simd_test_x64_64 simd_test_x64f32 simd_test_x64f64
+build: simd_test_x64_32 simd_test_x64_64 simd_test_x64f32 simd_test_x64f64 \
+       simd_test_x64fat simd_test_x64dyn
 
 strip:
 	x86_64-linux-gnu-strip simd_test.x64*
@@ -44,6 +45,42 @@ simd_test_x64f64:
         -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
         ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64
 
+simd_test_x64fat:
+	x86_64-linux-gnu-g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_FAT=simd_256v1 \
+        ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_256v1.o
+	x86_64-linux-gnu-g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_FAT=simd_256v2 \
+        ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_256v2.o
+	x86_64-linux-gnu-g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_FAT=simd_512v1 \
+        ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_512v1.o
+	x86_64-linux-gnu-g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_FAT=simd_512v2 \
+        ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_512v2.o
+	x86_64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_FAT=simd_128v4 -DRT_SIMD_FAT_MAIN \
+        ${INC_PATH} ${SRC_LIST} simd_test.x64fat_*.o \
+        ${LIB_PATH} ${LIB_LIST} -o simd_test.x64fat
+	rm simd_test.x64fat_*.o
+
+simd_test_x64dyn:
+	x86_64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_DYNAMIC_CODE \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64dyn
+
 
 # Prerequisites for the build:
 # native-compiler for x86_64 is installed and in the PATH variable.
@@ -53,6 +90,14 @@ simd_test_x64f64:
 # make -f simd_make_x64.mk
 # ./simd_test.x64f32
 
+# Fat binary (simd_test.x64fat) contains SSE4, AVX1/2 and AVX-512 targets
+# each compiled from the same source into its own namespace (RT_SIMD_FAT),
+# the widest supported SIMD target is then picked at startup (mask_pick).
+
+# Dynamic binary (simd_test.x64dyn) is built with RT_DYNAMIC_CODE, in which
+# ASM_ENTER/ASM_LEAVE blocks are emitted into a code buffer at run-time
+# (rt_CODE in rtbase.h) and then called as a function instead of inline-asm.
+
 # Clang compilation works too (takes much longer prior to 3.8), use (replace):
 # clang++ (in place of x86_64-linux-gnu-g++)
 # sudo apt-get install clang
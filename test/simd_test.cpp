@@ -19,7 +19,7 @@
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define RUN_LEVEL           24
+#define RUN_LEVEL           45
 #define CYC_SIZE            1000000
 
 #define ARR_SIZE            S*3 /* hardcoded in asm sections, S = SIMD width */
@@ -46,11 +46,6 @@
 /***************************   VARS, FUNCS, TYPES   ***************************/
 /******************************************************************************/
 
-rt_si32     n_init      = 0;            /* subtest-init (from command-line) */
-rt_si32     n_done      = RUN_LEVEL-1;  /* subtest-done (from command-line) */
-rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
-rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
-
 /*
  * Get system time in milliseconds.
  */
@@ -66,6 +61,26 @@ rt_pntr sys_alloc(rt_size size);
  */
 rt_void sys_free(rt_pntr ptr, rt_size size);
 
+/*
+ * In fat builds (see simd_make_x64.mk) this file is compiled once per SIMD
+ * target, each time with RT_SIMD_FAT set to the target's namespace name.
+ * Tests are then entered via main_simd from the common main() built along
+ * with the RT_SIMD_FAT_MAIN target, which picks the widest supported one.
+ */
+#if   (defined RT_SIMD_FAT)
+namespace RT_SIMD_FAT
+{
+#endif /* RT_SIMD_FAT */
+
+rt_si32     n_init      = 0;            /* subtest-init (from command-line) */
+rt_si32     n_done      = RUN_LEVEL-1;  /* subtest-done (from command-line) */
+rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
+rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
+
+#if   (defined RT_SIMD_FAT)
+rt_si32     t_mask      = RT_SIMD_TARGET; /* SIMD target mask (for fat build) */
+#endif /* RT_SIMD_FAT */
+
 /*
  * Extended SIMD info structure for ASM_ENTER/ASM_LEAVE
  * serves as a container for test arrays and internal variables.
@@ -128,6 +143,31 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
     rt_elem*iso2;
 #define inf_ISO2            DP(Q*0x100+0x010+0x02C*P+E)
 
+    /* batch descriptor */
+
+    rt_pntr bptr;
+#define inf_BPTR            DP(Q*0x100+0x010+0x030*P+E)
+
+    rt_si32 bcnt;
+#define inf_BCNT            DP(Q*0x100+0x010+0x034*P)
+
+    rt_si32 bstr;
+#define inf_BSTR            DP(Q*0x100+0x014+0x034*P)
+
+    /* streaming buffers */
+
+    rt_real*fsrc;
+#define inf_FSRC            DP(Q*0x100+0x018+0x034*P+E)
+
+    rt_real*fdst;
+#define inf_FDST            DP(Q*0x100+0x018+0x038*P+E)
+
+    rt_si32 fcnt;
+#define inf_FCNT            DP(Q*0x100+0x018+0x03C*P)
+
+    rt_si32 frep;
+#define inf_FREP            DP(Q*0x100+0x01C+0x03C*P)
+
 };
 
 /*
@@ -137,6 +177,14 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
 #define AJ1                 DP(Q*0x010)
 #define AJ2                 DP(Q*0x020)
 
+/*
+ * Working-set sweep sizes (in bytes per array) for streaming stores,
+ * SWP_MAX is set beyond typical last-level cache sizes.
+ */
+#define SWP_MIN             (16*1024)
+#define SWP_NUM             7
+#define SWP_MAX             (SWP_MIN << 2*(SWP_NUM-1))
+
 /******************************************************************************/
 /******************************   RUN LEVEL  1   ******************************/
 /******************************************************************************/
@@ -2759,8 +2807,15 @@ rt_void c_test20(rt_SIMD_INFOX *info)
         j = n;
         while (j-->0)
         {
-            fco1[j] = far0[j] + far0[(j + S) % n] * far0[(j + 2*S) % n];
-            fco2[j] = far0[j] - far0[(j + S) % n] * far0[(j + 2*S) % n];
+            rt_real b = far0[(j + S) % n], c = far0[(j + 2*S) % n];
+
+            if (j >= 2*S) /* S == T case, keeps product in test's range */
+            {
+                b = c = RT_SQRT(b);
+            }
+
+            fco1[j] = far0[j] + b * c;
+            fco2[j] = far0[j] - b * c;
         }
     }
 }
@@ -2822,20 +2877,18 @@ rt_void s_test20(rt_SIMD_INFOX *info)
 #endif /* RT_ELEM_TEST */
 
         movpx_ld(Xmm0, Mecx, AJ2)
-        movpx_ld(Xmm1, Mecx, AJ0)
-        movpx_ld(Xmm2, Mecx, AJ1)
+        sqrps_ld(Xmm1, Mecx, AJ0)
         movpx_rr(Xmm3, Xmm0)
-        fmaps_rr(Xmm0, Xmm1, Xmm2)
-        fmsps_rr(Xmm3, Xmm1, Xmm2)
+        fmaps_rr(Xmm0, Xmm1, Xmm1)
+        fmsps_rr(Xmm3, Xmm1, Xmm1)
         movpx_st(Xmm0, Medx, AJ2)
         movpx_st(Xmm3, Mebx, AJ2)
 #ifdef RT_ELEM_TEST
         movss_ld(Xmm0, Mecx, AJ2)
-        movss_ld(Xmm1, Mecx, AJ0)
-        movss_ld(Xmm2, Mecx, AJ1)
+        sqrss_ld(Xmm1, Mecx, AJ0)
         movss_rr(Xmm3, Xmm0)
-        fmass_rr(Xmm0, Xmm1, Xmm2)
-        fmsss_rr(Xmm3, Xmm1, Xmm2)
+        fmass_rr(Xmm0, Xmm1, Xmm1)
+        fmsss_rr(Xmm3, Xmm1, Xmm1)
         movss_st(Xmm0, Medx, AJ2)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
@@ -2866,6 +2919,12 @@ rt_void p_test20(rt_SIMD_INFOX *info)
                 j, far0[j], (j + S) % n, far0[(j + S) % n],
                 (j + 2*S) % n, far0[(j + 2*S) % n]);
 
+        if (j >= 2*S)
+        {
+            RT_LOGI("S == T case, both multipliers = sqrt(farr[%d]) = %e\n",
+                    (j + S) % n, RT_SQRT(far0[(j + S) % n]));
+        }
+
         RT_LOGI("C farr[%d]+farr[%d]*farr[%d] = %+.25e, "
                   "farr[%d]-farr[%d]*farr[%d] = %+.25e\n",
                 j, (j + S) % n, (j + 2*S) % n, fco1[j],
@@ -3367,147 +3426,2789 @@ rt_void p_test24(rt_SIMD_INFOX *info)
 #endif /* RUN_LEVEL 24 */
 
 /******************************************************************************/
-/*********************************   TABLES   *********************************/
+/******************************   RUN LEVEL 25   ******************************/
 /******************************************************************************/
 
-typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+#if RUN_LEVEL >= 25
 
-testXX c_test[RUN_LEVEL] =
+rt_void c_test25(rt_SIMD_INFOX *info)
 {
-#if RUN_LEVEL >=  1
-    c_test01,
-#endif /* RUN_LEVEL  1 */
+    rt_si32 i, j, n = info->size;
 
-#if RUN_LEVEL >=  2
-    c_test02,
-#endif /* RUN_LEVEL  2 */
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
 
-#if RUN_LEVEL >=  3
-    c_test03,
-#endif /* RUN_LEVEL  3 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            ico1[j] = iar0[j] << (iar0[j] & ((16 << L) - 1));
+            ico2[j] = iar0[j] >> (iar0[j] & ((16 << L) - 1));
+        }
+    }
+}
 
-#if RUN_LEVEL >=  4
-    c_test04,
-#endif /* RUN_LEVEL  4 */
+/*
+ * Same as s_test24, but entered via lightweight ASM_ENTER_L/ASM_LEAVE_L,
+ * which only preserve the declared BASE registers (compare "Time S" with 24).
+ */
+#define s_regs25(R) R(Resi) R(Redx) R(Rebx)
 
-#if RUN_LEVEL >=  5
-    c_test05,
-#endif /* RUN_LEVEL  5 */
+rt_void s_test25(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
 
-#if RUN_LEVEL >=  6
-    c_test06,
-#endif /* RUN_LEVEL  6 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER_L(info, s_regs25)
 
-#if RUN_LEVEL >=  7
-    c_test07,
-#endif /* RUN_LEVEL  7 */
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
 
-#if RUN_LEVEL >=  8
-    c_test08,
-#endif /* RUN_LEVEL  8 */
+        movpx_ld(Xmm7, Mebp, inf_GPC07)
+        shrpx_ri(Xmm7, IB(31*L-4))
 
-#if RUN_LEVEL >=  9
-    c_test09,
-#endif /* RUN_LEVEL  9 */
+        movpx_ld(Xmm0, Mesi, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        andpx_rr(Xmm0, Xmm7)
+        svlpx_rr(Xmm1, Xmm0)
+        svrpn_rr(Xmm2, Xmm0)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ0)
 
-#if RUN_LEVEL >= 10
-    c_test10,
-#endif /* RUN_LEVEL 10 */
+        movpx_ld(Xmm0, Mesi, AJ1)
+        movpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        andpx_rr(Xmm0, Xmm7)
+        movpx_st(Xmm0, Medx, AJ1)
+        svlpx_ld(Xmm1, Medx, AJ1)
+        svrpn_ld(Xmm2, Medx, AJ1)
+        movpx_st(Xmm1, Medx, AJ1)
+        movpx_st(Xmm2, Mebx, AJ1)
 
-#if RUN_LEVEL >= 11
-    c_test11,
-#endif /* RUN_LEVEL 11 */
+        movpx_ld(Xmm0, Mesi, AJ2)
+        movpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        andpx_rr(Xmm0, Xmm7)
+        svlpx_rr(Xmm1, Xmm0)
+        svrpn_rr(Xmm2, Xmm0)
+        movpx_st(Xmm1, Medx, AJ2)
+        movpx_st(Xmm2, Mebx, AJ2)
 
-#if RUN_LEVEL >= 12
-    c_test12,
-#endif /* RUN_LEVEL 12 */
+        ASM_LEAVE_L(info, s_regs25)
+    }
+}
 
-#if RUN_LEVEL >= 13
-    c_test13,
-#endif /* RUN_LEVEL 13 */
+rt_void p_test25(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if RUN_LEVEL >= 14
-    c_test14,
-#endif /* RUN_LEVEL 14 */
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
 
-#if RUN_LEVEL >= 15
-    c_test15,
-#endif /* RUN_LEVEL 15 */
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if RUN_LEVEL >= 16
-    c_test16,
-#endif /* RUN_LEVEL 16 */
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
 
-#if RUN_LEVEL >= 17
-    c_test17,
-#endif /* RUN_LEVEL 17 */
+        RT_LOGI("C iarr[%d]<<(iarr[%d]&((16<<L)-1)) = %" PR_L "d, "
+                  "iarr[%d]>>(iarr[%d]&((16<<L)-1)) = %" PR_L "d\n",
+                j, j, ico1[j], j, j, ico2[j]);
 
-#if RUN_LEVEL >= 18
-    c_test18,
-#endif /* RUN_LEVEL 18 */
+        RT_LOGI("S iarr[%d]<<(iarr[%d]&((16<<L)-1)) = %" PR_L "d, "
+                  "iarr[%d]>>(iarr[%d]&((16<<L)-1)) = %" PR_L "d\n",
+                j, j, iso1[j], j, j, iso2[j]);
+    }
+}
 
-#if RUN_LEVEL >= 19
-    c_test19,
-#endif /* RUN_LEVEL 19 */
+#endif /* RUN_LEVEL 25 */
 
-#if RUN_LEVEL >= 20
-    c_test20,
-#endif /* RUN_LEVEL 20 */
+/******************************************************************************/
+/******************************   RUN LEVEL 26   ******************************/
+/******************************************************************************/
 
-#if RUN_LEVEL >= 21
-    c_test21,
-#endif /* RUN_LEVEL 21 */
+#if RUN_LEVEL >= 26
 
-#if RUN_LEVEL >= 22
-    c_test22,
-#endif /* RUN_LEVEL 22 */
+rt_void c_test26(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
 
-#if RUN_LEVEL >= 23
-    c_test23,
-#endif /* RUN_LEVEL 23 */
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
 
-#if RUN_LEVEL >= 24
-    c_test24,
-#endif /* RUN_LEVEL 24 */
-};
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            ico1[j] = iar0[j] << (iar0[j] & ((16 << L) - 1));
+            ico2[j] = iar0[j] >> (iar0[j] & ((16 << L) - 1));
+        }
+    }
+}
 
-testXX s_test[RUN_LEVEL] =
+/*
+ * Same as s_test24, but all cycles are run as a batch of work items
+ * within a single ASM_ENTER/ASM_LEAVE (compare "Time S" with 24).
+ * Work items alias the same info (zero stride) to match per-call levels.
+ */
+rt_void s_test26(rt_SIMD_INFOX *info)
 {
-#if RUN_LEVEL >=  1
-    s_test01,
-#endif /* RUN_LEVEL  1 */
-
-#if RUN_LEVEL >=  2
-    s_test02,
-#endif /* RUN_LEVEL  2 */
-
-#if RUN_LEVEL >=  3
-    s_test03,
-#endif /* RUN_LEVEL  3 */
+    info->bptr = info;
+    info->bcnt = info->cyc;
+    info->bstr = 0;
 
-#if RUN_LEVEL >=  4
-    s_test04,
-#endif /* RUN_LEVEL  4 */
+    ASM_ENTER(info)
 
-#if RUN_LEVEL >=  5
-    s_test05,
-#endif /* RUN_LEVEL  5 */
+    batch_beg(Recx, inf_BPTR, bat_beg)
 
-#if RUN_LEVEL >=  6
-    s_test06,
-#endif /* RUN_LEVEL  6 */
+        movxx_ld(Resi, Mecx, inf_IAR0)
+        movxx_ld(Redx, Mecx, inf_ISO1)
+        movxx_ld(Rebx, Mecx, inf_ISO2)
 
-#if RUN_LEVEL >=  7
-    s_test07,
-#endif /* RUN_LEVEL  7 */
+        movpx_ld(Xmm7, Mebp, inf_GPC07)
+        shrpx_ri(Xmm7, IB(31*L-4))
 
-#if RUN_LEVEL >=  8
-    s_test08,
-#endif /* RUN_LEVEL  8 */
+        movpx_ld(Xmm0, Mesi, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        andpx_rr(Xmm0, Xmm7)
+        svlpx_rr(Xmm1, Xmm0)
+        svrpn_rr(Xmm2, Xmm0)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ0)
 
-#if RUN_LEVEL >=  9
-    s_test09,
-#endif /* RUN_LEVEL  9 */
+        movpx_ld(Xmm0, Mesi, AJ1)
+        movpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        andpx_rr(Xmm0, Xmm7)
+        movpx_st(Xmm0, Medx, AJ1)
+        svlpx_ld(Xmm1, Medx, AJ1)
+        svrpn_ld(Xmm2, Medx, AJ1)
+        movpx_st(Xmm1, Medx, AJ1)
+        movpx_st(Xmm2, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mesi, AJ2)
+        movpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        andpx_rr(Xmm0, Xmm7)
+        svlpx_rr(Xmm1, Xmm0)
+        svrpn_rr(Xmm2, Xmm0)
+        movpx_st(Xmm1, Medx, AJ2)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+    batch_end(inf_BPTR, inf_BCNT, inf_BSTR, bat_beg)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test26(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+
+        RT_LOGI("C iarr[%d]<<(iarr[%d]&((16<<L)-1)) = %" PR_L "d, "
+                  "iarr[%d]>>(iarr[%d]&((16<<L)-1)) = %" PR_L "d\n",
+                j, j, ico1[j], j, j, ico2[j]);
+
+        RT_LOGI("S iarr[%d]<<(iarr[%d]&((16<<L)-1)) = %" PR_L "d, "
+                  "iarr[%d]>>(iarr[%d]&((16<<L)-1)) = %" PR_L "d\n",
+                j, j, iso1[j], j, j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 26 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 27   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 27
+
+rt_void c_test27(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[j] + far0[(j + S) % n];
+        }
+        j = n;
+        while (j-->0)
+        {
+            fco2[j] = fco1[j] * far0[j] - fco2[j] * (rt_real)0.5;
+        }
+    }
+}
+
+/*
+ * Short SIMD section followed by compiler-generated (legacy SSE) code,
+ * which stalls on AVX targets if upper halves of SIMD registers are left
+ * dirty by the SIMD section. Compare "Time S" between default builds and
+ * builds with RT_SIMD_COMPAT_VZU=0 (no vzero_xx in ASM_LEAVE) to measure.
+ */
+#define s_regs27(R) R(Recx) R(Redx)
+
+rt_void s_test27(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER_L(info, s_regs27)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        addps_ld(Xmm0, Mecx, AJ1)
+        movpx_st(Xmm0, Medx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        addps_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Medx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        addps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ2)
+
+        ASM_LEAVE_L(info, s_regs27)
+
+        j = n;
+        while (j-->0)
+        {
+            fso2[j] = fso1[j] * far0[j] - fso2[j] * (rt_real)0.5;
+        }
+    }
+}
+
+rt_void p_test27(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C farr[%d]+farr[%d] = %e, (...)*farr[%d]-(...)*0.5 = %e\n",
+                j, (j + S) % n, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S farr[%d]+farr[%d] = %e, (...)*farr[%d]-(...)*0.5 = %e\n",
+                j, (j + S) % n, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 27 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 28   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 28
+
+rt_void c_test28(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        k = 3;
+        while (k-->0)
+        {
+            rt_real sum = far0[k*S], min = far0[k*S], max = far0[k*S];
+            for (j = 1; j < S; j++)
+            {
+                sum = sum + far0[k*S + j];
+                min = RT_MIN(min, far0[k*S + j]);
+                max = RT_MAX(max, far0[k*S + j]);
+            }
+            fco1[k] = sum;
+            fco2[k] = min;
+            fco2[k + 3] = max;
+        }
+    }
+}
+
+rt_void s_test28(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        adhps_rr(Xmm1, Xmm0)
+        mnhps_rr(Xmm2, Xmm0)
+        mxhps_rr(Xmm3, Xmm0)
+        movss_st(Xmm1, Medx, DP(0x00*L))
+        movss_st(Xmm2, Mebx, DP(0x00*L))
+        movss_st(Xmm3, Mebx, DP(0x0C*L))
+
+        adhps_ld(Xmm1, Mesi, AJ1)
+        mnhps_ld(Xmm2, Mesi, AJ1)
+        mxhps_ld(Xmm3, Mesi, AJ1)
+        movss_st(Xmm1, Medx, DP(0x04*L))
+        movss_st(Xmm2, Mebx, DP(0x04*L))
+        movss_st(Xmm3, Mebx, DP(0x10*L))
+
+        movpx_ld(Xmm0, Mesi, AJ2)
+        adhps_rr(Xmm0, Xmm0)
+        movss_st(Xmm0, Medx, DP(0x08*L))
+        movpx_ld(Xmm0, Mesi, AJ2)
+        mnhps_rr(Xmm0, Xmm0)
+        movss_st(Xmm0, Mebx, DP(0x08*L))
+        movpx_ld(Xmm0, Mesi, AJ2)
+        mxhps_rr(Xmm0, Xmm0)
+        movss_st(Xmm0, Mebx, DP(0x14*L))
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test28(rt_SIMD_INFOX *info)
+{
+    rt_si32 k;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    k = 3;
+    while (k-->0)
+    {
+        if (FEQ(fco1[k], fso1[k]) && FEQ(fco2[k], fso2[k])
+        &&  FEQ(fco2[k + 3], fso2[k + 3]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d..%d] = [%e .. %e]\n",
+                k*S, k*S + S - 1, far0[k*S], far0[k*S + S - 1]);
+
+        RT_LOGI("C sum(farr[...]) = %e, min(...) = %e, max(...) = %e\n",
+                fco1[k], fco2[k], fco2[k + 3]);
+
+        RT_LOGI("S sum(farr[...]) = %e, min(...) = %e, max(...) = %e\n",
+                fso1[k], fso2[k], fso2[k + 3]);
+    }
+}
+
+#endif /* RUN_LEVEL 28 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 29   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 29
+
+rt_void c_test29(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_elem *ico1 = info->ico1;
+
+    j = n;
+    while (j-->0)
+    {
+        ico1[j] = (j * 5 + 1) % n;
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[ico1[j]];
+            fco2[ico1[j]] = far0[j];
+        }
+    }
+}
+
+/*
+ * Indices (j * 5 + 1) % n form a permutation of [0, n - 1] as n = S * 3,
+ * gather/scatter are native on AVX2/AVX-512 targets, element-wise elsewhere.
+ */
+rt_void s_test29(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iso1 = info->iso1;
+
+    j = n;
+    while (j-->0)
+    {
+        iso1[j] = (j * 5 + 1) % n;
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_FSO1)
+        movxx_ld(Recx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm2, Medx, AJ0)
+        gatpx_ld(Xmm1, Resi, Xmm2)
+        movpx_st(Xmm1, Mebx, AJ0)
+        movpx_ld(Xmm1, Mesi, AJ0)
+        sctpx_st(Xmm1, Recx, Xmm2)
+
+        movpx_ld(Xmm2, Medx, AJ1)
+        gatpx_ld(Xmm1, Resi, Xmm2)
+        movpx_st(Xmm1, Mebx, AJ1)
+        movpx_ld(Xmm1, Mesi, AJ1)
+        sctpx_st(Xmm1, Recx, Xmm2)
+
+        movpx_ld(Xmm2, Medx, AJ2)
+        gatpx_ld(Xmm1, Resi, Xmm2)
+        movpx_st(Xmm1, Mebx, AJ2)
+        movpx_ld(Xmm1, Mesi, AJ2)
+        sctpx_st(Xmm1, Recx, Xmm2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test29(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+    rt_elem *ico1 = info->ico1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d\n",
+                j, far0[j], j, ico1[j]);
+
+        RT_LOGI("C farr[iarr[%d]] = %e, farr[%d] at [iarr[...]] = %e\n",
+                j, fco1[j], j, fco2[ico1[j]]);
+
+        RT_LOGI("S farr[iarr[%d]] = %e, farr[%d] at [iarr[...]] = %e\n",
+                j, fso1[j], j, fso2[ico1[j]]);
+    }
+}
+
+#endif /* RUN_LEVEL 29 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 30   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 30
+
+/*
+ * Returns the high half of the unsigned double-width product (a * b)
+ * computed from half-width partial products to stay within rt_uelm.
+ */
+rt_uelm mulhi(rt_uelm a, rt_uelm b)
+{
+    rt_uelm h = 16*L, m = ((rt_uelm)1 << h) - 1;
+
+    rt_uelm ll = (a & m) * (b & m), lh = (a & m) * (b >> h);
+    rt_uelm hl = (a >> h) * (b & m), hh = (a >> h) * (b >> h);
+
+    rt_uelm c = (ll >> h) + (lh & m) + (hl & m);
+
+    return hh + (lh >> h) + (hl >> h) + (c >> h);
+}
+
+rt_void c_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_uelm a = iar0[j], b = iar0[(j + S) % n], c = 0 - b;
+
+            ico1[j] = (rt_elem)(a * b + mulhi(a, b));
+            ico2[j] = (rt_elem)(mulhi(a, c) - (iar0[j] < 0 ? c : 0)
+                                            - ((rt_elem)c < 0 ? a : 0));
+        }
+    }
+}
+
+/*
+ * Low half of the product is native on SSE4/AVX/AVX2/AVX-512/NEON/MSA/VSX2,
+ * high half (as well as 64-bit low half on most targets) is element-wise.
+ */
+rt_void s_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Rebx, Mebp, inf_ISO1)
+        movxx_ld(Resi, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        movpx_ld(Xmm2, Mecx, AJ1)
+        mulpx3rr(Xmm3, Xmm1, Xmm2)
+        mhipx_ld(Xmm1, Mecx, AJ1)
+        addpx_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ0)
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        mhipn_rr(Xmm1, Xmm4)
+        movpx_st(Xmm1, Mesi, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_ld(Xmm2, Mecx, AJ2)
+        movpx_rr(Xmm3, Xmm1)
+        mulpx_ld(Xmm3, Mecx, AJ2)
+        mhipx3rr(Xmm5, Xmm1, Xmm2)
+        addpx_rr(Xmm3, Xmm5)
+        movpx_st(Xmm3, Mebx, AJ1)
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm2)
+        movpx_st(Xmm4, Mesi, AJ1)
+        mhipn3ld(Xmm5, Xmm1, Mesi, AJ1)
+        movpx_st(Xmm5, Mesi, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        mhipx3ld(Xmm3, Xmm1, Mecx, AJ0)
+        mulpx3ld(Xmm1, Xmm1, Mecx, AJ0)
+        addpx_rr(Xmm1, Xmm3)
+        movpx_st(Xmm1, Mebx, AJ2)
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm2)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        mhipn3rr(Xmm1, Xmm1, Xmm4)
+        movpx_st(Xmm1, Mesi, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d\n",
+                j, iar0[j], (j + S) % n, iar0[(j + S) % n]);
+
+        RT_LOGI("C mul+mhi(iarr[%d],iarr[%d]) = %" PR_L "d, "
+                  "mhin(iarr[%d],-iarr[%d]) = %" PR_L "d\n",
+                j, (j + S) % n, ico1[j], j, (j + S) % n, ico2[j]);
+
+        RT_LOGI("S mul+mhi(iarr[%d],iarr[%d]) = %" PR_L "d, "
+                  "mhin(iarr[%d],-iarr[%d]) = %" PR_L "d\n",
+                j, (j + S) % n, iso1[j], j, (j + S) % n, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 30 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 31   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 31
+
+/*
+ * Working-set sweep: D = S + S over SWP_NUM sizes from SWP_MIN to SWP_MAX
+ * bytes per array, stepping by 4x, each size repeated to move the same total
+ * amount of data (info->cyc / 64 passes over the smallest size).
+ * C code uses regular stores, SIMD code uses streaming stores and prefetch.
+ * A window of ARR_SIZE elements is copied out (and cleared) for comparison.
+ */
+rt_void c_test31(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n;
+
+    rt_real *fsrc = info->fsrc;
+    rt_real *fdst = info->fdst;
+    rt_real *fco1 = info->fco1;
+
+    for (k = 0; k < SWP_NUM; k++)
+    {
+        n = (SWP_MIN << 2*k) / sizeof(rt_real);
+        i = (info->cyc / 64) >> 2*k;
+        while (i-->0)
+        {
+            j = n;
+            while (j-->0)
+            {
+                fdst[j] = fsrc[j] + fsrc[j];
+            }
+        }
+    }
+
+    memcpy(fco1, fdst, ARR_SIZE * sizeof(rt_real));
+    memset(fdst, 0, ARR_SIZE * sizeof(rt_real));
+}
+
+rt_void s_test31(rt_SIMD_INFOX *info)
+{
+    info->fcnt = SWP_MIN / sizeof(rt_real);
+    info->frep = info->cyc / 64;
+
+    ASM_ENTER(info)
+
+        movwx_mi(Mebp, inf_SIMD, IB(SWP_NUM))
+
+    LBL(swp_beg)
+
+        movwx_ld(Redx, Mebp, inf_FREP)
+
+    LBL(rep_beg)
+
+        movxx_ld(Resi, Mebp, inf_FSRC)
+        movxx_ld(Redi, Mebp, inf_FDST)
+        movwx_ld(Recx, Mebp, inf_FCNT)
+
+    LBL(str_beg)
+
+        prfxx_l1(Mesi, DP(Q*0x080))
+        movpx_ld(Xmm1, Mesi, AJ0)
+        addps_rr(Xmm1, Xmm1)
+        movpx_nt(Xmm1, Medi, AJ0)
+        movpx_ld(Xmm2, Mesi, AJ1)
+        addps_rr(Xmm2, Xmm2)
+        movpx_nt(Xmm2, Medi, AJ1)
+
+        addxx_ri(Resi, IH(Q*0x020))
+        addxx_ri(Redi, IH(Q*0x020))
+        subwx_ri(Recx, IB(S*2))
+        cmjwx_rz(Recx,
+        /* if */ GT_x, str_beg)
+
+        subwx_ri(Redx, IB(1))
+        cmjwx_rz(Redx,
+        /* if */ GT_x, rep_beg)
+
+        shlwx_mi(Mebp, inf_FCNT, IB(2))
+        shrwx_mi(Mebp, inf_FREP, IB(2))
+        subwx_mi(Mebp, inf_SIMD, IB(1))
+        cmjwx_mz(Mebp, inf_SIMD,
+        /* if */ GT_x, swp_beg)
+
+    ASM_LEAVE(info)
+
+    memcpy(info->fso1, info->fdst, ARR_SIZE * sizeof(rt_real));
+}
+
+rt_void p_test31(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *fsrc = info->fsrc;
+    rt_real *fco1 = info->fco1;
+    rt_real *fso1 = info->fso1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, fsrc[j]);
+
+        RT_LOGI("C farr[%d]+farr[%d] = %e\n",
+                j, j, fco1[j]);
+
+        RT_LOGI("S farr[%d]+farr[%d] = %e\n",
+                j, j, fso1[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 31 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 32   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 32
+
+/*
+ * Tail counts for vectors AJ0, AJ1, AJ2 (empty, partial, exceeding width).
+ */
+#define TLC(k)              ((k)*(S/2+1))
+
+rt_void c_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_bool t = j % S < TLC(j / S);
+
+            fco1[j] = t ? far0[j] + far0[j] : far0[j];
+            fco2[j] = t ? far0[j] : 0.0;
+        }
+    }
+}
+
+/*
+ * Tail mask is built element-wise on all targets, masked load is native on
+ * AVX/AVX-512, masked store is native on AVX/AVX-512, blend-based elsewhere.
+ */
+rt_void s_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm1, Mesi, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
+        movwx_ri(Recx, IB(TLC(0)))
+        mktpx_xr(Recx)
+        mmzpx_ld(Xmm2, Mesi, AJ0)
+        movpx_st(Xmm2, Medx, AJ0)
+        addps_rr(Xmm2, Xmm2)
+        mmvpx_st(Xmm2, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mesi, AJ1)
+        movpx_st(Xmm1, Mebx, AJ1)
+        movwx_ri(Reax, IB(TLC(1)))
+        mktpx_xr(Reax)
+        mmzpx_ld(Xmm3, Mesi, AJ1)
+        movpx_st(Xmm3, Medx, AJ1)
+        addps_rr(Xmm3, Xmm3)
+        mmvpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mesi, AJ2)
+        movpx_st(Xmm1, Mebx, AJ2)
+        movwx_ri(Recx, IB(TLC(2)))
+        mktpx_xr(Recx)
+        mmzpx_ld(Xmm4, Mesi, AJ2)
+        movpx_st(Xmm4, Medx, AJ2)
+        addps_rr(Xmm4, Xmm4)
+        mmvpx_st(Xmm4, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, tail = %d\n",
+                j, far0[j], TLC(j / S));
+
+        RT_LOGI("C mmv(farr[%d]+farr[%d]) = %e, mmz(farr[%d]) = %e\n",
+                j, j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S mmv(farr[%d]+farr[%d]) = %e, mmz(farr[%d]) = %e\n",
+                j, j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 32 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 33   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 33
+
+rt_void c_test33(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = j < n - 1 ? far0[j] * far0[j] + far0[j] : far0[j];
+            fco2[j] = fco1[j];
+        }
+    }
+}
+
+/*
+ * Width-agnostic kernel D = S * S + S over RC elements from Resi to Redi
+ * leaving elements past RC unchanged, destroys RC, Reax, Redx, Resi, Redi.
+ */
+#define strip_test(RC, lb, le, lt)                                          \
+        strip_beg(W(RC), Redx, lb, le)                                      \
+        movpx_ld(Xmm1, Mesi, AJ0)                                           \
+        movpx_rr(Xmm2, Xmm1)                                                \
+        mulps_rr(Xmm2, Xmm1)                                                \
+        addps_rr(Xmm2, Xmm1)                                                \
+        movpx_st(Xmm2, Medi, AJ0)                                           \
+        strip_adv(Resi)                                                     \
+        strip_adv(Redi)                                                     \
+        strip_end(Redx, lb, le)                                             \
+        strip_tail(W(RC), lt)                                               \
+        mmzpx_ld(Xmm1, Mesi, AJ0)                                           \
+        movpx_rr(Xmm2, Xmm1)                                                \
+        mulps_rr(Xmm2, Xmm1)                                                \
+        addps_rr(Xmm2, Xmm1)                                                \
+        mmvpx_st(Xmm2, Medi, AJ0)                                           \
+        strip_done(lt)
+
+/*
+ * Strip-mined loops over (3*S - 1) elements (full vectors and a tail),
+ * then 2*S elements (no tail) and (S - 1) elements (tail only).
+ */
+rt_void s_test33(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        memcpy(info->fso1, info->far0, ARR_SIZE * sizeof(rt_real));
+        memcpy(info->fso2, info->far0, ARR_SIZE * sizeof(rt_real));
+
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redi, Mebp, inf_FSO1)
+        movwx_ri(Recx, IH(S*3-1))
+        strip_test(Recx, sm1_beg, sm1_end, sm1_out)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Redi, Mebp, inf_FSO2)
+        movwx_ri(Recx, IH(S*2))
+        strip_test(Recx, sm2_beg, sm2_end, sm2_out)
+
+        movwx_ri(Recx, IH(S*1-1))
+        strip_test(Recx, sm3_beg, sm3_end, sm3_out)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test33(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C farr[%d]*farr[%d]+farr[%d] = %e, %e\n",
+                j, j, j, fco1[j], fco2[j]);
+
+        RT_LOGI("S farr[%d]*farr[%d]+farr[%d] = %e, %e\n",
+                j, j, j, fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 33 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 34   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 34
+
+/*
+ * Results rounded up (ROUNDP) and down (ROUNDM) only differ if inexact,
+ * SIMD fp-arithmetic on ARMv7 and pre-VSX Power always rounds to nearest.
+ */
+#if (defined RT_ARM) || (defined RT_P32) && (RT_SIMD == 128 && RT_128X1 == 4 \
+                                         ||  RT_SIMD == 256 && RT_128X2 & 16)
+#define RND_INX(e)          0
+#else  /* directed rounding is supported in SIMD fp-arithmetic */
+#define RND_INX(e)          ((e) != 0.0)
+#endif /* directed rounding */
+
+rt_void c_test34(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real a = far0[j], b = far0[(j + S) % n];
+            rt_real s = a + b, t = s - a, p = a * b, q = a / b;
+
+            ico1[j] = -(rt_elem)RND_INX((a - (s - t)) + (b - t));
+            ico2[j] = -(rt_elem)RND_INX(RT_FMA(a, b, -p)) * 2
+                      -(rt_elem)RND_INX(RT_FMA(-q, b, a));
+            fco1[j] = a - b;
+            fco2[j] = a + q * b;
+        }
+    }
+}
+
+/*
+ * Masks of (ROUNDP != ROUNDM) for adr (iso1), mlr * 2 + dvr (iso2),
+ * values of sbr in ROUNDZ (fso1) and fmr in default ROUNDN (fso2).
+ */
+#define rnd_test(DA, DB)                                                    \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        movpx_ld(Xmm2, Mesi, W(DB))                                         \
+        movpx_rr(Xmm3, Xmm1)                                                \
+        movpx_rr(Xmm4, Xmm1)                                                \
+        adrps_rr(Xmm3, Xmm2, ROUNDP)                                        \
+        adrps_rr(Xmm4, Xmm2, ROUNDM)                                        \
+        cneps_rr(Xmm3, Xmm4)                                                \
+        movpx_st(Xmm3, Mebx, W(DA))                                         \
+        movpx_rr(Xmm5, Xmm1)                                                \
+        movpx_rr(Xmm6, Xmm1)                                                \
+        mlrps_rr(Xmm5, Xmm2, ROUNDP)                                        \
+        mlrps_rr(Xmm6, Xmm2, ROUNDM)                                        \
+        cneps_rr(Xmm5, Xmm6)                                                \
+        addpx_rr(Xmm5, Xmm5)                                                \
+        movpx_rr(Xmm3, Xmm1)                                                \
+        movpx_rr(Xmm4, Xmm1)                                                \
+        dvrps_rr(Xmm3, Xmm2, ROUNDP)                                        \
+        dvrps_rr(Xmm4, Xmm2, ROUNDM)                                        \
+        cneps_rr(Xmm3, Xmm4)                                                \
+        addpx_rr(Xmm5, Xmm3)                                                \
+        movpx_st(Xmm5, Medx, W(DA))                                         \
+        movpx_rr(Xmm3, Xmm1)                                                \
+        sbrps_rr(Xmm3, Xmm2, ROUNDZ)                                        \
+        movpx_st(Xmm3, Mecx, W(DA))                                         \
+        movpx_rr(Xmm3, Xmm1)                                                \
+        dvrps_rr(Xmm3, Xmm2, ROUNDN)                                        \
+        fmrps_rr(Xmm1, Xmm3, Xmm2, ROUNDN)                                  \
+        movpx_st(Xmm1, Medi, W(DA))
+
+rt_void s_test34(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_ISO1)
+        movxx_ld(Redx, Mebp, inf_ISO2)
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redi, Mebp, inf_FSO2)
+
+        rnd_test(AJ0, AJ1)
+        rnd_test(AJ1, AJ2)
+        rnd_test(AJ2, AJ0)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test34(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j])
+        &&  FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C inexact(add) = %" PR_L "d, inexact(mul*2+div) = %" PR_L
+                "d, sub = %e, fma = %e\n",
+                ico1[j], ico2[j], fco1[j], fco2[j]);
+
+        RT_LOGI("S inexact(add) = %" PR_L "d, inexact(mul*2+div) = %" PR_L
+                "d, sub = %e, fma = %e\n",
+                iso1[j], iso2[j], fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 34 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 35   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 35
+
+rt_void c_test35(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = RT_LOG(far0[j]) + RT_EXP(-far0[j]);
+            fco2[j] = RT_POW(far0[j], -0.5);
+        }
+    }
+}
+
+#define xpl_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        logps_rr(Xmm2, Xmm3, Xmm4, Xmm1)                                    \
+        negps_rr(Xmm5, Xmm1)                                                \
+        expps_rr(Xmm6, Xmm3, Xmm4, Xmm5)                                    \
+        addps_rr(Xmm2, Xmm6)                                                \
+        movpx_st(Xmm2, Mecx, W(DA))                                         \
+        movpx_ld(Xmm5, Mebp, inf_GPC02)                                     \
+        powps_rr(Xmm2, Xmm3, Xmm4, Xmm1, Xmm5)                              \
+        movpx_st(Xmm2, Medx, W(DA))
+
+rt_void s_test35(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        xpl_test(AJ0)
+        xpl_test(AJ1)
+        xpl_test(AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test35(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C log(farr[%d])+exp(-farr[%d]) = %e, "
+                  "pow(farr[%d], -0.5) = %e\n",
+                j, j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S log(farr[%d])+exp(-farr[%d]) = %e, "
+                  "pow(farr[%d], -0.5) = %e\n",
+                j, j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 35 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 36   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 36
+
+rt_void c_test36(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = RT_SIN(far0[j]) + RT_COS(far0[j]);
+            fco2[j] = RT_ATAN2(RT_SIN(far0[j]), RT_COS(far0[j]));
+        }
+    }
+}
+
+#define trg_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        sinps_rr(Xmm2, Xmm3, Xmm4, Xmm1)                                    \
+        cosps_rr(Xmm5, Xmm3, Xmm4, Xmm1)                                    \
+        addps_rr(Xmm2, Xmm5)                                                \
+        movpx_st(Xmm2, Mecx, W(DA))                                         \
+        scsps_rr(Xmm2, Xmm5, Xmm3, Xmm1)                                    \
+        atnps_rr(Xmm6, Xmm3, Xmm4, Xmm7, Xmm2, Xmm5)                        \
+        movpx_st(Xmm6, Medx, W(DA))
+
+rt_void s_test36(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        trg_test(AJ0)
+        trg_test(AJ1)
+        trg_test(AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+/* difference in ulps relative to the reference value f1 */
+#if   RT_ELEMENT == 32
+#define FUL(f1, f2)         (RT_FABS((f1) - (f2)) / (RT_FABS(f1) * FLT_EPSILON))
+#elif RT_ELEMENT == 64
+#define FUL(f1, f2)         (RT_FABS((f1) - (f2)) / (RT_FABS(f1) * DBL_EPSILON))
+#endif /* RT_ELEMENT */
+
+rt_void p_test36(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C sin(farr[%d])+cos(farr[%d]) = %e, "
+                  "atan2(sin(farr[%d]), cos(farr[%d])) = %e\n",
+                j, j, fco1[j], j, j, fco2[j]);
+
+        RT_LOGI("S sin(farr[%d])+cos(farr[%d]) = %e, "
+                  "atan2(sin(farr[%d]), cos(farr[%d])) = %e\n",
+                j, j, fso1[j], j, j, fso2[j]);
+
+        RT_LOGI("ulp error = %.1f, %.1f\n",
+                FUL(fco1[j], fso1[j]), FUL(fco2[j], fso2[j]));
+    }
+}
+
+#endif /* RUN_LEVEL 36 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 37   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 37
+
+/* scalar reference for rngpx_rr/rngps_rr (xorshift with scrambled output) */
+#if   RT_ELEMENT == 32
+#define RNG_NEXT(s)         ((s) ^= (s) << 13, (s) ^= (s) >> 17,            \
+                             (s) ^= (s) << 5)
+#define RNG_REAL(s)         ((rt_real)((rt_uelm)((s) * 0x9E3779BB) >> 9) /  \
+                             (rt_real)(1 << 23))
+#elif RT_ELEMENT == 64
+#define RNG_NEXT(s)         ((s) ^= (s) >> 12, (s) ^= (s) << 25,            \
+                             (s) ^= (s) >> 27)
+#define RNG_REAL(s)         ((rt_real)((rt_uelm)((s) *                      \
+                             LL(0x2545F4914F6CDD1D)) >> 12) /               \
+                             (rt_real)(LL(1) << 52))
+#endif /* RT_ELEMENT */
+
+rt_void c_test37(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    rt_uelm s;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            s = (rt_uelm)iar0[j];
+            RNG_NEXT(s);
+            fco1[j] = RNG_REAL(s);
+            RNG_NEXT(s);
+            RNG_NEXT(s);
+            RNG_NEXT(s);
+            fco2[j] = RNG_REAL(s);
+        }
+    }
+}
+
+#define rng_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        rngps_rr(Xmm2, Xmm1)                                                \
+        movpx_st(Xmm2, Mecx, W(DA))                                         \
+        rngpx_rr(Xmm1, Xmm3)                                                \
+        rngpx_rr(Xmm1, Xmm3)                                                \
+        rngps_rr(Xmm2, Xmm1)                                                \
+        movpx_st(Xmm2, Medx, W(DA))
+
+rt_void s_test37(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        rng_test(AJ0)
+        rng_test(AJ1)
+        rng_test(AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test37(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+
+        RT_LOGI("C rng1(iarr[%d]) = %e, rng4(iarr[%d]) = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S rng1(iarr[%d]) = %e, rng4(iarr[%d]) = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 37 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 38   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 38
+
+/*
+ * Cross-precision converters need fp64 SIMD (cmdq*) in fp32 builds,
+ * ARMv7, legacy x86 and pre-VSX Power only check fp32 arithmetic part.
+ */
+#if (defined RT_ARM) || (defined RT_X86) || (defined RT_P32) &&                \
+    (RT_SIMD == 128 && RT_128X1 == 4 || RT_SIMD == 256 && RT_128X2 & 16)
+#define CVP_F64             0
+#else  /* fp64 SIMD is supported */
+#define CVP_F64             1
+#endif /* fp64 SIMD */
+
+rt_void c_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+#if   RT_ELEMENT == 32 && CVP_F64
+            fco1[j] = (rt_real)((rt_fp64)far0[j] * far0[j] + far0[j]);
+            fco2[j] = far0[j - j % S + (j % S + S / 2) % S];
+#elif RT_ELEMENT == 32
+            fco1[j] = far0[j] * far0[j] + far0[j];
+            fco2[j] = far0[j];
+#elif RT_ELEMENT == 64
+            fco1[j] = (rt_real)(rt_fp32)far0[j];
+            fco2[j] = (rt_real)(rt_fp32)(far0[j] + far0[j]);
+#endif /* RT_ELEMENT */
+        }
+    }
+}
+
+#if   RT_ELEMENT == 32 && CVP_F64
+#define cvp_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        cvlqs_rr(Xmm2, Xmm1)                                                \
+        cvhqs_rr(Xmm3, Xmm1)                                                \
+        mulqs3rr(Xmm4, Xmm2, Xmm2)                                          \
+        addqs_rr(Xmm4, Xmm2)                                                \
+        mulqs3rr(Xmm5, Xmm3, Xmm3)                                          \
+        addqs_rr(Xmm5, Xmm3)                                                \
+        cvsos_rr(Xmm6, Xmm4, Xmm5)                                          \
+        movpx_st(Xmm6, Mecx, W(DA))                                         \
+        cvsos_rr(Xmm6, Xmm3, Xmm2)                                          \
+        movpx_st(Xmm6, Medx, W(DA))
+#elif RT_ELEMENT == 32
+#define cvp_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        mulps3rr(Xmm4, Xmm1, Xmm1)                                          \
+        addps_rr(Xmm4, Xmm1)                                                \
+        movpx_st(Xmm4, Mecx, W(DA))                                         \
+        movpx_st(Xmm1, Medx, W(DA))
+#elif RT_ELEMENT == 64
+#define cvp_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        addps3rr(Xmm2, Xmm1, Xmm1)                                          \
+        cvsos_rr(Xmm3, Xmm1, Xmm2)                                          \
+        cvlqs_rr(Xmm4, Xmm3)                                                \
+        movpx_st(Xmm4, Mecx, W(DA))                                         \
+        cvhqs_rr(Xmm5, Xmm3)                                                \
+        movpx_st(Xmm5, Medx, W(DA))
+#endif /* RT_ELEMENT */
+
+rt_void s_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        cvp_test(AJ0)
+        cvp_test(AJ1)
+        cvp_test(AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C cvt1(farr[%d]) = %e, cvt2(farr[%d]) = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S cvt1(farr[%d]) = %e, cvt2(farr[%d]) = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 38 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 39   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 39
+
+/* scalar reference for cvfos_st/cvfos_ld (fp16 round-to-nearest-even) */
+static rt_ui32 f32_to_f16(rt_fp32 f)
+{
+    union { rt_fp32 f; rt_ui32 u; } v;
+    rt_ui32 s, a, m, r, h;
+    rt_si32 e;
+
+    v.f = f;
+    s = (v.u >> 16) & 0x8000;
+    a = v.u & 0x7FFFFFFF;
+
+    if (a > 0x7F800000)
+    {
+        return s | 0x7E00;
+    }
+    if (a >= 0x477FF000)
+    {
+        return s | 0x7C00;
+    }
+    if (a >= 0x38800000)
+    {
+        a -= 0x38000000;
+        return s | ((a + 0x0FFF + ((a >> 13) & 1)) >> 13);
+    }
+    if (a < 0x33000000)
+    {
+        return s;
+    }
+    e = 126 - (rt_si32)(a >> 23);
+    m = (a & 0x007FFFFF) | 0x00800000;
+    r = m >> e;
+    h = m & ((1 << e) - 1);
+    if (h > (1u << (e - 1)) || (h == (1u << (e - 1)) && (r & 1)))
+    {
+        r++;
+    }
+    return s | r;
+}
+
+static rt_fp32 f16_to_f32(rt_ui32 h)
+{
+    union { rt_fp32 f; rt_ui32 u; } v;
+    rt_ui32 e = (h >> 10) & 0x1F, m = h & 0x3FF;
+
+    if (e == 0)
+    {
+        v.f = (rt_fp32)m / 16777216.0f;
+        v.u |= (h & 0x8000) << 16;
+    }
+    else
+    {
+        v.u = (h & 0x8000) << 16 | (e == 31 ? 0xFF : e + 112) << 23 | m << 13;
+    }
+    return v.f;
+}
+
+#define HLF(f)              f16_to_f32(f32_to_f16(f))
+
+rt_void c_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = (rt_real)HLF((rt_fp32)far0[j]);
+            fco2[j] = (rt_real)HLF(-(rt_fp32)far0[j] * 6.103515625e-05f);
+        }
+    }
+}
+
+#if   RT_ELEMENT == 32
+#define hlf_test(DA)                                                        \
+        movox_ld(Xmm1, Mesi, W(DA))                                         \
+        cvfos_st(Xmm1, Medx, W(DA))                                         \
+        cvfos_ld(Xmm2, Medx, W(DA))                                         \
+        movox_st(Xmm2, Mecx, W(DA))                                         \
+        movox_ld(Xmm1, Mesi, W(DA))                                         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        mulos_ld(Xmm1, Iebp, reg_HLF06_32)                                  \
+        xorox_ld(Xmm1, Mebp, inf_GPC06_32)                                  \
+        cvfos_st(Xmm1, Medx, W(DA))                                         \
+        cvfos_ld(Xmm2, Medx, W(DA))                                         \
+        movox_st(Xmm2, Medx, W(DA))
+#elif RT_ELEMENT == 64
+#define hlf_test(DA)                                                        \
+        movqx_ld(Xmm1, Mesi, W(DA))                                         \
+        cvsos_rr(Xmm1, Xmm1, Xmm1)                                          \
+        cvfos_st(Xmm1, Medx, W(DA))                                         \
+        cvfos_ld(Xmm2, Medx, W(DA))                                         \
+        cvlqs_rr(Xmm2, Xmm2)                                                \
+        movqx_st(Xmm2, Mecx, W(DA))                                         \
+        movqx_ld(Xmm1, Mesi, W(DA))                                         \
+        cvsos_rr(Xmm1, Xmm1, Xmm1)                                          \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        mulos_ld(Xmm1, Iebp, reg_HLF06_32)                                  \
+        xorox_ld(Xmm1, Mebp, inf_GPC06_32)                                  \
+        cvfos_st(Xmm1, Medx, W(DA))                                         \
+        cvfos_ld(Xmm2, Medx, W(DA))                                         \
+        cvlqs_rr(Xmm2, Xmm2)                                                \
+        movqx_st(Xmm2, Medx, W(DA))
+#endif /* RT_ELEMENT */
+
+rt_void s_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_FAR0)
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        hlf_test(AJ0)
+        hlf_test(AJ1)
+        hlf_test(AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (fco1[j] == fso1[j] && fco2[j] == fso2[j] && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C hlf1(farr[%d]) = %e, hlf2(farr[%d]) = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S hlf1(farr[%d]) = %e, hlf2(farr[%d]) = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 39 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 40   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 40
+
+#if (defined addmx_rr)
+
+#define SAT(v, lo, hi)      ((v) < (lo) ? (lo) : (v) > (hi) ? (hi) : (v))
+#define SXB(v)              ((rt_si32)((v) ^ 0x80) - 0x80)
+
+rt_void c_test40(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size * sizeof(rt_elem);
+    rt_si32 v = S * sizeof(rt_elem), h = v / 2, w;
+
+    rt_ui08 *a08 = (rt_ui08 *)info->iar0;
+    rt_ui08 *b08 = (rt_ui08 *)info->far0;
+    rt_ui08 *c08 = (rt_ui08 *)info->ico1;
+    rt_ui16 *a16 = (rt_ui16 *)info->iar0;
+    rt_ui16 *b16 = (rt_ui16 *)info->far0;
+    rt_ui16 *c16 = (rt_ui16 *)info->ico2;
+
+    rt_si32 t1, t2, t3, t4, t5, u1, u2, u3, u4, u5;
+    rt_si32 ua[256];
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n / 2;
+        while (j-->0)
+        {
+            t1 = SAT((rt_si16)a16[j] + (rt_si16)b16[j], -32768, 32767);
+            t2 = SAT((rt_si16)a16[j] - (rt_si16)b16[j], -32768, 32767);
+            t3 = RT_MIN(t1, t2);
+            t4 = RT_MAX((rt_si16)a16[j], (rt_si16)b16[j]);
+            t5 = SAT((rt_ui16)t3 + (rt_ui16)t4, 0, 65535);
+            t5 = SAT(t5 - a16[j], 0, 65535);
+            t5 = (t5 + b16[j] + 1) >> 1;
+            c16[j] = (rt_ui16)(t5 + t1 - t2);
+        }
+
+        for (k = 0; k < n; k += v)
+        {
+            for (j = 0; j < v; j++)
+            {
+                u1 = SAT(a08[k+j] + b08[k+j], 0, 255);
+                u2 = SAT(a08[k+j] - b08[k+j], 0, 255);
+                u3 = RT_MIN(u1, u2);
+                u4 = RT_MAX(a08[k+j], b08[k+j]);
+                u5 = (u3 + u4 + 1) >> 1;
+                ua[j] = (rt_ui08)(u5 + u1 - b08[k+j]);
+            }
+            for (j = 0; j < h; j++)
+            {
+                w = (rt_si16)(ua[j] - SXB(ua[h+j]));
+                c08[k+j] = (rt_ui08)SAT(w, 0, 255);
+                w = (rt_si16)(ua[h+j] + SXB(ua[j]));
+                c08[k+h+j] = (rt_ui08)SAT(w, 0, 255);
+            }
+        }
+    }
+}
+
+#define sub_test(DA)                                                        \
+        movpx_ld(Xmm1, Mesi, W(DA))                                         \
+        movpx_ld(Xmm2, Mebx, W(DA))                                         \
+        adsmn3rr(Xmm3, Xmm1, Xmm2)                                          \
+        sbsmn3rr(Xmm4, Xmm1, Xmm2)                                          \
+        minmn3rr(Xmm5, Xmm3, Xmm4)                                          \
+        maxmn3ld(Xmm6, Xmm1, Mebx, W(DA))                                   \
+        adsmx_rr(Xmm5, Xmm6)                                                \
+        sbsmx_rr(Xmm5, Xmm1)                                                \
+        avgmx_ld(Xmm5, Mebx, W(DA))                                         \
+        addmx_rr(Xmm5, Xmm3)                                                \
+        submx_rr(Xmm5, Xmm4)                                                \
+        movpx_st(Xmm5, Medx, W(DA))                                         \
+        adsmb3rr(Xmm3, Xmm1, Xmm2)                                          \
+        sbsmb3ld(Xmm4, Xmm1, Mebx, W(DA))                                   \
+        minmb3rr(Xmm5, Xmm3, Xmm4)                                          \
+        maxmb3rr(Xmm6, Xmm1, Xmm2)                                          \
+        avgmb_rr(Xmm5, Xmm6)                                                \
+        addmb_rr(Xmm5, Xmm3)                                                \
+        submb_ld(Xmm5, Mebx, W(DA))                                         \
+        cvlmx_rr(Xmm1, Xmm5)                                                \
+        cvhmn_rr(Xmm2, Xmm5)                                                \
+        submx_rr(Xmm1, Xmm2)                                                \
+        cvhmx_rr(Xmm3, Xmm5)                                                \
+        cvlmn_rr(Xmm5, Xmm5)                                                \
+        addmx_rr(Xmm5, Xmm3)                                                \
+        cvsmb_rr(Xmm5, Xmm1, Xmm5)                                          \
+        movpx_st(Xmm5, Mecx, W(DA))
+
+rt_void s_test40(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Rebx, Mebp, inf_FAR0)
+        movxx_ld(Recx, Mebp, inf_ISO1)
+        movxx_ld(Redx, Mebp, inf_ISO2)
+
+        sub_test(AJ0)
+        sub_test(AJ1)
+        sub_test(AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test40(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_real *far0 = info->far0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "X, farr[%d] = %e\n",
+                j, iar0[j], j, far0[j]);
+
+        RT_LOGI("C sub1(iarr[%d]) = %" PR_L "X, sub2(iarr[%d]) = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S sub1(iarr[%d]) = %" PR_L "X, sub2(iarr[%d]) = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#else  /* addmx_rr */
+
+rt_void c_test40(rt_SIMD_INFOX *info)
+{
+}
+
+rt_void s_test40(rt_SIMD_INFOX *info)
+{
+}
+
+rt_void p_test40(rt_SIMD_INFOX *info)
+{
+}
+
+#endif /* addmx_rr */
+
+#endif /* RUN_LEVEL 40 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 41   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 41
+
+rt_void c_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n / S;
+        while (j-->0)
+        {
+            rt_ui32 b = 0, c = 0;
+
+            k = S;
+            while (k-->0)
+            {
+                if (far0[j*S + k] < far0[((j+1)*S + k) % n])
+                {
+                    b |= (k < 32) ? 1u << k : 0;
+                    c += 1;
+                }
+                ico1[j*S + k] = 0;
+                ico2[j*S + k] = 0;
+            }
+
+            /* low 32 bits of the mask as stored by movwx_st (any endian) */
+            *(rt_ui32 *)&ico1[j*S] = b;
+            *(rt_ui32 *)&ico2[j*S] = c;
+        }
+    }
+}
+
+#define msk_test(DA, DB)                                                    \
+        movpx_ld(Xmm1, Mecx, W(DA))                                         \
+        cltps_ld(Xmm1, Mecx, W(DB))                                         \
+        xorpx_rr(Xmm2, Xmm2)                                                \
+        movpx_st(Xmm2, Medx, W(DA))                                         \
+        movpx_st(Xmm2, Mebx, W(DA))                                         \
+        mkbpx_rr(Reax, Xmm1)                                                \
+        mkcpx_rr(Resi, Xmm1)                                                \
+        movwx_st(Reax, Medx, W(DA))                                         \
+        movwx_st(Resi, Mebx, W(DA))
+
+rt_void s_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        msk_test(AJ0, AJ1)
+        msk_test(AJ1, AJ2)
+        msk_test(AJ2, AJ0)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C mkb(farr[%d]) = %" PR_L "X, mkc(farr[%d]) = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S mkb(farr[%d]) = %" PR_L "X, mkc(farr[%d]) = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 41 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 42   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 42
+
+rt_void c_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_elem a = iar0[j];
+            rt_elem b = iar0[(j + S) % n];
+            rt_elem c = iar0[(j + 2*S) % n];
+
+            rt_elem x = (b - a) >> (22+32*(L-1));
+            rt_elem y = (c - a) >> (22+32*(L-1));
+            rt_uelm u = x, v = y, r = 0;
+
+            r = (r << 1) + (u == v);
+            r = (r << 1) + (u != v);
+            r = (r << 1) + (u <  v);
+            r = (r << 1) + (x <  y);
+            r = (r << 1) + (u <= v);
+            r = (r << 1) + (x <= y);
+            r = (r << 1) + (u >  v);
+            r = (r << 1) + (x >  y);
+            r = (r << 1) + (u >= v);
+            r = (r << 1) + (x >= y);
+
+            u = (rt_uelm)(b - a) << (5+3*(L-1));
+            v = (rt_uelm)(c - a) << (5+3*(L-1));
+            x = (rt_elem)u;
+            y = (rt_elem)v;
+
+            r = (r << 1) + (u >  v);
+            r = (r << 1) + (x >  y);
+            r = (r << 1) + (u <  v);
+            r = (r << 1) + (x <  y);
+
+            ico1[j] = (rt_elem)r;
+
+            r  = (u < v ? u : v);
+            r -= (u > v ? u : v) << 1;
+            r += (rt_uelm)(x < y ? x : y) << 2;
+            r -= (rt_uelm)(x > y ? x : y) << 3;
+            r += (x < 0 ? 0 - u : u);
+            r += (y < 0 ? 0 - v : v) << 4;
+
+            ico2[j] = (rt_elem)r;
+        }
+    }
+}
+
+#define cmp_acc(XM)                                                         \
+        shlpx_ri(Xmm5, IB(1))                                               \
+        subpx_rr(Xmm5, W(XM))
+
+#define cmp_test(DA, DB, DC)                                                \
+        movpx_ld(Xmm1, Mecx, W(DB))                                         \
+        subpx_ld(Xmm1, Mecx, W(DA))                                         \
+        movpx_ld(Xmm2, Mecx, W(DC))                                         \
+        subpx_ld(Xmm2, Mecx, W(DA))                                         \
+        movpx_rr(Xmm3, Xmm1)                                                \
+        shrpn_ri(Xmm3, IB(22+32*(L-1)))                                     \
+        movpx_rr(Xmm4, Xmm2)                                                \
+        shrpn_ri(Xmm4, IB(22+32*(L-1)))                                     \
+        movpx_st(Xmm4, Mebx, W(DA))                                         \
+        xorpx_rr(Xmm5, Xmm5)                                                \
+        ceqpx3rr(Xmm6, Xmm3, Xmm4)                                          \
+        cmp_acc(Xmm6)                                                       \
+        cnepx3ld(Xmm6, Xmm3, Mebx, W(DA))                                   \
+        cmp_acc(Xmm6)                                                       \
+        movpx_rr(Xmm6, Xmm3)                                                \
+        cltpx_rr(Xmm6, Xmm4)                                                \
+        cmp_acc(Xmm6)                                                       \
+        movpx_rr(Xmm6, Xmm3)                                                \
+        cltpn_ld(Xmm6, Mebx, W(DA))                                         \
+        cmp_acc(Xmm6)                                                       \
+        clepx3rr(Xmm6, Xmm3, Xmm4)                                          \
+        cmp_acc(Xmm6)                                                       \
+        clepn3ld(Xmm6, Xmm3, Mebx, W(DA))                                   \
+        cmp_acc(Xmm6)                                                       \
+        movpx_rr(Xmm6, Xmm3)                                                \
+        cgtpx_ld(Xmm6, Mebx, W(DA))                                         \
+        cmp_acc(Xmm6)                                                       \
+        cgtpn3rr(Xmm6, Xmm3, Xmm4)                                          \
+        cmp_acc(Xmm6)                                                       \
+        cgepx3ld(Xmm6, Xmm3, Mebx, W(DA))                                   \
+        cmp_acc(Xmm6)                                                       \
+        movpx_rr(Xmm6, Xmm3)                                                \
+        cgepn_rr(Xmm6, Xmm4)                                                \
+        cmp_acc(Xmm6)                                                       \
+        shlpx_ri(Xmm1, IB(5+3*(L-1)))                                       \
+        shlpx_ri(Xmm2, IB(5+3*(L-1)))                                       \
+        cgtpx3rr(Xmm6, Xmm1, Xmm2)                                          \
+        cmp_acc(Xmm6)                                                       \
+        cgtpn3rr(Xmm6, Xmm1, Xmm2)                                          \
+        cmp_acc(Xmm6)                                                       \
+        cltpx3rr(Xmm6, Xmm1, Xmm2)                                          \
+        cmp_acc(Xmm6)                                                       \
+        cltpn3rr(Xmm6, Xmm1, Xmm2)                                          \
+        cmp_acc(Xmm6)                                                       \
+        movpx_st(Xmm5, Medx, W(DA))                                         \
+        movpx_st(Xmm2, Mebx, W(DA))                                         \
+        minpx3rr(Xmm3, Xmm1, Xmm2)                                          \
+        maxpx3ld(Xmm4, Xmm1, Mebx, W(DA))                                   \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        subpx_rr(Xmm3, Xmm4)                                                \
+        movpx_rr(Xmm4, Xmm1)                                                \
+        minpn_ld(Xmm4, Mebx, W(DA))                                         \
+        shlpx_ri(Xmm4, IB(2))                                               \
+        addpx_rr(Xmm3, Xmm4)                                                \
+        movpx_rr(Xmm4, Xmm1)                                                \
+        maxpn_rr(Xmm4, Xmm2)                                                \
+        shlpx_ri(Xmm4, IB(3))                                               \
+        subpx_rr(Xmm3, Xmm4)                                                \
+        abspn_rr(Xmm4, Xmm1)                                                \
+        addpx_rr(Xmm3, Xmm4)                                                \
+        abspn_rx(Xmm2)                                                      \
+        shlpx_ri(Xmm2, IB(4))                                               \
+        addpx_rr(Xmm3, Xmm2)                                                \
+        movpx_st(Xmm3, Mebx, W(DA))
+
+rt_void s_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        cmp_test(AJ0, AJ1, AJ2)
+        cmp_test(AJ1, AJ2, AJ0)
+        cmp_test(AJ2, AJ0, AJ1)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d, "
+                "iarr[%d] = %" PR_L "d\n", j, iar0[j],
+                (j + S) % n, iar0[(j + S) % n],
+                (j + 2*S) % n, iar0[(j + 2*S) % n]);
+
+        RT_LOGI("C cmp(iarr[%d]) = %" PR_L "X, mmx(iarr[%d]) = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S cmp(iarr[%d]) = %" PR_L "X, mmx(iarr[%d]) = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 42 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 43   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 43
+
+rt_void c_test43(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_elem a = iar0[j];
+            rt_elem b = iar0[(j + S) % n];
+            rt_elem c = iar0[(j + 2*S) % n];
+
+            rt_si32 m = a > b, k = a < c;
+            rt_uelm r, s = m ? b : c;
+
+            ico1[j] = s;
+
+            r = k ? a : b;
+            r = (r << 1) + (m ? c : a);
+            r = (r << 1) + (k ? c : s);
+            r = (r << 1) + (m ? b : a);
+            r = (r << 1) + (k ? c : b);
+            r = (r << 1) + (m ? a : c);
+
+            ico2[j] = (rt_elem)r;
+        }
+    }
+}
+
+#define sel_acc(XS)                                                         \
+        shlpx_ri(Xmm7, IB(1))                                               \
+        addpx_rr(Xmm7, W(XS))
+
+#define sel_test(DA, DB, DC)                                                \
+        movpx_ld(Xmm1, Mecx, W(DA))                                         \
+        movpx_ld(Xmm2, Mecx, W(DB))                                         \
+        movpx_ld(Xmm3, Mecx, W(DC))                                         \
+        cgtpn3rr(Xmm4, Xmm1, Xmm2)                                          \
+        cltpn3ld(Xmm5, Xmm1, Mecx, W(DC))                                   \
+        selpx3rr(Xmm6, Xmm4, Xmm3, Xmm2)                                    \
+        movpx_st(Xmm6, Medx, W(DA))                                         \
+        movpx_rr(Xmm7, Xmm2)                                                \
+        selpx_rr(Xmm7, Xmm5, Xmm1)                                          \
+        selpx3ld(Xmm6, Xmm4, Xmm1, Mecx, W(DC))                             \
+        sel_acc(Xmm6)                                                       \
+        movpx_ld(Xmm6, Medx, W(DA))                                         \
+        selpx_ld(Xmm6, Xmm5, Mecx, W(DC))                                   \
+        sel_acc(Xmm6)                                                       \
+        movpx_rr(Xmm6, Xmm1)                                                \
+        selpx3rr(Xmm6, Xmm4, Xmm6, Xmm2)                                    \
+        sel_acc(Xmm6)                                                       \
+        movpx_rr(Xmm6, Xmm3)                                                \
+        selpx3rr(Xmm6, Xmm5, Xmm2, Xmm6)                                    \
+        sel_acc(Xmm6)                                                       \
+        selpx3rr(Xmm4, Xmm4, Xmm3, Xmm1)                                    \
+        sel_acc(Xmm4)                                                       \
+        movpx_st(Xmm7, Mebx, W(DA))
+
+rt_void s_test43(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        sel_test(AJ0, AJ1, AJ2)
+        sel_test(AJ1, AJ2, AJ0)
+        sel_test(AJ2, AJ0, AJ1)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test43(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d, "
+                "iarr[%d] = %" PR_L "d\n", j, iar0[j],
+                (j + S) % n, iar0[(j + S) % n],
+                (j + 2*S) % n, iar0[(j + 2*S) % n]);
+
+        RT_LOGI("C sel(iarr[%d]) = %" PR_L "X, acc(iarr[%d]) = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S sel(iarr[%d]) = %" PR_L "X, acc(iarr[%d]) = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 43 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 44   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 44
+
+rt_void c_test44(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_si32 k = j % S, b = j - k;
+
+            rt_elem *c = iar0 + (b + 2*S) % n;
+
+            ico1[j] = k == 0 ? c[S-1] : iar0[b];
+            ico2[j] = k == 1 ? c[0] : k == S-1 ? c[1] : iar0[(b + S) % n];
+        }
+    }
+}
+
+#define spl_test(DA, DB, DC)                                                \
+        movyx_ld(Reax, Mecx, W(DA))                                         \
+        splpx_rr(Xmm1, Reax)                                                \
+        splpx_ld(Xmm2, Mecx, W(DB))                                         \
+        movpx_ld(Xmm3, Mecx, W(DC))                                         \
+        extpx_rr(Resi, Xmm3, IB(S-1))                                       \
+        inspx_rr(Xmm1, Resi, IB(0))                                         \
+        extpx_rr(Reax, Xmm3, IB(1))                                         \
+        inspx_rr(Xmm2, Reax, IB(S-1))                                       \
+        extpx_rr(Resi, Xmm3, IB(0))                                         \
+        inspx_rr(Xmm2, Resi, IB(1))                                         \
+        movpx_st(Xmm1, Medx, W(DA))                                         \
+        movpx_st(Xmm2, Mebx, W(DA))
+
+rt_void s_test44(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        spl_test(AJ0, AJ1, AJ2)
+        spl_test(AJ1, AJ2, AJ0)
+        spl_test(AJ2, AJ0, AJ1)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test44(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d, "
+                "iarr[%d] = %" PR_L "d\n", j, iar0[j],
+                (j + S) % n, iar0[(j + S) % n],
+                (j + 2*S) % n, iar0[(j + 2*S) % n]);
+
+        RT_LOGI("C spl(iarr[%d]) = %" PR_L "X, spl(iarr[%d]) = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S spl(iarr[%d]) = %" PR_L "X, spl(iarr[%d]) = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 44 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 45   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 45
+
+rt_void c_test45(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_si32 k = j % S, b = j - k, m = j % (4/L), h = k - m;
+            rt_si32 w = 2/L, e = 4/L - 1;
+
+            rt_elem *a = iar0 + b;
+            rt_elem *p = iar0 + (b + S) % n;
+            rt_elem *c = iar0 + (b + 2*S) % n;
+
+            rt_uelm r;
+
+            ico1[j] = a[h + ((0x9C >> m*w) & e)];
+
+            r = p[h + ((0xB1 >> m*w) & e)];
+            r = (r << 1) + (m & 1 ? p : a)[h + m/2];
+            r = (r << 1) + (m & 1 ? c : a)[h + m/2 + w];
+            r = (r << 1) + (m & 1 ? c : p)[h + m/2];
+            r = (r << 1) + (m & 1 ? a : c)[h + m/2 + w];
+            r = (r << 1) + a[S-1-k];
+            r = (r << 1) + p[S-1-k];
+            r = (r << 1) + p[h + ((0x27 >> m*w) & e)];
+
+            ico2[j] = (rt_elem)r;
+        }
+    }
+}
+
+#define shf_test(DA, DB, DC)                                                \
+        movpx_ld(Xmm1, Mecx, W(DA))                                         \
+        movpx_ld(Xmm2, Mecx, W(DB))                                         \
+        movpx_ld(Xmm3, Mecx, W(DC))                                         \
+        movpx_rr(Xmm0, Xmm1)                                                \
+        shfpx_ri(Xmm0, IB(0x9C))                                            \
+        shfpx3ri(Xmm4, Xmm2, IB(0xB1))                                      \
+        ilopx3rr(Xmm5, Xmm1, Xmm2)                                          \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        ihipx3ld(Xmm5, Xmm1, Mecx, W(DC))                                   \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        movpx_rr(Xmm5, Xmm2)                                                \
+        ilopx_ld(Xmm5, Mecx, W(DC))                                         \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        movpx_rr(Xmm5, Xmm3)                                                \
+        ihipx_rr(Xmm5, Xmm1)                                                \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        revpx_rr(Xmm5, Xmm1)                                                \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        movpx_rr(Xmm5, Xmm2)                                                \
+        revpx_rx(Xmm5)                                                      \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        shfpx3ri(Xmm5, Xmm2, IB(0x27))                                      \
+        shlpx_ri(Xmm4, IB(1))                                               \
+        addpx_rr(Xmm4, Xmm5)                                                \
+        movpx_st(Xmm0, Medx, W(DA))                                         \
+        movpx_st(Xmm4, Mebx, W(DA))
+
+rt_void s_test45(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        shf_test(AJ0, AJ1, AJ2)
+        shf_test(AJ1, AJ2, AJ0)
+        shf_test(AJ2, AJ0, AJ1)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test45(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d, "
+                "iarr[%d] = %" PR_L "d\n", j, iar0[j],
+                (j + S) % n, iar0[(j + S) % n],
+                (j + 2*S) % n, iar0[(j + 2*S) % n]);
+
+        RT_LOGI("C shf(iarr[%d]) = %" PR_L "X, shf(iarr[%d]) = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S shf(iarr[%d]) = %" PR_L "X, shf(iarr[%d]) = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 45 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+testXX c_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    c_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    c_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    c_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    c_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    c_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    c_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    c_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    c_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    c_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    c_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    c_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    c_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    c_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    c_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    c_test15,
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    c_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    c_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    c_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    c_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    c_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    c_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    c_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    c_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    c_test24,
+#endif /* RUN_LEVEL 24 */
+#if RUN_LEVEL >= 25
+    c_test25,
+#endif /* RUN_LEVEL 25 */
+#if RUN_LEVEL >= 26
+    c_test26,
+#endif /* RUN_LEVEL 26 */
+#if RUN_LEVEL >= 27
+    c_test27,
+#endif /* RUN_LEVEL 27 */
+#if RUN_LEVEL >= 28
+    c_test28,
+#endif /* RUN_LEVEL 28 */
+#if RUN_LEVEL >= 29
+    c_test29,
+#endif /* RUN_LEVEL 29 */
+#if RUN_LEVEL >= 30
+    c_test30,
+#endif /* RUN_LEVEL 30 */
+#if RUN_LEVEL >= 31
+    c_test31,
+#endif /* RUN_LEVEL 31 */
+#if RUN_LEVEL >= 32
+    c_test32,
+#endif /* RUN_LEVEL 32 */
+#if RUN_LEVEL >= 33
+    c_test33,
+#endif /* RUN_LEVEL 33 */
+#if RUN_LEVEL >= 34
+    c_test34,
+#endif /* RUN_LEVEL 34 */
+#if RUN_LEVEL >= 35
+    c_test35,
+#endif /* RUN_LEVEL 35 */
+#if RUN_LEVEL >= 36
+    c_test36,
+#endif /* RUN_LEVEL 36 */
+#if RUN_LEVEL >= 37
+    c_test37,
+#endif /* RUN_LEVEL 37 */
+#if RUN_LEVEL >= 38
+    c_test38,
+#endif /* RUN_LEVEL 38 */
+#if RUN_LEVEL >= 39
+    c_test39,
+#endif /* RUN_LEVEL 39 */
+#if RUN_LEVEL >= 40
+    c_test40,
+#endif /* RUN_LEVEL 40 */
+#if RUN_LEVEL >= 41
+    c_test41,
+#endif /* RUN_LEVEL 41 */
+#if RUN_LEVEL >= 42
+    c_test42,
+#endif /* RUN_LEVEL 42 */
+#if RUN_LEVEL >= 43
+    c_test43,
+#endif /* RUN_LEVEL 43 */
+#if RUN_LEVEL >= 44
+    c_test44,
+#endif /* RUN_LEVEL 44 */
+#if RUN_LEVEL >= 45
+    c_test45,
+#endif /* RUN_LEVEL 45 */
+};
+
+testXX s_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    s_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    s_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    s_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    s_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    s_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    s_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    s_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    s_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    s_test09,
+#endif /* RUN_LEVEL  9 */
 
 #if RUN_LEVEL >= 10
     s_test10,
@@ -3568,6 +6269,69 @@ testXX s_test[RUN_LEVEL] =
 #if RUN_LEVEL >= 24
     s_test24,
 #endif /* RUN_LEVEL 24 */
+#if RUN_LEVEL >= 25
+    s_test25,
+#endif /* RUN_LEVEL 25 */
+#if RUN_LEVEL >= 26
+    s_test26,
+#endif /* RUN_LEVEL 26 */
+#if RUN_LEVEL >= 27
+    s_test27,
+#endif /* RUN_LEVEL 27 */
+#if RUN_LEVEL >= 28
+    s_test28,
+#endif /* RUN_LEVEL 28 */
+#if RUN_LEVEL >= 29
+    s_test29,
+#endif /* RUN_LEVEL 29 */
+#if RUN_LEVEL >= 30
+    s_test30,
+#endif /* RUN_LEVEL 30 */
+#if RUN_LEVEL >= 31
+    s_test31,
+#endif /* RUN_LEVEL 31 */
+#if RUN_LEVEL >= 32
+    s_test32,
+#endif /* RUN_LEVEL 32 */
+#if RUN_LEVEL >= 33
+    s_test33,
+#endif /* RUN_LEVEL 33 */
+#if RUN_LEVEL >= 34
+    s_test34,
+#endif /* RUN_LEVEL 34 */
+#if RUN_LEVEL >= 35
+    s_test35,
+#endif /* RUN_LEVEL 35 */
+#if RUN_LEVEL >= 36
+    s_test36,
+#endif /* RUN_LEVEL 36 */
+#if RUN_LEVEL >= 37
+    s_test37,
+#endif /* RUN_LEVEL 37 */
+#if RUN_LEVEL >= 38
+    s_test38,
+#endif /* RUN_LEVEL 38 */
+#if RUN_LEVEL >= 39
+    s_test39,
+#endif /* RUN_LEVEL 39 */
+#if RUN_LEVEL >= 40
+    s_test40,
+#endif /* RUN_LEVEL 40 */
+#if RUN_LEVEL >= 41
+    s_test41,
+#endif /* RUN_LEVEL 41 */
+#if RUN_LEVEL >= 42
+    s_test42,
+#endif /* RUN_LEVEL 42 */
+#if RUN_LEVEL >= 43
+    s_test43,
+#endif /* RUN_LEVEL 43 */
+#if RUN_LEVEL >= 44
+    s_test44,
+#endif /* RUN_LEVEL 44 */
+#if RUN_LEVEL >= 45
+    s_test45,
+#endif /* RUN_LEVEL 45 */
 };
 
 testXX p_test[RUN_LEVEL] =
@@ -3667,6 +6431,69 @@ testXX p_test[RUN_LEVEL] =
 #if RUN_LEVEL >= 24
     p_test24,
 #endif /* RUN_LEVEL 24 */
+#if RUN_LEVEL >= 25
+    p_test25,
+#endif /* RUN_LEVEL 25 */
+#if RUN_LEVEL >= 26
+    p_test26,
+#endif /* RUN_LEVEL 26 */
+#if RUN_LEVEL >= 27
+    p_test27,
+#endif /* RUN_LEVEL 27 */
+#if RUN_LEVEL >= 28
+    p_test28,
+#endif /* RUN_LEVEL 28 */
+#if RUN_LEVEL >= 29
+    p_test29,
+#endif /* RUN_LEVEL 29 */
+#if RUN_LEVEL >= 30
+    p_test30,
+#endif /* RUN_LEVEL 30 */
+#if RUN_LEVEL >= 31
+    p_test31,
+#endif /* RUN_LEVEL 31 */
+#if RUN_LEVEL >= 32
+    p_test32,
+#endif /* RUN_LEVEL 32 */
+#if RUN_LEVEL >= 33
+    p_test33,
+#endif /* RUN_LEVEL 33 */
+#if RUN_LEVEL >= 34
+    p_test34,
+#endif /* RUN_LEVEL 34 */
+#if RUN_LEVEL >= 35
+    p_test35,
+#endif /* RUN_LEVEL 35 */
+#if RUN_LEVEL >= 36
+    p_test36,
+#endif /* RUN_LEVEL 36 */
+#if RUN_LEVEL >= 37
+    p_test37,
+#endif /* RUN_LEVEL 37 */
+#if RUN_LEVEL >= 38
+    p_test38,
+#endif /* RUN_LEVEL 38 */
+#if RUN_LEVEL >= 39
+    p_test39,
+#endif /* RUN_LEVEL 39 */
+#if RUN_LEVEL >= 40
+    p_test40,
+#endif /* RUN_LEVEL 40 */
+#if RUN_LEVEL >= 41
+    p_test41,
+#endif /* RUN_LEVEL 41 */
+#if RUN_LEVEL >= 42
+    p_test42,
+#endif /* RUN_LEVEL 42 */
+#if RUN_LEVEL >= 43
+    p_test43,
+#endif /* RUN_LEVEL 43 */
+#if RUN_LEVEL >= 44
+    p_test44,
+#endif /* RUN_LEVEL 44 */
+#if RUN_LEVEL >= 45
+    p_test45,
+#endif /* RUN_LEVEL 45 */
 };
 
 /******************************************************************************/
@@ -3679,8 +6506,6 @@ testXX p_test[RUN_LEVEL] =
 #define sregs_sa() /* empty SIMD-regs instruction definitions */
 #define sregs_la() /* empty SIMD-regs instruction definitions */
 
-rt_time get_time();
-
 /*
  * info - info original pointer
  * inf0 - info aligned pointer
@@ -3701,7 +6526,11 @@ rt_time get_time();
  * iso1 - int aligned S out 1
  * iso2 - int aligned S out 2
  */
+#if   (defined RT_SIMD_FAT)
+rt_si32 main_simd(rt_si32 argc, rt_char *argv[])
+#else /* RT_SIMD_FAT */
 rt_si32 main(rt_si32 argc, rt_char *argv[])
+#endif /* RT_SIMD_FAT */
 {
     rt_si32 k, l, r, t;
 
@@ -3883,31 +6712,28 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     inf0->size = ARR_SIZE;
     inf0->tail = (rt_pntr)0xABCDEF01;
 
+#if RUN_LEVEL >= 31
+    rt_pntr mbig = sys_alloc(2 * SWP_MAX + MASK);
+    rt_real *fsrc = (rt_real *)(((rt_full)mbig + MASK) & ~MASK);
+    rt_real *fdst = fsrc + SWP_MAX / sizeof(rt_real);
+
+    for (k = 0; k < SWP_MAX / (rt_si32)sizeof(rt_real); k++)
+    {
+        fsrc[k] = far0[k % ARR_SIZE];
+        fdst[k] = 0.0;
+    }
+
+    inf0->fsrc = fsrc;
+    inf0->fdst = fdst;
+#endif /* RUN_LEVEL 31 */
+
     rt_si32 simd = 0;
 
     ASM_ENTER(inf0)
         verxx_xx()
     ASM_LEAVE(inf0)
 
-    if (RT_FALSE
-#if   (RT_2K8_R8) && (RT_SIMD == 2048)
-    ||  (inf0->ver & (RT_2K8_R8 << 0x1C)) == 0
-#elif (RT_1K4)    && (RT_SIMD == 1024)
-    ||  (inf0->ver & (RT_1K4 << 0x18)) == 0
-#elif (RT_1K4_R8) && (RT_SIMD == 1024)
-    ||  (inf0->ver & (RT_1K4_R8 << 0x14)) == 0
-#elif (RT_512)    && (RT_SIMD == 512)
-    ||  (inf0->ver & (RT_512 << 0x10)) == 0
-#elif (RT_512_R8) && (RT_SIMD == 512)
-    ||  (inf0->ver & (RT_512_R8 << 0x0C)) == 0
-#elif (RT_256)    && (RT_SIMD == 256)
-    ||  (inf0->ver & (RT_256 << 0x08)) == 0
-#elif (RT_256_R8) && (RT_SIMD == 256)
-    ||  (inf0->ver & (RT_256_R8 << 0x04)) == 0
-#elif (RT_128)    && (RT_SIMD == 128)
-    ||  (inf0->ver & (RT_128 << 0x00)) == 0
-#endif /* RT_128 */
-       )
+    if ((inf0->ver & RT_SIMD_TARGET) == 0)
     {
         RT_LOGI("Chosen SIMD target is not supported, check build flags\n");
         n_done = -1;
@@ -3973,6 +6799,9 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
     sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
     sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
+#if RUN_LEVEL >= 31
+    sys_free(mbig, 2 * SWP_MAX + MASK);
+#endif /* RUN_LEVEL 31 */
     sys_free(marr, 10 * ARR_SIZE * sizeof(rt_ui32) + MASK);
 
 #if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
@@ -3986,12 +6815,100 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     return 0;
 }
 
+#if   (defined RT_SIMD_FAT)
+
+} /* namespace RT_SIMD_FAT */
+
+#endif /* RT_SIMD_FAT */
+
+#if   (defined RT_SIMD_FAT_MAIN)
+
+typedef rt_si32 (*rt_FUNC_MAIN)(rt_si32 argc, rt_char *argv[]);
+
+/*
+ * SIMD targets compiled into the fat binary (must match simd_make_x64.mk),
+ * each providing its target mask and tests' entry point in its namespace.
+ */
+#define RT_SIMD_FAT_DECL(ns)                                                \
+namespace ns                                                                \
+{                                                                           \
+    extern rt_si32 t_mask;                                                  \
+    rt_si32 main_simd(rt_si32 argc, rt_char *argv[]);                       \
+}
+
+RT_SIMD_FAT_DECL(simd_128v4)
+RT_SIMD_FAT_DECL(simd_256v1)
+RT_SIMD_FAT_DECL(simd_256v2)
+RT_SIMD_FAT_DECL(simd_512v1)
+RT_SIMD_FAT_DECL(simd_512v2)
+
+/*
+ * t_list - target masks list
+ * f_list - test entries list
+ */
+rt_si32 main(rt_si32 argc, rt_char *argv[])
+{
+    rt_si32 t_list[] =
+    {
+        simd_128v4::t_mask,
+        simd_256v1::t_mask,
+        simd_256v2::t_mask,
+        simd_512v1::t_mask,
+        simd_512v2::t_mask,
+    };
+
+    rt_FUNC_MAIN f_list[] =
+    {
+        simd_128v4::main_simd,
+        simd_256v1::main_simd,
+        simd_256v2::main_simd,
+        simd_512v1::main_simd,
+        simd_512v2::main_simd,
+    };
+
+    rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFO) + MASK);
+    rt_SIMD_INFO *inf0 = (rt_SIMD_INFO *)(((rt_full)info + MASK) & ~MASK);
+
+    rt_pntr regs = sys_alloc(sizeof(rt_SIMD_REGS) + MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(((rt_full)regs + MASK) & ~MASK);
+
+    ASM_INIT(inf0, reg0)
+
+    ASM_ENTER(inf0)
+        verxx_xx()
+    ASM_LEAVE(inf0)
+
+    rt_si32 k = mask_pick(inf0->ver, t_list, RT_ARR_SIZE(t_list));
+
+    ASM_DONE(inf0)
+
+    sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
+    sys_free(info, sizeof(rt_SIMD_INFO) + MASK);
+
+    if (k < 0)
+    {
+        RT_LOGI("None of fat-build SIMD targets is supported, exiting...\n");
+        return 0;
+    }
+
+    rt_si32 simd = from_mask(t_list[k]);
+
+    RT_LOGI("--------------------------------- fat pick = %4dx%dv%d ---\n",
+            (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+
+    return f_list[k](argc, argv);
+}
+
+#endif /* RT_SIMD_FAT_MAIN */
+
 /******************************************************************************/
 /**********************************   UTILS   *********************************/
 /******************************************************************************/
 
 #include "rtzero.h"
 
+#if !(defined RT_SIMD_FAT) || (defined RT_SIMD_FAT_MAIN)
+
 #if RT_POINTER == 64
 #if RT_ADDRESS == 32
 
@@ -4208,6 +7125,8 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 
 #endif /* ------------- OS specific ----------------------------------------- */
 
+#endif /* !RT_SIMD_FAT || RT_SIMD_FAT_MAIN */
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/